@@ -0,0 +1,412 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_AtomicCountedPtr_h
+#define Mezz_Foundation_AtomicCountedPtr_h
+
+/// @file
+/// @brief This file describes and implements a thread-safe reference count and an atomic CountedPtr cell.
+
+#ifndef SWIG
+    #include "CountedPtr.h"
+    #include "MezzException.h"
+
+    #include <atomic>
+#endif
+
+namespace Mezzanine
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A reference counter like ReferenceCount that can be shared across threads.
+    /// @details The counts are atomic, so CountedPtr and WeakCountedPtr instances sharing one of these can be
+    /// copied and released on different threads at the same time. Each individual pointer instance is still not
+    /// safe to modify from multiple threads, for that use an AtomicCountedPtr.
+    /// @n @n
+    /// This is selected through ReferenceCountTraits, the simplest way is to derive the specialization from
+    /// AtomicReferenceCountTraits. It can be combined with PooledReferenceCount as well.
+    /// @tparam TypePointedTo The type of object the pointers will point to.
+    ///////////////////////////////////////////////////////////////////////////////
+    template<typename TypePointedTo>
+    class AtomicReferenceCount
+    {
+    protected:
+        /// @brief  The raw pointer that is the core of this smart pointer.
+        TypePointedTo* Target;
+    private:
+        /// @brief This is the counter that stores how many references exist.
+        std::atomic<Whole> RefCount;
+
+        /// @brief This is the counter that stores how many weak references exist, plus one for all the strong ones.
+        std::atomic<Whole> WeakRefCount;
+
+    public:
+        /// @brief Indicates that this counter may be used from multiple threads, required by AtomicCountedPtr.
+        static constexpr Boole ThreadSafeCounting = true;
+
+        /// @brief Constructor.
+        /// @param InitialPointer A pointer to the type of this template. This defaults to nullptr if not provided.
+        /// @param InitialCount The number of references to default to this defaults to 0 if not provided.
+        AtomicReferenceCount(TypePointedTo* InitialPointer = nullptr, Whole InitialCount = 0)
+            : Target(InitialPointer), RefCount(InitialCount), WeakRefCount(1)
+            {}
+
+        /// @brief Destructor, cleans up the object if it wasn't already destroyed when the last reference deletes this.
+        virtual ~AtomicReferenceCount()
+            { delete Target; }
+
+        /// @brief Increase the reference count by one and return the updated count.
+        /// @return The updated count.
+        Whole IncrementReferenceCount()
+            { return RefCount.fetch_add(1,std::memory_order_relaxed) + 1; }
+
+        /// @brief Increase the reference count by an arbitrary amount and return the updated count.
+        /// @param Amount The number of references to add.
+        /// @return The updated count.
+        Whole IncrementReferenceCount(const Whole Amount)
+            { return RefCount.fetch_add(Amount,std::memory_order_relaxed) + Amount; }
+
+        /// @brief Increase the reference count by one, but only if the managed object still exists.
+        /// @details This is how a WeakCountedPtr is promoted to a CountedPtr.
+        /// @return The updated count, or 0 if the managed object has already been destroyed.
+        Whole IncrementReferenceCountIfNonZero()
+        {
+            Whole Current = RefCount.load(std::memory_order_relaxed);
+            while( Current != 0 )
+            {
+                if( RefCount.compare_exchange_weak(Current,Current + 1,std::memory_order_acquire,
+                                                                       std::memory_order_relaxed) )
+                {
+                    return Current + 1;
+                }
+            }
+            return 0;
+        }
+
+        /// @brief Decrease the reference count by one and return the updated count.
+        /// @return The updated count.
+        Whole DecrementReferenceCount()
+            { return RefCount.fetch_sub(1,std::memory_order_acq_rel) - 1; }
+
+        /// @brief Increase the weak reference count by one and return the updated count.
+        /// @return The updated count.
+        Whole IncrementWeakReferenceCount()
+            { return WeakRefCount.fetch_add(1,std::memory_order_relaxed) + 1; }
+
+        /// @brief Decrease the weak reference count by one and return the updated count.
+        /// @return The updated count, when this is 0 this counter can be deleted.
+        Whole DecrementWeakReferenceCount()
+            { return WeakRefCount.fetch_sub(1,std::memory_order_acq_rel) - 1; }
+
+        /// @brief Destroys the managed object without destroying this counter.
+        /// @details This is called when the last strong reference is released. Counters that need to clean up the
+        /// target some other way than delete can override this.
+        virtual void DestroyTarget()
+        {
+            delete Target;
+            Target = nullptr;
+        }
+
+        /// @brief Gets the actual pointer to the target.
+        /// @return A pointer of the targeted type to the object being managed.
+        TypePointedTo* GetReferenceCountTargetAsPointer()
+            { return Target; }
+
+        /// @brief Get the current amount of references.
+        /// @return A Whole with the current reference count.
+        Whole GetReferenceCount()
+            { return RefCount.load(std::memory_order_relaxed); }
+
+        /// @brief Get the current amount of weak references.
+        /// @return A Whole with the current weak reference count, not including the one held by strong references.
+        Whole GetWeakReferenceCount()
+        {
+            const Whole Weak = WeakRefCount.load(std::memory_order_relaxed);
+            return RefCount.load(std::memory_order_relaxed) ? Weak - 1 : Weak;
+        }
+
+        /// @brief Get a pointer to the target as the most derived type in of this object.
+        /// @return A pointer, for use with CountedPtrCast.
+        virtual TypePointedTo* GetMostDerived()
+            { return Target; }
+    };//AtomicReferenceCount
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief ReferenceCountTraits for a type whose CountedPtr instances will be shared between threads.
+    /// @details To have CountedPtr use atomic counters for a type specialize ReferenceCountTraits for it and
+    /// inherit from this, for example:
+    /// @code
+    /// template<>
+    /// class ReferenceCountTraits<Foo> : public AtomicReferenceCountTraits<Foo>
+    ///     {};
+    /// @endcode
+    /// @tparam T The type CountedPtr will point to.
+    template<typename T>
+    class AtomicReferenceCountTraits
+    {
+    public:
+        /// @brief This is type of the ReferenceCounter, an atomic version of the default.
+        using RefCountType = AtomicReferenceCount<T>;
+
+        /// @brief This will return a pointer to the reference count.
+        /// @param Target A pointer to the freshly created object.
+        /// @return This will return a pointer to a valid reference counter.
+        static RefCountType* ConstructionPointer(T* Target)
+            { return new RefCountType(Target); }
+
+        /// @brief Used to determine if the data a CountedPtr is managing can be cast.
+        enum { IsCastable = CastStatic };
+    };//AtomicReferenceCountTraits
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A CountedPtr that can be read and replaced by many threads at once without locking.
+    /// @details This is intended for publishing shared objects, like configuration, from one thread to many.
+    /// Readers call Load to get a CountedPtr of their own to the current object, writers call Store, Exchange or
+    /// CompareExchange to replace it. No operation takes a lock.
+    /// @n @n
+    /// This uses split reference counting. The cell holds one reference to its current counter, and packs the
+    /// counter pointer together with a 16 bit "local" count into a single 64 bit atomic word. A Load increments
+    /// the local count and reads the pointer in one atomic operation, which keeps the counter alive long enough to
+    /// add a real reference to it, then gives the local count back. If a writer replaced the pointer in between it
+    /// transfers any outstanding local counts to the old counter so every reader stays correct.
+    /// @n @n
+    /// A Load is one atomic add, one increment of the counter and usually one compare and swap to give the local
+    /// count back. That compare and swap retries if another thread changed the cell in between, so reads are
+    /// lock-free but not wait-free: a reader never blocks, but under heavy contention it can retry many times.
+    /// @tparam TypePointedTo The target type the pointers are pointing to.
+    /// @pre The reference counter must count atomically, see AtomicReferenceCountTraits. The counter must also be
+    /// allocated at an address that fits in 48 bits. This is true for user space on current 64 bit platforms unless
+    /// 5-level paging hands out higher addresses, which is checked whenever a pointer is put in the cell.
+    /// @warning No more than 65535 threads may be in the middle of a Load on the same cell at once.
+    ///////////////////////////////////////////////////////////////////////////////
+    template<typename TypePointedTo>
+    class AtomicCountedPtr
+    {
+    public:
+        /// @brief The type of CountedPtr stored in this cell.
+        using PointerType = CountedPtr<TypePointedTo>;
+        /// @brief The type of the ReferenceCounter.
+        using RefCountType = typename PointerType::RefCountType;
+        /// @brief This makes referencing the type of the pointer object easier for external classes.
+        using ElementType = TypePointedTo;
+
+        static_assert( RefCountType::ThreadSafeCounting, "AtomicCountedPtr requires a thread-safe reference count." );
+        static_assert( sizeof(RefCountType*) <= sizeof(UInt64), "Pointers must fit in 64 bits." );
+    protected:
+        /// @brief The number of bits the counter pointer may use in the packed word.
+        static constexpr UInt64 PointerBits = 48;
+        /// @brief Masks the counter pointer out of the packed word.
+        static constexpr UInt64 PointerMask = ( UInt64(1) << PointerBits ) - 1;
+        /// @brief The value of one local reference in the packed word.
+        static constexpr UInt64 LocalOne = UInt64(1) << PointerBits;
+
+        /// @brief The counter pointer packed with the count of loads in progress.
+        std::atomic<UInt64> Cell;
+
+        /// @brief Packs a counter pointer into a word with no local references.
+        /// @exception Throws a Mezzanine::Exception::OutOfRangeCode if the address doesn't fit in 48 bits.
+        /// @param Counter The counter to pack.
+        /// @return A word suitable for storing in the Cell.
+        static UInt64 Pack(RefCountType* Counter)
+        {
+            const UInt64 Ret = reinterpret_cast<std::uintptr_t>(Counter);
+            if( ( Ret & ~PointerMask ) != 0 ) {
+                MEZZ_EXCEPTION(OutOfRangeCode, "Reference counter address does not fit in 48 bits.")
+            }
+            return Ret;
+        }
+        /// @brief Gets the counter pointer out of a packed word.
+        /// @param Word The packed word.
+        /// @return The counter pointer the word contains.
+        static RefCountType* UnpackPointer(const UInt64 Word) noexcept
+            { return reinterpret_cast<RefCountType*>( Word & PointerMask ); }
+        /// @brief Gets the count of local references out of a packed word.
+        /// @param Word The packed word.
+        /// @return The number of loads in progress.
+        static UInt16 UnpackLocal(const UInt64 Word) noexcept
+            { return static_cast<UInt16>( Word >> PointerBits ); }
+
+        /// @brief Wraps a counter this thread already holds a reference to in a CountedPtr.
+        /// @param Counter The counter to adopt, the reference is given to the returned pointer.
+        /// @return A CountedPtr owning the reference.
+        static PointerType Adopt(RefCountType* Counter) noexcept
+        {
+            PointerType Ret;
+            Ret.ReferenceCounter = Counter;
+            return Ret;
+        }
+        /// @brief Takes the reference out of a CountedPtr without releasing it.
+        /// @param Ptr The CountedPtr to empty.
+        /// @return The counter the reference belongs to.
+        static RefCountType* Detach(PointerType& Ptr) noexcept
+        {
+            RefCountType* Ret = Ptr.ReferenceCounter;
+            Ptr.ReferenceCounter = nullptr;
+            return Ret;
+        }
+
+        /// @brief Gives back the local reference taken at the start of a Load.
+        /// @param Counter The counter the Load observed.
+        void ReturnLocal(RefCountType* Counter) noexcept
+        {
+            UInt64 Expected = this->Cell.load(std::memory_order_relaxed);
+            while( UnpackPointer(Expected) == Counter && UnpackLocal(Expected) > 0 )
+            {
+                if( this->Cell.compare_exchange_weak(Expected,Expected - LocalOne,std::memory_order_release,
+                                                                                   std::memory_order_relaxed) )
+                {
+                    return;
+                }
+            }
+            // The cell was changed and the writer moved our local reference to the counter, drop the extra one.
+            if( Counter ) {
+                Counter->DecrementReferenceCount();
+            }
+        }
+
+        /// @brief Finishes replacing the counter in the cell.
+        /// @param Previous The word that was in the cell when it was replaced.
+        /// @return A CountedPtr holding the reference the cell had.
+        static PointerType RetireWord(const UInt64 Previous) noexcept
+        {
+            RefCountType* Counter = UnpackPointer(Previous);
+            const UInt16 Local = UnpackLocal(Previous);
+            if( Counter && Local > 0 ) {
+                Counter->IncrementReferenceCount(Local);
+            }
+            return Adopt(Counter);
+        }
+    public:
+        ///////////////////////////////////////////////////////////////////////////////
+        // Construction/Destruction
+
+        /// @brief Blank constructor, this holds nothing.
+        AtomicCountedPtr() noexcept
+            : Cell(0)
+            {}
+        /// @brief Initializing constructor.
+        /// @exception Throws a Mezzanine::Exception::OutOfRangeCode if the counter address doesn't fit in 48 bits.
+        /// @param Initial The pointer this will hold initially.
+        explicit AtomicCountedPtr(PointerType Initial)
+            : Cell( Pack(Initial.ReferenceCounter) )
+            { Detach(Initial); }
+        /// @brief Deleted copy constructor.
+        AtomicCountedPtr(const AtomicCountedPtr&) = delete;
+        /// @brief Deleted move constructor.
+        AtomicCountedPtr(AtomicCountedPtr&&) = delete;
+        /// @brief Destructor, releases the held pointer.
+        /// @warning No other thread may use this while it is being destroyed.
+        ~AtomicCountedPtr() noexcept
+            { RetireWord( this->Cell.load(std::memory_order_acquire) ); }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Operators
+
+        /// @brief Deleted copy assignment operator.
+        AtomicCountedPtr& operator=(const AtomicCountedPtr&) = delete;
+        /// @brief Deleted move assignment operator.
+        AtomicCountedPtr& operator=(AtomicCountedPtr&&) = delete;
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Atomic Operations
+
+        /// @brief Gets a CountedPtr to the object currently held.
+        /// @details This is lock-free, but may retry giving back its local count if other threads are using the cell.
+        /// @return A CountedPtr that shares ownership of the current object, or an empty one.
+        PointerType Load() noexcept
+        {
+            const UInt64 Word = this->Cell.fetch_add(LocalOne,std::memory_order_acquire);
+            RefCountType* Counter = UnpackPointer(Word);
+            if( Counter ) {
+                Counter->IncrementReferenceCount();
+            }
+            this->ReturnLocal(Counter);
+            return Adopt(Counter);
+        }
+
+        /// @brief Replaces the held object.
+        /// @exception Throws a Mezzanine::Exception::OutOfRangeCode if the counter address doesn't fit in 48 bits.
+        /// @param Desired The new pointer to hold.
+        void Store(PointerType Desired)
+            { this->Exchange( std::move(Desired) ); }
+
+        /// @brief Replaces the held object and returns the previous one.
+        /// @exception Throws a Mezzanine::Exception::OutOfRangeCode if the counter address doesn't fit in 48 bits.
+        /// @param Desired The new pointer to hold.
+        /// @return The pointer that was held before.
+        PointerType Exchange(PointerType Desired)
+        {
+            const UInt64 NewWord = Pack(Desired.ReferenceCounter);
+            Detach(Desired);
+            return RetireWord( this->Cell.exchange(NewWord,std::memory_order_acq_rel) );
+        }
+
+        /// @brief Replaces the held object, but only if it is the expected one.
+        /// @exception Throws a Mezzanine::Exception::OutOfRangeCode if the counter address doesn't fit in 48 bits.
+        /// @param Expected The object thought to be held. If it isn't this is updated to what is held.
+        /// @param Desired The new pointer to hold.
+        /// @return True if the exchange happened, false if Expected was updated instead.
+        Boole CompareExchange(PointerType& Expected, PointerType Desired)
+        {
+            const UInt64 NewWord = Pack( Desired.ReferenceCounter );
+            UInt64 Current = this->Cell.load(std::memory_order_relaxed);
+            while( UnpackPointer(Current) == Expected.ReferenceCounter )
+            {
+                if( this->Cell.compare_exchange_weak(Current,NewWord,std::memory_order_acq_rel,
+                                                                     std::memory_order_relaxed) )
+                {
+                    Detach(Desired);
+                    RetireWord(Current);
+                    return true;
+                }
+            }
+            Expected = this->Load();
+            return false;
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Query
+
+        /// @brief Checks whether the operations on this are lock-free on this platform.
+        /// @return True if the packed word is a lock-free atomic, false otherwise.
+        Boole IsLockFree() const noexcept
+            { return this->Cell.is_lock_free(); }
+    };//AtomicCountedPtr
+}//Mezzanine
+
+#endif // Mezz_Foundation_AtomicCountedPtr_h
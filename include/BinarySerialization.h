@@ -0,0 +1,866 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_BinarySerialization_h
+#define Mezz_Foundation_BinarySerialization_h
+
+/// @file
+/// @brief A compact binary archive format driven by the member tuples of the Introspection system.
+
+#ifndef SWIG
+    #include "BinaryBuffer.h"
+    #include "ContainerTools.h"
+    #include "Introspection.h"
+    #include "MezzException.h"
+    #include "MurmurHash.h"
+
+    #include <algorithm>
+    #include <cstring>
+    #include <vector>
+#endif
+
+namespace Mezzanine
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A growable byte sink that values are appended to when producing a binary archive.
+    /// @details All multi-byte values are written little-endian regardless of the host, so archives can be moved
+    /// between machines. Lengths and element counts are written as LEB128 style variable length integers, which
+    /// costs a single byte for anything below 128.
+    /// @n @n
+    /// The internal buffer grows geometrically. When writing is done @ref Finish will trim the buffer to the
+    /// exact size written and hand it off to a BinaryBuffer, preserving the no-speculative-allocation
+    /// guarantee of that class.
+    ///////////////////////////////////////
+    class MEZZ_LIB BinaryArchiveWriter
+    {
+    public:
+        /// @brief The type meant to indicate one byte in the archive.
+        using Byte = BinaryBuffer::Byte;
+    protected:
+        /// @brief The start of the buffer being written to.
+        Byte* Buffer = nullptr;
+        /// @brief The amount of bytes allocated for the buffer.
+        SizeType Capacity = 0;
+        /// @brief The amount of bytes written to the buffer.
+        SizeType Cursor = 0;
+
+        /// @brief Grows the internal buffer so at least the specified amount of bytes can be appended.
+        /// @param Extra The amount of bytes that need to fit after the current cursor.
+        void Grow(const SizeType Extra);
+    public:
+        /// @brief Class constructor.
+        /// @param InitialCapacity The amount of bytes to allocate up front.
+        explicit BinaryArchiveWriter(const SizeType InitialCapacity = 256);
+        /// @brief Deleted copy constructor.
+        BinaryArchiveWriter(const BinaryArchiveWriter&) = delete;
+        /// @brief Deleted move constructor.
+        BinaryArchiveWriter(BinaryArchiveWriter&&) = delete;
+        /// @brief Class destructor.
+        ~BinaryArchiveWriter();
+
+        /// @brief Deleted copy assignment operator.
+        BinaryArchiveWriter& operator=(const BinaryArchiveWriter&) = delete;
+        /// @brief Deleted move assignment operator.
+        BinaryArchiveWriter& operator=(BinaryArchiveWriter&&) = delete;
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Writing
+
+        /// @brief Makes sure the specified amount of bytes can be appended without another allocation.
+        /// @param Extra The amount of bytes that need to fit after the current cursor.
+        void Reserve(const SizeType Extra)
+        {
+            if( this->Cursor + Extra > this->Capacity ) {
+                this->Grow(Extra);
+            }
+        }
+        /// @brief Appends a range of bytes verbatim.
+        /// @param Source A pointer to the bytes to be appended.
+        /// @param Count The number of bytes to append.
+        void WriteBytes(const void* Source, const SizeType Count)
+        {
+            if( Count == 0 ) {
+                return;
+            }
+            this->Reserve(Count);
+            std::memcpy(this->Buffer + this->Cursor,Source,Count);
+            this->Cursor += Count;
+        }
+        /// @brief Appends an arithmetic or enum value in little-endian byte order.
+        /// @tparam ValueType The deduced type of value to write.
+        /// @param Value The value to be written.
+        template<typename ValueType>
+        void WriteRaw(const ValueType Value)
+        {
+            static_assert( std::is_arithmetic_v<ValueType> || std::is_enum_v<ValueType>,
+                           "Only arithmetic and enum values can be written raw." );
+            static_assert( sizeof(ValueType) == 1 || sizeof(ValueType) == 2 ||
+                           sizeof(ValueType) == 4 || sizeof(ValueType) == 8,
+                           "Only 1, 2, 4, or 8 byte values have a portable binary representation." );
+            using BitsType = std::conditional_t<sizeof(ValueType) == 1, UInt8,
+                             std::conditional_t<sizeof(ValueType) == 2, UInt16,
+                             std::conditional_t<sizeof(ValueType) == 4, UInt32, UInt64>>>;
+
+            BitsType Bits;
+            std::memcpy(&Bits,&Value,sizeof(BitsType));
+            this->Reserve(sizeof(BitsType));
+            Byte* Dest = this->Buffer + this->Cursor;
+            for( SizeType Idx = 0 ; Idx < sizeof(BitsType) ; ++Idx )
+            {
+                Dest[Idx] = static_cast<Byte>( Bits >> ( Idx * 8 ) );
+            }
+            this->Cursor += sizeof(BitsType);
+        }
+        /// @brief Appends an unsigned integer using a variable length encoding.
+        /// @param Value The value to be written.
+        void WriteVarUInt(UInt64 Value)
+        {
+            this->Reserve(10);
+            while( Value >= 0x80 )
+            {
+                this->Buffer[this->Cursor++] = static_cast<Byte>( Value | 0x80 );
+                Value >>= 7;
+            }
+            this->Buffer[this->Cursor++] = static_cast<Byte>( Value );
+        }
+        /// @brief Appends a length prefixed string.
+        /// @param Value The string to be written.
+        void WriteString(const StringView Value)
+        {
+            this->WriteVarUInt(Value.size());
+            this->WriteBytes(Value.data(),Value.size());
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Utility
+
+        /// @brief Gets the number of bytes written so far.
+        /// @return Returns the size of the archive produced so far.
+        SizeType GetSize() const noexcept
+            { return this->Cursor; }
+        /// @brief Gets the bytes written so far.
+        /// @return Returns a pointer to the start of the archive, which may be invalidated by further writes.
+        const Byte* GetData() const noexcept
+            { return this->Buffer; }
+        /// @brief Discards everything written so far while keeping the allocated buffer.
+        void Clear() noexcept
+            { this->Cursor = 0; }
+        /// @brief Moves the written archive into a BinaryBuffer.
+        /// @remarks This writer is left empty and can be reused afterwards.
+        /// @return Returns a BinaryBuffer owning exactly the bytes written.
+        BinaryBuffer Finish();
+    };//BinaryArchiveWriter
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A cursor over an existing byte range for reading values out of a binary archive.
+    /// @details This doesn't own the bytes it reads. Every read is bounds checked and reading beyond the end of
+    /// the range will throw a Mezzanine::Exception::OutOfRangeCode, so truncated or corrupt archives can't cause
+    /// reads outside the buffer.
+    ///////////////////////////////////////
+    class MEZZ_LIB BinaryArchiveReader
+    {
+    public:
+        /// @brief The type meant to indicate one byte in the archive.
+        using Byte = BinaryBuffer::Byte;
+    protected:
+        /// @brief The start of the archive being read.
+        const Byte* Data = nullptr;
+        /// @brief The total amount of bytes in the archive.
+        SizeType Size = 0;
+        /// @brief The amount of bytes that have been read.
+        SizeType Cursor = 0;
+
+        /// @brief Throws if fewer than the specified amount of bytes remain.
+        /// @param Count The number of bytes about to be read.
+        void Require(const SizeType Count) const
+        {
+            if( Count > this->Size - this->Cursor ) {
+                this->ThrowOverrun();
+            }
+        }
+    public:
+        /// @brief Range constructor.
+        /// @param Source A pointer to the start of the archive.
+        /// @param SourceSize The number of bytes in the archive.
+        BinaryArchiveReader(const Byte* Source, const SizeType SourceSize);
+        /// @brief Buffer constructor.
+        /// @param Source The buffer holding the archive.  It must outlive this reader.
+        explicit BinaryArchiveReader(const BinaryBuffer& Source);
+
+        /// @brief Throws the exception for reading past the end of the archive.
+        /// @exception Always throws a Mezzanine::Exception::OutOfRangeCode.
+        [[noreturn]] void ThrowOverrun() const;
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Reading
+
+        /// @brief Copies a range of bytes out of the archive verbatim.
+        /// @param Dest A pointer to where the bytes will be copied.
+        /// @param Count The number of bytes to copy.
+        void ReadBytes(void* Dest, const SizeType Count)
+        {
+            if( Count == 0 ) {
+                return;
+            }
+            this->Require(Count);
+            std::memcpy(Dest,this->Data + this->Cursor,Count);
+            this->Cursor += Count;
+        }
+        /// @brief Advances the cursor without reading anything.
+        /// @param Count The number of bytes to skip over.
+        void Skip(const SizeType Count)
+        {
+            this->Require(Count);
+            this->Cursor += Count;
+        }
+        /// @brief Reads an arithmetic or enum value that was written in little-endian byte order.
+        /// @tparam ValueType The type of value to read.
+        /// @return Returns the value read.
+        template<typename ValueType>
+        ValueType ReadRaw()
+        {
+            static_assert( std::is_arithmetic_v<ValueType> || std::is_enum_v<ValueType>,
+                           "Only arithmetic and enum values can be read raw." );
+            static_assert( sizeof(ValueType) == 1 || sizeof(ValueType) == 2 ||
+                           sizeof(ValueType) == 4 || sizeof(ValueType) == 8,
+                           "Only 1, 2, 4, or 8 byte values have a portable binary representation." );
+            using BitsType = std::conditional_t<sizeof(ValueType) == 1, UInt8,
+                             std::conditional_t<sizeof(ValueType) == 2, UInt16,
+                             std::conditional_t<sizeof(ValueType) == 4, UInt32, UInt64>>>;
+
+            this->Require(sizeof(BitsType));
+            const Byte* Source = this->Data + this->Cursor;
+            BitsType Bits = 0;
+            for( SizeType Idx = 0 ; Idx < sizeof(BitsType) ; ++Idx )
+            {
+                Bits = static_cast<BitsType>( Bits | ( static_cast<BitsType>( Source[Idx] ) << ( Idx * 8 ) ) );
+            }
+            this->Cursor += sizeof(BitsType);
+
+            if constexpr( std::is_same_v<ValueType,Boole> ) {
+                return Bits != 0;
+            }
+            ValueType Ret;
+            std::memcpy(&Ret,&Bits,sizeof(BitsType));
+            return Ret;
+        }
+        /// @brief Reads an unsigned integer that was written with a variable length encoding.
+        /// @exception Throws a Mezzanine::Exception::OutOfRangeCode if the encoding runs past the end of the
+        /// archive or is longer than a 64-bit value allows.
+        /// @return Returns the value read.
+        UInt64 ReadVarUInt()
+        {
+            UInt64 Ret = 0;
+            for( UInt32 Shift = 0 ; Shift < 64 ; Shift += 7 )
+            {
+                this->Require(1);
+                const Byte Current = this->Data[this->Cursor++];
+                Ret |= static_cast<UInt64>( Current & 0x7F ) << Shift;
+                if( ( Current & 0x80 ) == 0 ) {
+                    return Ret;
+                }
+            }
+            this->ThrowOverrun();
+        }
+        /// @brief Reads a length prefixed string without copying it.
+        /// @return Returns a view of the string inside the archive, valid for as long as the archive is.
+        StringView ReadStringView()
+        {
+            const UInt64 Length = this->ReadVarUInt();
+            this->Require(Length);
+            StringView Ret( reinterpret_cast<const char*>(this->Data + this->Cursor), Length );
+            this->Cursor += Length;
+            return Ret;
+        }
+        /// @brief Reads a length prefixed string.
+        /// @return Returns the string read.
+        String ReadString()
+        {
+            const UInt64 Length = this->ReadVarUInt();
+            this->Require(Length);
+            String Ret( reinterpret_cast<const char*>(this->Data + this->Cursor), Length );
+            this->Cursor += Length;
+            return Ret;
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Utility
+
+        /// @brief Gets the number of bytes that have not been read yet.
+        /// @return Returns the amount of bytes between the cursor and the end of the archive.
+        SizeType GetRemaining() const noexcept
+            { return this->Size - this->Cursor; }
+        /// @brief Gets the next byte that will be read.
+        /// @return Returns a pointer to the byte at the cursor.
+        const Byte* GetCurrent() const noexcept
+            { return this->Data + this->Cursor; }
+        /// @brief Gets the number of bytes read so far.
+        /// @return Returns the offset of the cursor from the start of the archive.
+        SizeType GetPosition() const noexcept
+            { return this->Cursor; }
+        /// @brief Checks to see if the entire archive has been read.
+        /// @return Returns true if no bytes remain to be read, false otherwise.
+        Boole IsAtEnd() const noexcept
+            { return this->Cursor == this->Size; }
+    };//BinaryArchiveReader
+
+    template<typename Class>
+    UInt64 GetSchemaFingerprint();
+
+    namespace BinarySerializationHelpers
+    {
+        /// @brief Checks to see if a type is written directly as little-endian bytes.
+        /// @tparam CheckType The type to check.
+        /// @return Returns true if CheckType is an arithmetic or enum type, false otherwise.
+        template<typename CheckType>
+        constexpr Boole IsRawValue()
+            { return std::is_arithmetic_v<CheckType> || std::is_enum_v<CheckType>; }
+
+        /// @brief Checks to see if a type is written as a length prefixed string.
+        /// @tparam CheckType The type to check.
+        /// @return Returns true if CheckType is a String, false otherwise.
+        template<typename CheckType>
+        constexpr Boole IsStringValue()
+            { return std::is_same_v<CheckType,String>; }
+
+        /// @brief Dummy/failure type for detecting an std::pair.
+        /// @tparam CheckType The type to check.
+        template<typename CheckType>
+        struct is_pair : std::false_type
+            {  };
+        /// @brief Success type for detecting an std::pair.
+        /// @tparam FirstType The type of the first element in the pair.
+        /// @tparam SecondType The type of the second element in the pair.
+        template<typename FirstType, typename SecondType>
+        struct is_pair< std::pair<FirstType,SecondType> > : std::true_type
+            {  };
+
+        /// @brief Checks to see if a registered member should be left out of binary archives.
+        /// @tparam AccessorType The MemberAccessor type of the member to check.
+        /// @return Returns true if the member is tagged Local or Generated, false otherwise.
+        template<typename AccessorType>
+        constexpr Boole IsSkippedMember()
+        {
+            constexpr MemberTags SkipMask = MemberTags::Local | MemberTags::Generated;
+            return ( AccessorType::GetTags() & SkipMask ) != MemberTags::None;
+        }
+
+        /// @brief Used to make a static_assert dependent on a template parameter.
+        /// @tparam Type The type the assert is being evaluated for.
+        template<typename Type>
+        constexpr Boole AlwaysFalse()
+            { return false; }
+
+        /// @brief Checks to see if raw values are stored in memory the same way they are stored in archives.
+        /// @return Returns true if the host is little-endian, false otherwise.
+        constexpr Boole HostIsLittleEndian()
+        {
+        #if defined(_WIN32) || ( defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ )
+            return true;
+        #else
+            return false;
+        #endif
+        }
+
+        /// @brief Convenience type for data function detection.
+        /// @tparam Class The class to test.
+        template<typename Class>
+        using DataFunct_t = decltype(std::declval<Class&>().data());
+        /// @brief Type for is_detected that tests for the existence of data on a class.
+        /// @tparam Class The class that will be checked for the presence of a data function.
+        template<typename Class>
+        using HasData_t = std::is_detected<DataFunct_t,Class>;
+
+        /// @brief Checks to see if a container's elements can be copied to or from an archive in one block.
+        /// @details This is true for contiguous containers of raw values other than Boole on little-endian
+        /// hosts, where the in memory representation is byte for byte the same as the archived one.
+        /// @tparam ContainerType The container type to check.
+        /// @return Returns true if the elements of ContainerType can be copied with a single memcpy.
+        template<typename ContainerType>
+        constexpr Boole IsBulkCopyable()
+        {
+            if constexpr( HasData_t<ContainerType>::value ) {
+                using ElementType = typename ContainerType::value_type;
+                return HostIsLittleEndian() &&
+                       IsRawValue<ElementType>() &&
+                       !std::is_same_v<ElementType,Boole> &&
+                       std::is_same_v<decltype(std::declval<ContainerType&>().data()),ElementType*>;
+            }else{
+                return false;
+            }
+        }
+
+        /// @brief The seed used for every hash making up a schema fingerprint.
+        static constexpr UInt32 SchemaSeed = 0x4D5A5346;
+
+        /// @brief Hashes a schema description for use in a schema fingerprint.
+        /// @details The description is written little-endian like any other archive, but MurmurHash reads each
+        /// 8 byte word of its 16 byte blocks in host byte order.  Big-endian hosts swap those words first so every
+        /// host hashes the same values and gets the same fingerprint.
+        /// @param Description The description of the schema to hash.
+        /// @return Returns the first 64 bits of a 128-bit Murmur hash of the description.
+        inline UInt64 HashSchemaDescription(const BinaryArchiveWriter& Description)
+        {
+            const SizeType Length = Description.GetSize();
+            if constexpr( HostIsLittleEndian() ) {
+                return Hashing::MurmurHash3_x64_128(Description.GetData(),Length,SchemaSeed).Hash[0];
+            }else{
+                std::vector<UInt8> Swapped(Description.GetData(),Description.GetData() + Length);
+                const SizeType WordCount = ( Length / 16 ) * 2;
+                for( SizeType WordIdx = 0 ; WordIdx < WordCount ; ++WordIdx )
+                    { std::reverse(Swapped.data() + ( WordIdx * 8 ),Swapped.data() + ( WordIdx * 8 ) + 8); }
+                return Hashing::MurmurHash3_x64_128(Swapped.data(),Length,SchemaSeed).Hash[0];
+            }
+        }
+
+        /// @brief Gets whether the schema fingerprint of a class is being computed on this thread.
+        /// @tparam Class The registered class to check.
+        /// @return Returns a reference to a flag that is true while the fingerprint of Class is being computed.
+        template<typename Class>
+        Boole& IsComputingSchema()
+        {
+            thread_local Boole Computing = false;
+            return Computing;
+        }
+
+        /// @brief Gets a fingerprint describing how a type is stored.
+        /// @details Raw values are described by their kind and size, Strings are all the same, registered
+        /// classes use their schema fingerprint and pairs and containers combine the fingerprints of their
+        /// elements.  Anything else is treated as an opaque block of bytes described by its size and alignment.
+        /// @exception Throws a Mezzanine::Exception::IntrospectionCode if ValueType contains a registered class
+        /// whose fingerprint is already being computed, meaning the class contains itself.
+        /// @tparam ValueType The type to describe.
+        /// @return Returns a 64-bit fingerprint of the type.
+        template<typename ValueType>
+        UInt64 GetTypeFingerprint()
+        {
+            using DecayedType = std::remove_cv_t<ValueType>;
+            BinaryArchiveWriter Descriptor(32);
+            if constexpr( IsRawValue<DecayedType>() ) {
+                const UInt8 Kind = ( std::is_same_v<DecayedType,Boole> ? 'b' :
+                                     std::is_enum_v<DecayedType> ? 'e' :
+                                     std::is_floating_point_v<DecayedType> ? 'f' :
+                                     std::is_signed_v<DecayedType> ? 'i' : 'u' );
+                Descriptor.WriteRaw(Kind);
+                Descriptor.WriteRaw( UInt8( sizeof(DecayedType) ) );
+            }else if constexpr( IsStringValue<DecayedType>() ) {
+                Descriptor.WriteRaw( UInt8('S') );
+            }else if constexpr( IsRegistered<DecayedType>() ) {
+                if( IsComputingSchema<DecayedType>() ) {
+                    MEZZ_EXCEPTION(IntrospectionCode, "Cannot fingerprint a registered class that contains itself.")
+                }
+                return GetSchemaFingerprint<DecayedType>();
+            }else if constexpr( is_pair<DecayedType>::value ) {
+                Descriptor.WriteRaw( UInt64('P') );
+                Descriptor.WriteRaw( GetTypeFingerprint<typename DecayedType::first_type>() );
+                Descriptor.WriteRaw( GetTypeFingerprint<typename DecayedType::second_type>() );
+            }else if constexpr( IsContainer<DecayedType>() ) {
+                Descriptor.WriteRaw( UInt64('C') );
+                Descriptor.WriteRaw( GetTypeFingerprint<typename DecayedType::value_type>() );
+            }else{
+                Descriptor.WriteRaw( UInt64('O') );
+                Descriptor.WriteRaw( UInt64( sizeof(DecayedType) ) );
+                Descriptor.WriteRaw( UInt64( alignof(DecayedType) ) );
+            }
+            return HashSchemaDescription(Descriptor);
+        }
+
+        /// @brief Computes the schema fingerprint of a registered class.
+        /// @exception Throws a Mezzanine::Exception::IntrospectionCode if the class contains itself.
+        /// @tparam Class The registered class to fingerprint.
+        /// @return Returns a hash of the class name and the name, tags and type fingerprint of every member.
+        template<typename Class>
+        UInt64 ComputeSchemaFingerprint()
+        {
+            // Flags the class for the duration, so a member containing it throws rather than recursing into the
+            // initialization of the static in GetSchemaFingerprint.
+            struct ComputingScope
+            {
+                Boole& Computing;
+                explicit ComputingScope(Boole& Flag) : Computing(Flag)
+                    { this->Computing = true; }
+                ~ComputingScope()
+                    { this->Computing = false; }
+            };
+            const ComputingScope Scope( IsComputingSchema<Class>() );
+
+            BinaryArchiveWriter Schema;
+            const StringView ClassName = GetRegisteredName<Class>();
+            Schema.WriteBytes(ClassName.data(),ClassName.size());
+            Schema.WriteRaw( UInt8(0) );
+            DoForAllMembers<Class>([&Schema](const auto& Member) {
+                using AccessorType = std::decay_t<decltype(Member)>;
+                const StringView Name = Member.GetName();
+                const UInt64 TypeFingerprint = GetTypeFingerprint<typename AccessorType::MemberType>();
+                const auto Tags = static_cast< std::underlying_type_t<MemberTags> >( AccessorType::GetTags() );
+
+                Schema.WriteBytes(Name.data(),Name.size());
+                Schema.WriteRaw( UInt8(0) );
+                Schema.WriteRaw(Tags);
+                Schema.WriteRaw(TypeFingerprint);
+            });
+            return HashSchemaDescription(Schema);
+        }
+
+        template<typename ValueType>
+        void WriteValue(BinaryArchiveWriter& Writer, const ValueType& Value);
+        template<typename ValueType>
+        void ReadValue(BinaryArchiveReader& Reader, ValueType& Value);
+
+        /// @brief Writes every non-skipped registered member of an object.
+        /// @tparam Class The registered class type being written.
+        /// @param Writer The archive to append to.
+        /// @param Object The object whose members will be written.
+        template<typename Class>
+        void WriteMembers(BinaryArchiveWriter& Writer, const Class& Object)
+        {
+            DoForAllMembers<Class>([&](const auto& Member) {
+                using AccessorType = std::decay_t<decltype(Member)>;
+                if constexpr( !IsSkippedMember<AccessorType>() ) {
+                    WriteValue(Writer,Member.GetValue(Object));
+                }
+            });
+        }
+
+        /// @brief Reads every non-skipped registered member of an object.
+        /// @tparam Class The registered class type being read.
+        /// @param Reader The archive to read from.
+        /// @param Object The object whose members will be assigned.
+        template<typename Class>
+        void ReadMembers(BinaryArchiveReader& Reader, Class& Object)
+        {
+            DoForAllMembers<Class>([&](const auto& Member) {
+                using AccessorType = std::decay_t<decltype(Member)>;
+                if constexpr( !IsSkippedMember<AccessorType>() ) {
+                    typename AccessorType::MemberType Value{};
+                    ReadValue(Reader,Value);
+                    Member.SetValue(Object,std::move(Value));
+                }
+            });
+        }
+
+        /// @brief Writes a single value of any supported type.
+        /// @tparam ValueType The deduced type of value to write.
+        /// @param Writer The archive to append to.
+        /// @param Value The value to be written.
+        template<typename ValueType>
+        void WriteValue(BinaryArchiveWriter& Writer, const ValueType& Value)
+        {
+            if constexpr( IsRawValue<ValueType>() ) {
+                Writer.WriteRaw(Value);
+            }else if constexpr( IsStringValue<ValueType>() ) {
+                Writer.WriteString(Value);
+            }else if constexpr( IsRegistered<ValueType>() ) {
+                WriteMembers(Writer,Value);
+            }else if constexpr( is_pair<ValueType>::value ) {
+                WriteValue(Writer,Value.first);
+                WriteValue(Writer,Value.second);
+            }else if constexpr( IsContainer<ValueType>() ) {
+                Writer.WriteVarUInt(Value.size());
+                if constexpr( IsBulkCopyable<ValueType>() ) {
+                    Writer.WriteBytes(Value.data(),Value.size() * sizeof(typename ValueType::value_type));
+                }else{
+                    for( const auto& Element : Value )
+                        { WriteValue(Writer,Element); }
+                }
+            }else{
+                static_assert( AlwaysFalse<ValueType>(), "Type cannot be written to a binary archive." );
+            }
+        }
+
+        /// @brief Reads a single value of any supported type.
+        /// @remarks Containers are cleared before their elements are read.
+        /// @tparam ValueType The deduced type of value to read.
+        /// @param Reader The archive to read from.
+        /// @param Value The value to be assigned.
+        template<typename ValueType>
+        void ReadValue(BinaryArchiveReader& Reader, ValueType& Value)
+        {
+            if constexpr( IsRawValue<ValueType>() ) {
+                Value = Reader.ReadRaw<ValueType>();
+            }else if constexpr( IsStringValue<ValueType>() ) {
+                Value = Reader.ReadString();
+            }else if constexpr( IsRegistered<ValueType>() ) {
+                ReadMembers(Reader,Value);
+            }else if constexpr( is_pair<ValueType>::value ) {
+                ReadValue(Reader,Value.first);
+                ReadValue(Reader,Value.second);
+            }else if constexpr( IsContainer<ValueType>() ) {
+                const UInt64 Count = Reader.ReadVarUInt();
+                Value.clear();
+                if constexpr( IsBulkCopyable<ValueType>() && ContainerDetect::HasResize<ValueType>() ) {
+                    using ElementType = typename ValueType::value_type;
+                    if( Count > Reader.GetRemaining() / sizeof(ElementType) ) {
+                        Reader.ThrowOverrun();
+                    }
+                    Value.resize( static_cast<SizeType>(Count) );
+                    Reader.ReadBytes(Value.data(),Value.size() * sizeof(ElementType));
+                }else{
+                    if constexpr( ContainerDetect::HasReserve<ValueType>() ) {
+                        // Bound the reservation by what remains so a corrupt count can't trigger a huge allocation.
+                        Value.reserve( std::min<UInt64>(Count,Reader.GetRemaining()) );
+                    }
+                    for( UInt64 Idx = 0 ; Idx < Count ; ++Idx )
+                    {
+                        if constexpr( IsAssociativeContainer<ValueType>() ) {
+                            typename ValueType::key_type Key{};
+                            typename ValueType::mapped_type Mapped{};
+                            ReadValue(Reader,Key);
+                            ReadValue(Reader,Mapped);
+                            AddToContainer(Value,std::move(Key),std::move(Mapped));
+                        }else{
+                            typename ValueType::value_type Element{};
+                            ReadValue(Reader,Element);
+                            AddToContainer(Value,std::move(Element));
+                        }
+                    }
+                }
+            }else{
+                static_assert( AlwaysFalse<ValueType>(), "Type cannot be read from a binary archive." );
+            }
+        }
+
+        /// @brief Assigns a single named member from an archived value, if the member still exists unchanged.
+        /// @tparam Class The registered class type being migrated to.
+        /// @param ValueReader A reader over exactly the archived bytes of the member value.
+        /// @param Object The object to be assigned.
+        /// @param Name The name the member was archived with.
+        /// @param TypeFingerprint The fingerprint of the type the member was archived with.
+        template<typename Class>
+        void MigrateMember(BinaryArchiveReader& ValueReader, Class& Object, const StringView Name,
+                           const UInt64 TypeFingerprint)
+        {
+            auto Migrate = [&](const auto& Member) {
+                using AccessorType = std::decay_t<decltype(Member)>;
+                using MemberType = typename AccessorType::MemberType;
+                if constexpr( !IsSkippedMember<AccessorType>() ) {
+                    if( GetTypeFingerprint<MemberType>() == TypeFingerprint ) {
+                        MemberType Value{};
+                        ReadValue(ValueReader,Value);
+                        Member.SetValue(Object,std::move(Value));
+                    }
+                }
+            };
+            IntrospectionHelpers::DoForNamedMember<Class>(Name,Migrate);
+        }
+    }//BinarySerializationHelpers
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Binary Serialization
+
+    /// @brief Appends an object to a binary archive.
+    /// @details Registered classes are walked member by member in registration order. Members tagged Local or
+    /// Generated are skipped entirely. Arithmetic and enum values are written raw, Strings and containers
+    /// are prefixed with their length, and registered member types are written recursively. No names or type
+    /// information are written, so the archive can only be read back with the same member registration.
+    /// @tparam Class The deduced type of object being serialized.
+    /// @param Writer The archive to append to.
+    /// @param Object The object to be serialized.
+    template<typename Class>
+    void SerializeBinary(BinaryArchiveWriter& Writer, const Class& Object)
+        { BinarySerializationHelpers::WriteValue(Writer,Object); }
+
+    /// @brief Serializes an object into a new binary archive.
+    /// @tparam Class The deduced type of object being serialized.
+    /// @param Object The object to be serialized.
+    /// @return Returns a BinaryBuffer containing the serialized object.
+    template<typename Class>
+    BinaryBuffer SerializeBinary(const Class& Object)
+    {
+        BinaryArchiveWriter Writer;
+        SerializeBinary(Writer,Object);
+        return Writer.Finish();
+    }
+
+    /// @brief Reads the next object from a binary archive.
+    /// @remarks Members that were skipped during serialization are left untouched on the object.
+    /// @exception Throws a Mezzanine::Exception::OutOfRangeCode if the archive ends before the object does.
+    /// @tparam Class The deduced type of object being deserialized.
+    /// @param Reader The archive to read from.
+    /// @param Object The object to be assigned.
+    template<typename Class>
+    void DeserializeBinary(BinaryArchiveReader& Reader, Class& Object)
+        { BinarySerializationHelpers::ReadValue(Reader,Object); }
+
+    /// @brief Deserializes an object from a buffer containing a binary archive.
+    /// @exception Throws a Mezzanine::Exception::OutOfRangeCode if the archive ends before the object does.
+    /// @tparam Class The deduced type of object being deserialized.
+    /// @param Source The buffer containing the serialized object.
+    /// @param Object The object to be assigned.
+    template<typename Class>
+    void DeserializeBinary(const BinaryBuffer& Source, Class& Object)
+    {
+        BinaryArchiveReader Reader(Source);
+        DeserializeBinary(Reader,Object);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Versioned Binary Serialization
+
+    /// @brief Gets a fingerprint of the registered schema of a class.
+    /// @details The fingerprint is a Murmur hash of the registered class name and the name, tags and type of every
+    /// registered member, in registration order.  Types of registered members contribute their own fingerprint, so
+    /// a change anywhere in a nested schema changes the fingerprint of every class containing it.  It is
+    /// computed the first time it's needed for each class, since RegisterMembers isn't required to be
+    /// constexpr, and is cached after that.
+    /// @n @n
+    /// Classes that contain themselves, directly or through containers, cannot be fingerprinted and throw instead.
+    /// The schema is described with the same little-endian encoding used for values, so every host produces the
+    /// same fingerprint for the same schema.
+    /// @exception Throws a Mezzanine::Exception::IntrospectionCode if the class contains itself.
+    /// @tparam Class The registered class to fingerprint.
+    /// @return Returns a 64-bit fingerprint of the class schema.
+    template<typename Class>
+    UInt64 GetSchemaFingerprint()
+    {
+        static const UInt64 Fingerprint = BinarySerializationHelpers::ComputeSchemaFingerprint<Class>();
+        return Fingerprint;
+    }
+
+    /// @brief Appends an object to a binary archive along with enough schema information to migrate it later.
+    /// @details The object is preceded by the schema fingerprint of its class and a table with the name, type
+    /// fingerprint and encoded length of every member that was written.  The member values that follow are
+    /// encoded exactly as @ref SerializeBinary encodes them.
+    /// @tparam Class The deduced type of object being serialized.
+    /// @param Writer The archive to append to.
+    /// @param Object The object to be serialized.
+    template<typename Class>
+    void SerializeBinaryVersioned(BinaryArchiveWriter& Writer, const Class& Object)
+    {
+        static_assert( IsRegistered<Class>(), "Only registered classes can be serialized with a schema." );
+        using namespace BinarySerializationHelpers;
+
+        UInt64 EntryCount = 0;
+        DoForAllMembers<Class>([&EntryCount](const auto& Member) {
+            EntryCount += !IsSkippedMember< std::decay_t<decltype(Member)> >();
+        });
+
+        BinaryArchiveWriter Contents(64);
+        BinaryArchiveWriter Payload;
+        Contents.WriteVarUInt(EntryCount);
+        DoForAllMembers<Class>([&](const auto& Member) {
+            using AccessorType = std::decay_t<decltype(Member)>;
+            if constexpr( !IsSkippedMember<AccessorType>() ) {
+                const SizeType Start = Payload.GetSize();
+                WriteValue(Payload,Member.GetValue(Object));
+                Contents.WriteString( Member.GetName() );
+                Contents.WriteRaw( GetTypeFingerprint<typename AccessorType::MemberType>() );
+                Contents.WriteVarUInt( Payload.GetSize() - Start );
+            }
+        });
+
+        Writer.WriteRaw( GetSchemaFingerprint<Class>() );
+        Writer.WriteVarUInt( Contents.GetSize() );
+        Writer.WriteBytes( Contents.GetData(), Contents.GetSize() );
+        Writer.WriteBytes( Payload.GetData(), Payload.GetSize() );
+    }
+
+    /// @brief Serializes an object into a new binary archive along with enough schema information to migrate it.
+    /// @tparam Class The deduced type of object being serialized.
+    /// @param Object The object to be serialized.
+    /// @return Returns a BinaryBuffer containing the serialized object.
+    template<typename Class>
+    BinaryBuffer SerializeBinaryVersioned(const Class& Object)
+    {
+        BinaryArchiveWriter Writer;
+        SerializeBinaryVersioned(Writer,Object);
+        return Writer.Finish();
+    }
+
+    /// @brief Reads the next object from a binary archive written by @ref SerializeBinaryVersioned.
+    /// @details If the archived schema fingerprint matches the fingerprint of Class the member table is skipped
+    /// and the members are decoded in order with no lookups, the same as @ref DeserializeBinary.  Otherwise each
+    /// archived member is matched to a registered member by name and is only assigned if the type of the
+    /// member is unchanged.  Members that were renamed, removed or changed type are skipped and members
+    /// that weren't archived are left untouched.
+    /// @exception Throws a Mezzanine::Exception::OutOfRangeCode if the archive ends before the object does.
+    /// @tparam Class The deduced type of object being deserialized.
+    /// @param Reader The archive to read from.
+    /// @param Object The object to be assigned.
+    /// @return Returns true if the schema matched, or false if the object had to be migrated.
+    template<typename Class>
+    Boole DeserializeBinaryVersioned(BinaryArchiveReader& Reader, Class& Object)
+    {
+        static_assert( IsRegistered<Class>(), "Only registered classes can be deserialized with a schema." );
+        using namespace BinarySerializationHelpers;
+
+        const UInt64 Fingerprint = Reader.ReadRaw<UInt64>();
+        const UInt64 ContentsSize = Reader.ReadVarUInt();
+        if( Fingerprint == GetSchemaFingerprint<Class>() ) {
+            Reader.Skip(ContentsSize);
+            ReadMembers(Reader,Object);
+            return true;
+        }
+
+        if( ContentsSize > Reader.GetRemaining() ) {
+            Reader.ThrowOverrun();
+        }
+        BinaryArchiveReader Contents(Reader.GetCurrent(),ContentsSize);
+        Reader.Skip(ContentsSize);
+        const UInt64 EntryCount = Contents.ReadVarUInt();
+        for( UInt64 EntryIdx = 0 ; EntryIdx < EntryCount ; ++EntryIdx )
+        {
+            const StringView Name = Contents.ReadStringView();
+            const UInt64 TypeFingerprint = Contents.ReadRaw<UInt64>();
+            const UInt64 ValueSize = Contents.ReadVarUInt();
+            if( ValueSize > Reader.GetRemaining() ) {
+                Reader.ThrowOverrun();
+            }
+            BinaryArchiveReader ValueReader(Reader.GetCurrent(),ValueSize);
+            Reader.Skip(ValueSize);
+            MigrateMember(ValueReader,Object,Name,TypeFingerprint);
+        }
+        return false;
+    }
+
+    /// @brief Deserializes an object from a buffer written by @ref SerializeBinaryVersioned.
+    /// @exception Throws a Mezzanine::Exception::OutOfRangeCode if the archive ends before the object does.
+    /// @tparam Class The deduced type of object being deserialized.
+    /// @param Source The buffer containing the serialized object.
+    /// @param Object The object to be assigned.
+    /// @return Returns true if the schema matched, or false if the object had to be migrated.
+    template<typename Class>
+    Boole DeserializeBinaryVersioned(const BinaryBuffer& Source, Class& Object)
+    {
+        BinaryArchiveReader Reader(Source);
+        return DeserializeBinaryVersioned(Reader,Object);
+    }
+}//Mezzanine
+
+#endif
@@ -45,6 +45,11 @@
 
 #ifndef SWIG
     #include "DataTypes.h"
+    #include "DetectionTraits.h"
+    #include "SizeClassPool.h"
+
+    #include <type_traits>
+    #include <utility>
 #endif
 
 namespace Mezzanine
@@ -77,6 +82,12 @@ namespace Mezzanine
     /// The pointer itself.
     template<typename TypePointedTo> class CountedPtr;
 
+    /// The non-owning companion of the pointer.
+    template<typename TypePointedTo> class WeakCountedPtr;
+
+    /// The atomic cell that can hold the pointer.
+    template<typename TypePointedTo> class AtomicCountedPtr;
+
     /// Externally callable casts.
     template<typename ReturnType, typename OtherPointerTargetType>
     CountedPtr<ReturnType> CountedPtrCast(CountedPtr<OtherPointerTargetType>& Original);
@@ -115,30 +126,38 @@ namespace Mezzanine
     ///////////////////////////////////////////////////////////////////////////////
     /// @brief Counter that exists once per object managed by a group of shared pointers to track items in memory.
     /// @tparam TypePointedTo The type of object the pointers will point to.
-    /// @details This exists to track the pointers to the managed object, and stores the single
-    /// counter of existing references. Only one of these should be created for each group of
-    /// pointers managing the same object.
+    /// @details This exists to track the pointers to the managed object, and stores the counter of existing
+    /// references and the counter of existing weak references. Only one of these should be created for each group
+    /// of pointers managing the same object.
+    /// @n @n
+    /// The managed object is destroyed when the last strong reference is released, but this counter is only
+    /// destroyed once the last weak reference is also gone. All of the strong references together hold one weak
+    /// reference, this keeps the counter alive while the managed object is being destroyed and means only the
+    /// weak count needs to be checked to know when this can be deleted.
     /// @note It should be extremely rare to need to create one of these outside of pointer implementation.
     ///////////////////////////////////////////////////////////////////////////////
     template<typename TypePointedTo>
     class ReferenceCount
     {
-    private:
+    protected:
         /// @brief  The raw pointer that is the core of this smart pointer.
         TypePointedTo* Target;
-
+    private:
         /// @brief This is the counter that stores how many references exist.
         Whole RefCount;
 
+        /// @brief This is the counter that stores how many weak references exist, plus one for all the strong ones.
+        Whole WeakRefCount;
+
     public:
         /// @brief Constructor.
         /// @param InitialPointer A pointer to the type of this template. This defaults to nullptr if not provided.
         /// @param InitialCount The number of references to default to this defaults to 0 if not provided.
         ReferenceCount(TypePointedTo* InitialPointer = nullptr, Whole InitialCount = 0)
-            : Target(InitialPointer), RefCount(InitialCount)
+            : Target(InitialPointer), RefCount(InitialCount), WeakRefCount(1)
             {}
 
-        /// @brief Destructor, cleans up the object when the last reference deletes this.
+        /// @brief Destructor, cleans up the object if it wasn't already destroyed when the last reference deletes this.
         virtual ~ReferenceCount()
             { delete Target; }
 
@@ -147,11 +166,36 @@ namespace Mezzanine
         Whole IncrementReferenceCount()
             { return ++RefCount; }
 
+        /// @brief Increase the reference count by one, but only if the managed object still exists.
+        /// @details This is how a WeakCountedPtr is promoted to a CountedPtr.
+        /// @return The updated count, or 0 if the managed object has already been destroyed.
+        Whole IncrementReferenceCountIfNonZero()
+            { return RefCount ? ++RefCount : 0; }
+
         /// @brief Decrease the reference count by one and return the updated count.
         /// @return The updated count.
         Whole DecrementReferenceCount()
             { return --RefCount; }
 
+        /// @brief Increase the weak reference count by one and return the updated count.
+        /// @return The updated count.
+        Whole IncrementWeakReferenceCount()
+            { return ++WeakRefCount; }
+
+        /// @brief Decrease the weak reference count by one and return the updated count.
+        /// @return The updated count, when this is 0 this counter can be deleted.
+        Whole DecrementWeakReferenceCount()
+            { return --WeakRefCount; }
+
+        /// @brief Destroys the managed object without destroying this counter.
+        /// @details This is called when the last strong reference is released. Counters that need to clean up the
+        /// target some other way than delete can override this.
+        virtual void DestroyTarget()
+        {
+            delete Target;
+            Target = nullptr;
+        }
+
         /// @brief Gets the actual pointer to the target.
         /// @return A pointer of the targeted type to the object being managed.
         TypePointedTo* GetReferenceCountTargetAsPointer()
@@ -162,6 +206,11 @@ namespace Mezzanine
         Whole GetReferenceCount()
             { return RefCount; }
 
+        /// @brief Get the current amount of weak references.
+        /// @return A Whole with the current weak reference count, not including the one held by strong references.
+        Whole GetWeakReferenceCount()
+            { return RefCount ? WeakRefCount - 1 : WeakRefCount; }
+
         /// @brief Get a pointer to the target as the most derived type in of this object.
         /// @return A pointer, for use with CountedPtrCast.
         virtual TypePointedTo* GetMostDerived()
@@ -256,6 +305,117 @@ namespace Mezzanine
         enum { IsCastable = CastStatic };
     };
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A reference counter that recycles its own memory through a SizeClassPool.
+    /// @details Reference counters are small, all the same size for a given type and are created and destroyed
+    /// every time a CountedPtr group is. This wraps another reference counter type and gives it class specific
+    /// allocation functions, so creating and destroying it takes a block from the free-list of the current thread
+    /// instead of calling the general purpose allocator. Everything else is inherited unchanged.
+    /// @n @n
+    /// This is selected through ReferenceCountTraits, the simplest way is to derive the specialization from
+    /// PooledReferenceCountTraits.
+    /// @tparam CountType The reference counter to pool, this defaults to ReferenceCount<T> in the traits.
+    ///////////////////////////////////////////////////////////////////////////////
+    template<typename CountType>
+    class PooledReferenceCount : public CountType
+    {
+    public:
+        /// @brief The pool blocks of this counter are kept in.
+        using PoolType = SizeClassPool<sizeof(CountType),alignof(CountType)>;
+
+        /// @brief All constructors of the pooled counter are used unchanged.
+        using CountType::CountType;
+
+        /// @brief Class specific allocation function.
+        /// @param Size The size of the object being created.
+        /// @return A pointer to uninitialized storage for the counter.
+        static void* operator new(std::size_t Size)
+        {
+            if( Size != sizeof(CountType) ) {
+                return ::operator new(Size);
+            }
+            return PoolType::Allocate();
+        }
+
+        /// @brief Class specific deallocation function.
+        /// @param Block The memory the destroyed counter occupied.
+        /// @param Size The size of the object that was destroyed.
+        static void operator delete(void* Block, std::size_t Size) noexcept
+        {
+            if( Size != sizeof(CountType) ) {
+                ::operator delete(Block);
+            }else{
+                PoolType::Deallocate(Block);
+            }
+        }
+    };//PooledReferenceCount
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief ReferenceCountTraits for a type that should use pooled external reference counters.
+    /// @details To have CountedPtr use pooled counters for a type specialize ReferenceCountTraits for it and
+    /// inherit from this, for example:
+    /// @code
+    /// template<>
+    /// class ReferenceCountTraits<Foo> : public PooledReferenceCountTraits<Foo>
+    ///     {};
+    /// @endcode
+    /// @tparam T The type CountedPtr will point to.
+    template<typename T>
+    class PooledReferenceCountTraits
+    {
+    public:
+        /// @brief This is type of the ReferenceCounter, a pooled version of the default.
+        using RefCountType = PooledReferenceCount< ReferenceCount<T> >;
+
+        /// @brief This will return a pointer to the reference count.
+        /// @param Target A pointer to the freshly created object.
+        /// @return This will return a pointer to a valid reference counter allocated from the pool.
+        static RefCountType* ConstructionPointer(T* Target)
+            { return new RefCountType(Target); }
+
+        /// @brief Used to determine if the data a CountedPtr is managing can be cast.
+        enum { IsCastable = CastStatic };
+    };//PooledReferenceCountTraits
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A reference counter that cleans up its target with a custom deleter instead of delete.
+    /// @details This allows objects that were not created with new, such as those placed in arenas, pools or
+    /// memory mapped regions, to be managed by CountedPtr. This is created by the CountedPtr constructor that
+    /// accepts a deleter and should rarely need to be used directly.
+    /// @tparam CountType The reference counter to extend, usually ReferenceCountTraits<T>::RefCountType.
+    /// @tparam DeleterType A callable type that accepts a pointer to the target, it is stored by value.
+    ///////////////////////////////////////////////////////////////////////////////
+    template<typename CountType, typename DeleterType>
+    class ReferenceCountWithDeleter : public CountType
+    {
+    protected:
+        /// @brief The callable used to clean up the target.
+        DeleterType Deleter;
+    public:
+        /// @brief The type of object the pointers will point to.
+        using TargetType = std::remove_pointer_t<decltype( std::declval<CountType&>().GetReferenceCountTargetAsPointer() )>;
+
+        /// @brief Constructor.
+        /// @param InitialPointer The object to manage.
+        /// @param CustomDeleter The callable that will be passed InitialPointer when it needs to be cleaned up.
+        ReferenceCountWithDeleter(TargetType* InitialPointer, DeleterType CustomDeleter)
+            : CountType(InitialPointer), Deleter(std::move(CustomDeleter))
+            {}
+
+        /// @brief Destructor, cleans up the object with the deleter if it wasn't already.
+        virtual ~ReferenceCountWithDeleter()
+            { this->ReferenceCountWithDeleter::DestroyTarget(); }
+
+        /// @brief Destroys the managed object with the deleter without destroying this counter.
+        virtual void DestroyTarget() override
+        {
+            if( this->Target != nullptr ) {
+                this->Deleter(this->Target);
+                this->Target = nullptr;
+            }
+        }
+    };//ReferenceCountWithDeleter
+
     /*
     /// @brief An Example ReferenceCountTraits implementation.
     /// @pre Any class can be used as a reference counter if it provides the following: @n
@@ -289,6 +449,16 @@ namespace Mezzanine
     /// and external reference counting different.
     namespace ReferenceCountAdjustment
     {
+        /// @brief Used to detect the weak reference count interface on a reference counter.
+        template<typename CounterType>
+        using DecrementWeakReferenceCount_t = decltype( std::declval<CounterType&>().DecrementWeakReferenceCount() );
+        /// @brief Convenience type for is_detected that tests if a reference counter tracks weak references.
+        /// @details Reference counters that track weak references destroy the managed object separately from
+        /// themselves, which is required for use with a WeakCountedPtr. Intrusive reference counts are the managed
+        /// object and cannot do this.
+        template<typename CounterType>
+        using SupportsWeakReferences = std::is_detected<DecrementWeakReferenceCount_t,CounterType>;
+
         /// @brief This handles the case of needing to adjust the reference count of covariant pointers.
         /// All covariant pointers must use internal reference counts.
         /// @tparam CurrentReferenceCountType The current type of the reference counter to change.
@@ -356,6 +526,12 @@ namespace Mezzanine
         template<typename ReturnType, typename OtherPointerTargetType>
         friend CountedPtr<ReturnType> CountedPtrStaticCast(CountedPtr<OtherPointerTargetType>& Original);
 
+        /// @brief Weak pointers need to share the ReferenceCounter and create strong pointers from it.
+        friend class WeakCountedPtr<TypePointedTo>;
+
+        /// @brief Atomic cells need to take and hand out references to the ReferenceCounter.
+        friend class AtomicCountedPtr<TypePointedTo>;
+
     protected:
         /// @brief This is the only data on this class, a pointer to the counter and the managed object.
         RefCountType* ReferenceCounter;
@@ -382,12 +558,20 @@ namespace Mezzanine
 
         /// @brief This decrements the reference count and deletes the managed items if there are none remaining.
         /// @note Deleting a ReferenceCount should clean up the target object in its destructor, if we are deleting
-        /// something intrusively reference counted this does.
+        /// something intrusively reference counted this does. If the counter tracks weak references the target is
+        /// destroyed immediately, but the counter is kept until no WeakCountedPtr refers to it.
         void Release() noexcept
         {
             if( ReferenceCounter ) {
                 if( ReferenceCounter->DecrementReferenceCount() == 0 ) {
-                    delete ReferenceCounter;
+                    if constexpr( ReferenceCountAdjustment::SupportsWeakReferences<RefCountType>::value ) {
+                        ReferenceCounter->DestroyTarget();
+                        if( ReferenceCounter->DecrementWeakReferenceCount() == 0 ) {
+                            delete ReferenceCounter;
+                        }
+                    }else{
+                        delete ReferenceCounter;
+                    }
                     ReferenceCounter = nullptr;
                 }
             }
@@ -413,6 +597,32 @@ namespace Mezzanine
             else
                 { ReferenceCounter = nullptr; }
         }
+        /// @brief Custom deleter constructor.
+        /// @details This works like the initializing constructor, but rather than deleting the target once all the
+        /// pointers of this group disappear the deleter is called with it. This is only available with external
+        /// reference counts that track weak references, like the default ReferenceCount.
+        /// @tparam DeleterType A callable type that accepts a TypePointedTo*, it is stored by value.
+        /// @param PointerTarget The item that will be passed to the deleter once all the pointers of this group
+        /// disappear. If this is nullptr the pointer is empty and the deleter is never called.
+        /// @param Deleter The callable that will clean up PointerTarget.
+        /// @exception If allocating the reference counter throws the deleter is called before rethrowing.
+        template<typename DeleterType>
+        CountedPtr(TypePointedTo* PointerTarget, DeleterType Deleter)
+            : ReferenceCounter(nullptr)
+        {
+            static_assert( ReferenceCountAdjustment::SupportsWeakReferences<RefCountType>::value,
+                           "Custom deleters require an external reference count that tracks weak references." );
+            if( PointerTarget ) {
+                RefCountType* Counter = nullptr;
+                try {
+                    Counter = new ReferenceCountWithDeleter<RefCountType,DeleterType>(PointerTarget,Deleter);
+                }catch(...){
+                    Deleter(PointerTarget);
+                    throw;
+                }
+                Acquire(Counter);
+            }
+        }
         /// @brief Copy constructor.
         /// @param Original The pointer being copied. This fresh pointer will use the same ReferenceCounter
         /// as the original.
@@ -541,6 +751,278 @@ namespace Mezzanine
             { return ReferenceCounter; }
     };
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A non-owning reference to an object managed by a group of CountedPtr instances.
+    /// @details This observes the object without keeping it alive, which makes it useful for breaking reference
+    /// cycles and for caches. To use the object a CountedPtr must be acquired with Lock(), which will be empty if
+    /// the object was destroyed in the meantime.
+    /// @n @n
+    /// The object is destroyed as soon as the last CountedPtr releases it, but the ReferenceCount is kept alive
+    /// until the last WeakCountedPtr releases it as well. Because of this only reference counters that track weak
+    /// references (like the default ReferenceCount) can be used, intrusive reference counts cannot outlive their
+    /// object and will fail to compile.
+    /// @tparam TypePointedTo The target type the pointers are pointing to.
+    /// @warning This is not thread safe by default, just like CountedPtr.
+    ///////////////////////////////////////////////////////////////////////////////
+    template<typename TypePointedTo>
+    class WeakCountedPtr
+    {
+    public:
+        /// @brief The type of the ReferenceCounter.
+        using RefCountType = typename CountedPtr<TypePointedTo>::RefCountType;
+        /// @brief This makes referencing the type of the pointer object easier for external classes.
+        using ElementType = TypePointedTo;
+
+        static_assert( ReferenceCountAdjustment::SupportsWeakReferences<RefCountType>::value,
+                       "WeakCountedPtr requires a reference counter that tracks weak references." );
+    protected:
+        /// @brief This is the only data on this class, a pointer to the counter shared with the CountedPtr group.
+        RefCountType* ReferenceCounter;
+
+        /// @brief Have this pointer observe the same thing another pointer uses.
+        /// @param CounterToAcquire The ReferenceCounter that this pointer will use.
+        /// @warning This does not release the previous ReferenceCounter.
+        void Acquire(RefCountType* CounterToAcquire) noexcept
+        {
+            this->ReferenceCounter = CounterToAcquire;
+            if( this->ReferenceCounter ) {
+                this->ReferenceCounter->IncrementWeakReferenceCount();
+            }
+        }
+
+        /// @brief This decrements the weak reference count and deletes the counter if nothing else uses it.
+        void Release() noexcept
+        {
+            if( this->ReferenceCounter ) {
+                if( this->ReferenceCounter->DecrementWeakReferenceCount() == 0 ) {
+                    delete this->ReferenceCounter;
+                }
+                this->ReferenceCounter = nullptr;
+            }
+        }
+    public:
+        ///////////////////////////////////////////////////////////////////////////////
+        // Construction/Destruction
+
+        /// @brief Blank constructor, this observes nothing.
+        WeakCountedPtr() noexcept
+            : ReferenceCounter(nullptr)
+            {}
+        /// @brief Observing constructor.
+        /// @param Original The CountedPtr whose managed object this will observe.
+        WeakCountedPtr(const CountedPtr<TypePointedTo>& Original) noexcept
+            { this->Acquire( Original.ReferenceCounter ); }
+        /// @brief Copy constructor.
+        /// @param Original The weak pointer being copied.
+        WeakCountedPtr(const WeakCountedPtr& Original) noexcept
+            { this->Acquire( Original.ReferenceCounter ); }
+        /// @brief Move constructor.
+        /// @param Original The weak pointer being moved without incrementing the weak reference count.
+        WeakCountedPtr(WeakCountedPtr&& Original) noexcept
+            : ReferenceCounter(Original.ReferenceCounter)
+            { Original.ReferenceCounter = nullptr; }
+        /// @brief Destructor, just calls Release().
+        ~WeakCountedPtr() noexcept
+            { this->Release(); }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Operators
+
+        /// @brief Copy assignment operator.
+        /// @param Other The weak pointer to observe the target of.
+        /// @return A reference to this.
+        WeakCountedPtr& operator=(const WeakCountedPtr& Other) noexcept
+        {
+            if( this != &Other ) {
+                this->Release();
+                this->Acquire( Other.ReferenceCounter );
+            }
+            return *this;
+        }
+        /// @brief Move assignment operator.
+        /// @param Other The weak pointer to take the target of.
+        /// @return A reference to this.
+        WeakCountedPtr& operator=(WeakCountedPtr&& Other) noexcept
+        {
+            if( this != &Other ) {
+                this->Release();
+                this->ReferenceCounter = Other.ReferenceCounter;
+                Other.ReferenceCounter = nullptr;
+            }
+            return *this;
+        }
+        /// @brief CountedPtr assignment operator.
+        /// @param Other The CountedPtr whose managed object this will observe.
+        /// @return A reference to this.
+        WeakCountedPtr& operator=(const CountedPtr<TypePointedTo>& Other) noexcept
+        {
+            if( this->ReferenceCounter != Other.ReferenceCounter ) {
+                this->Release();
+                this->Acquire( Other.ReferenceCounter );
+            }
+            return *this;
+        }
+
+        /// @brief A comparision of two WeakCountedPtr instances.
+        /// @param Other The WeakCountedPtr on the right hand side of the ==.
+        /// @return This returns true if this and Other use the same reference count.
+        Boole operator==(const WeakCountedPtr& Other) const noexcept
+            { return Other.ReferenceCounter == this->ReferenceCounter; }
+
+        /// @brief A comparision of two WeakCountedPtr instances.
+        /// @param Other The WeakCountedPtr on the right hand side of the !=.
+        /// @return This returns true if this and Other do not use the same reference count.
+        Boole operator!=(const WeakCountedPtr& Other) const noexcept
+            { return Other.ReferenceCounter != this->ReferenceCounter; }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Manipulation/Query
+
+        /// @brief Stop observing the target.
+        void Reset() noexcept
+            { this->Release(); }
+
+        /// @brief Get the current count of strong references to the target.
+        /// @return The amount of CountedPtr instances which still exist, or 0 if the target was destroyed.
+        Whole UseCount() const noexcept
+            { return this->ReferenceCounter ? this->ReferenceCounter->GetReferenceCount() : 0; }
+
+        /// @brief Checks whether the target has been destroyed.
+        /// @return True if the target no longer exists or this never observed anything, false otherwise.
+        Boole Expired() const noexcept
+            { return this->UseCount() == 0; }
+
+        /// @brief Creates a CountedPtr that shares ownership of the target.
+        /// @return A CountedPtr to the target if it still exists, or an empty CountedPtr if it has been destroyed.
+        CountedPtr<TypePointedTo> Lock() const noexcept
+        {
+            CountedPtr<TypePointedTo> Ret;
+            if( this->ReferenceCounter && this->ReferenceCounter->IncrementReferenceCountIfNonZero() ) {
+                Ret.ReferenceCounter = this->ReferenceCounter;
+            }
+            return Ret;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A pointer to part of an object managed by a group of CountedPtr instances.
+    /// @details This shares ownership of an owning object, but points to something else, usually a member or
+    /// some other sub-object of the owner. As long as any of these exist the owner will be kept alive, so one
+    /// allocation can hand out counted views of its sub-objects without any additional reference counters.
+    /// Copying one of these costs the same as copying the CountedPtr to the owner.
+    /// @n @n
+    /// This is a separate type rather than a constructor on CountedPtr because a CountedPtr stores only a pointer
+    /// to its reference counter, and the reference counter is what provides the target. Storing a second pointer
+    /// in every CountedPtr would double the size of intrusively counted pointers.
+    /// @tparam TypePointedTo The type of the sub-object pointed to.
+    /// @tparam OwnerType The type of the object whose lifetime is shared.
+    /// @warning This is not thread safe by default, just like CountedPtr.
+    ///////////////////////////////////////////////////////////////////////////////
+    template<typename TypePointedTo, typename OwnerType>
+    class AliasedCountedPtr
+    {
+    public:
+        /// @brief The type of pointer used to keep the owner alive.
+        using OwnerPointerType = CountedPtr<OwnerType>;
+        /// @brief This makes referencing the type of the pointer object easier for external classes.
+        using ElementType = TypePointedTo;
+    protected:
+        /// @brief The pointer keeping the owner alive.
+        OwnerPointerType Owner;
+        /// @brief The sub-object this points to.
+        TypePointedTo* Target;
+    public:
+        ///////////////////////////////////////////////////////////////////////////////
+        // Construction/Destruction
+
+        /// @brief Blank constructor, this points to and owns nothing.
+        AliasedCountedPtr() noexcept
+            : Target(nullptr)
+            {}
+        /// @brief Aliasing constructor.
+        /// @param SharedOwner A CountedPtr to the object to share ownership of.
+        /// @param SubObject The object to point at, it must live at least as long as the owner.
+        AliasedCountedPtr(const OwnerPointerType& SharedOwner, TypePointedTo* SubObject) noexcept
+            : Owner(SharedOwner), Target(SubObject)
+            {}
+        /// @brief Aliasing move constructor.
+        /// @param SharedOwner A CountedPtr to the object to take ownership from.
+        /// @param SubObject The object to point at, it must live at least as long as the owner.
+        AliasedCountedPtr(OwnerPointerType&& SharedOwner, TypePointedTo* SubObject) noexcept
+            : Owner(std::move(SharedOwner)), Target(SubObject)
+            {}
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Operators
+
+        /// @brief Dereference operator.
+        /// @return The sub-object is returned by reference.
+        TypePointedTo& operator*() const noexcept
+            { return *(this->Target); }
+
+        /// @brief The Structure dereference operator.
+        /// @return Makes it appear, syntactically, as though you are dereferencing the raw pointer.
+        TypePointedTo* operator->() const noexcept
+            { return this->Target; }
+
+        /// @brief A comparision of two AliasedCountedPtr instances.
+        /// @param Other The AliasedCountedPtr on the right hand side of the ==.
+        /// @return True if both point to the same sub-object of the same owner group.
+        Boole operator==(const AliasedCountedPtr& Other) const noexcept
+            { return this->Target == Other.Target && this->Owner == Other.Owner; }
+
+        /// @brief A comparision of two AliasedCountedPtr instances.
+        /// @param Other The AliasedCountedPtr on the right hand side of the !=.
+        /// @return True if either the sub-object or the owner group differ.
+        Boole operator!=(const AliasedCountedPtr& Other) const noexcept
+            { return !( *this == Other ); }
+
+        /// @brief Returns true if this pointer points to something.
+        operator Boole() const noexcept
+            { return nullptr != this->Target; }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Manipulation/Query
+
+        /// @brief Reset this to point at nothing and release the owner.
+        void Reset() noexcept
+        {
+            this->Owner.Reset();
+            this->Target = nullptr;
+        }
+
+        /// @brief Get the current count of references to the owner.
+        /// @return The amount of references to the owner which still exist, or 0 if this owns nothing.
+        Whole UseCount() const noexcept
+            { return this->Owner.UseCount(); }
+
+        /// @brief Get the raw pointer to the sub-object.
+        /// @return The raw pointer to the sub-object or nullptr if this points at nothing.
+        TypePointedTo* Get() const noexcept
+            { return this->Target; }
+
+        /// @brief Get the pointer keeping the owner alive.
+        /// @return A const reference to the CountedPtr of the owner.
+        const OwnerPointerType& GetOwner() const noexcept
+            { return this->Owner; }
+    };//AliasedCountedPtr
+
+    /// @brief Convenience function to create an AliasedCountedPtr to a data member of a counted object.
+    /// @tparam OwnerType The type of the object whose lifetime is shared, this can be inferred.
+    /// @tparam MemberType The type of the data member, this can be inferred.
+    /// @param SharedOwner A CountedPtr to the object to share ownership of.
+    /// @param Member A pointer to the data member of the owner to point at.
+    /// @return An AliasedCountedPtr to the member, or an empty one if SharedOwner is empty.
+    template<typename OwnerType, typename MemberType>
+    AliasedCountedPtr<MemberType,OwnerType> MakeAliasedCountedPtr(const CountedPtr<OwnerType>& SharedOwner,
+                                                                  MemberType OwnerType::* Member)
+    {
+        if( !SharedOwner ) {
+            return AliasedCountedPtr<MemberType,OwnerType>();
+        }
+        return AliasedCountedPtr<MemberType,OwnerType>( SharedOwner, &( SharedOwner.Get()->*Member ) );
+    }
+
     ///////////////////////////////////////////////////////////////////////////////
     // Casting
 
@@ -0,0 +1,270 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_DeltaSerialization_h
+#define Mezz_Foundation_DeltaSerialization_h
+
+/// @file
+/// @brief Tools for encoding only the members of an object that changed, for replicating state over a network.
+
+#ifndef SWIG
+    #include "BinarySerialization.h"
+    #include "MezzException.h"
+
+    #include <bitset>
+    #include <cstring>
+#endif
+
+namespace Mezzanine
+{
+    /// @brief A set with one bit for every registered member of a class, in registration order.
+    /// @tparam Class The registered class the mask describes.
+    template<typename Class>
+    using DeltaMask = std::bitset< GetMemberCount<Class>() >;
+
+    namespace DeltaSerializationHelpers
+    {
+        /// @brief Convenience type for equality operator detection.
+        /// @tparam Type The type to test.
+        template<typename Type>
+        using EqualityOp_t = decltype(std::declval<const Type&>() == std::declval<const Type&>());
+        /// @brief Type for is_detected that tests for the existence of an equality operator for a type.
+        /// @tparam Type The type that will be checked for the presence of an equality operator.
+        template<typename Type>
+        using HasEqualityOp = std::is_detected<EqualityOp_t,Type>;
+
+        /// @brief Compares two values the same way they would be compared after a round trip through an archive.
+        /// @details Registered classes are compared member by member, skipping the members that archives skip, so
+        /// a change to a Local or Generated member is never seen as a change to the object.  Containers and pairs
+        /// are compared element by element with the same rules.  Floating point values are compared by their bits,
+        /// the way they are encoded, so a NaN is equal to the same NaN and 0.0 differs from -0.0.  Anything else is
+        /// compared with operator==.
+        /// @tparam ValueType The deduced type of values to compare.
+        /// @param Left The first value to compare.
+        /// @param Right The second value to compare.
+        /// @return Returns true if both values would produce the same archive, false otherwise.
+        template<typename ValueType>
+        Boole ValuesEqual(const ValueType& Left, const ValueType& Right)
+        {
+            using namespace BinarySerializationHelpers;
+            if constexpr( std::is_floating_point_v<ValueType> ) {
+                using BitsType = std::conditional_t< sizeof(ValueType) == sizeof(UInt32), UInt32, UInt64 >;
+                static_assert( sizeof(ValueType) == sizeof(BitsType), "Unsupported floating point width." );
+                BitsType LeftBits = 0;
+                BitsType RightBits = 0;
+                std::memcpy(&LeftBits,&Left,sizeof(ValueType));
+                std::memcpy(&RightBits,&Right,sizeof(ValueType));
+                return LeftBits == RightBits;
+            }else if constexpr( IsRawValue<ValueType>() || IsStringValue<ValueType>() ) {
+                return Left == Right;
+            }else if constexpr( IsRegistered<ValueType>() ) {
+                Boole Ret = true;
+                DoForAllMembers<ValueType>([&](const auto& Member) {
+                    using AccessorType = std::decay_t<decltype(Member)>;
+                    if constexpr( !IsSkippedMember<AccessorType>() ) {
+                        Ret = Ret && ValuesEqual( Member.GetValue(Left), Member.GetValue(Right) );
+                    }
+                });
+                return Ret;
+            }else if constexpr( is_pair<ValueType>::value ) {
+                return ValuesEqual(Left.first,Right.first) && ValuesEqual(Left.second,Right.second);
+            }else if constexpr( IsContainer<ValueType>() ) {
+                if( Left.size() != Right.size() ) {
+                    return false;
+                }
+                auto RightIt = Right.begin();
+                for( const auto& LeftElement : Left )
+                {
+                    if( !ValuesEqual(LeftElement,*RightIt) ) {
+                        return false;
+                    }
+                    ++RightIt;
+                }
+                return true;
+            }else{
+                static_assert( HasEqualityOp<ValueType>::value, "Type cannot be compared for delta encoding." );
+                return Left == Right;
+            }
+        }
+
+        /// @brief Gets the number of bytes used to store the mask of a class in a delta.
+        /// @tparam Class The registered class the mask describes.
+        /// @return Returns the number of bytes needed to hold one bit per registered member.
+        template<typename Class>
+        constexpr SizeType GetMaskBytes()
+            { return ( GetMemberCount<Class>() + 7 ) / 8; }
+    }//DeltaSerializationHelpers
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Delta Serialization
+
+    /// @brief Finds which registered members differ between two versions of an object.
+    /// @remarks Members tagged Local or Generated are never replicated and are never marked as changed.
+    /// @tparam Class The deduced registered class being compared.
+    /// @param Old The previously replicated state of the object.
+    /// @param New The current state of the object.
+    /// @return Returns a mask with a bit set for every member that changed.
+    template<typename Class>
+    DeltaMask<Class> GetChangedMembers(const Class& Old, const Class& New)
+    {
+        static_assert( IsRegistered<Class>(), "Only registered classes can be delta encoded." );
+        using namespace BinarySerializationHelpers;
+
+        DeltaMask<Class> Changed;
+        size_t MemberIdx = 0;
+        DoForAllMembers<Class>([&](const auto& Member) {
+            using AccessorType = std::decay_t<decltype(Member)>;
+            if constexpr( !IsSkippedMember<AccessorType>() ) {
+                if( !DeltaSerializationHelpers::ValuesEqual( Member.GetValue(Old), Member.GetValue(New) ) ) {
+                    Changed.set(MemberIdx);
+                }
+            }
+            ++MemberIdx;
+        });
+        return Changed;
+    }
+
+    /// @brief Appends a delta that will turn the old state of an object into the new state.
+    /// @details The delta is a mask with one bit per registered member, stored in the fewest whole bytes
+    /// possible, followed by the values of only the members that changed in registration order.  Values are
+    /// encoded the same way @ref SerializeBinary encodes them.  A delta of an unchanged object is just the mask.
+    /// @tparam Class The deduced registered class being encoded.
+    /// @param Writer The archive to append to.
+    /// @param Old The previously replicated state of the object.
+    /// @param New The current state of the object.
+    /// @return Returns true if any member changed, false otherwise.
+    template<typename Class>
+    Boole SerializeDelta(BinaryArchiveWriter& Writer, const Class& Old, const Class& New)
+    {
+        using namespace BinarySerializationHelpers;
+        const DeltaMask<Class> Changed = GetChangedMembers(Old,New);
+
+        constexpr SizeType MaskBytes = DeltaSerializationHelpers::GetMaskBytes<Class>();
+        UInt8 Mask[MaskBytes] = {};
+        for( size_t MemberIdx = 0 ; MemberIdx < Changed.size() ; ++MemberIdx )
+        {
+            Mask[MemberIdx / 8] = static_cast<UInt8>( Mask[MemberIdx / 8] | ( Changed[MemberIdx] << ( MemberIdx % 8 ) ) );
+        }
+        Writer.WriteBytes(Mask,MaskBytes);
+        if( Changed.none() ) {
+            return false;
+        }
+
+        size_t MemberIdx = 0;
+        DoForAllMembers<Class>([&](const auto& Member) {
+            using AccessorType = std::decay_t<decltype(Member)>;
+            if constexpr( !IsSkippedMember<AccessorType>() ) {
+                if( Changed[MemberIdx] ) {
+                    WriteValue(Writer,Member.GetValue(New));
+                }
+            }
+            ++MemberIdx;
+        });
+        return true;
+    }
+
+    /// @brief Creates a delta that will turn the old state of an object into the new state.
+    /// @tparam Class The deduced registered class being encoded.
+    /// @param Old The previously replicated state of the object.
+    /// @param New The current state of the object.
+    /// @return Returns a BinaryBuffer containing the delta.
+    template<typename Class>
+    BinaryBuffer Diff(const Class& Old, const Class& New)
+    {
+        BinaryArchiveWriter Writer(64);
+        SerializeDelta(Writer,Old,New);
+        return Writer.Finish();
+    }
+
+    /// @brief Reads the next delta from an archive and applies it to an object.
+    /// @remarks Only the members marked in the delta are assigned, everything else is left untouched.
+    /// @exception Throws a Mezzanine::Exception::OutOfRangeCode if the archive ends before the delta does, or a
+    /// Mezzanine::Exception::EncodingCode if the delta marks a member that is never replicated.
+    /// @tparam Class The deduced registered class being updated.
+    /// @param Reader The archive to read from.
+    /// @param Object The object to apply the delta to.
+    /// @return Returns a mask with a bit set for every member that was assigned.
+    template<typename Class>
+    DeltaMask<Class> ApplyDiff(BinaryArchiveReader& Reader, Class& Object)
+    {
+        static_assert( IsRegistered<Class>(), "Only registered classes can be delta encoded." );
+        using namespace BinarySerializationHelpers;
+
+        constexpr SizeType MaskBytes = DeltaSerializationHelpers::GetMaskBytes<Class>();
+        UInt8 Mask[MaskBytes] = {};
+        Reader.ReadBytes(Mask,MaskBytes);
+
+        DeltaMask<Class> Changed;
+        size_t MemberIdx = 0;
+        DoForAllMembers<Class>([&](const auto& Member) {
+            using AccessorType = std::decay_t<decltype(Member)>;
+            const Boole IsChanged = ( Mask[MemberIdx / 8] >> ( MemberIdx % 8 ) ) & 1;
+            if constexpr( !IsSkippedMember<AccessorType>() ) {
+                if( IsChanged ) {
+                    typename AccessorType::MemberType Value{};
+                    ReadValue(Reader,Value);
+                    Member.SetValue(Object,std::move(Value));
+                    Changed.set(MemberIdx);
+                }
+            }else{
+                if( IsChanged ) {
+                    MEZZ_EXCEPTION(EncodingCode, "Delta contains a member that is never replicated.")
+                }
+            }
+            ++MemberIdx;
+        });
+        return Changed;
+    }
+
+    /// @brief Applies a delta created by @ref Diff to an object.
+    /// @exception Throws a Mezzanine::Exception::OutOfRangeCode if the buffer ends before the delta does, or a
+    /// Mezzanine::Exception::EncodingCode if the delta marks a member that is never replicated.
+    /// @tparam Class The deduced registered class being updated.
+    /// @param Delta The buffer containing the delta.
+    /// @param Object The object to apply the delta to.
+    /// @return Returns a mask with a bit set for every member that was assigned.
+    template<typename Class>
+    DeltaMask<Class> ApplyDiff(const BinaryBuffer& Delta, Class& Object)
+    {
+        BinaryArchiveReader Reader(Delta);
+        return ApplyDiff(Reader,Object);
+    }
+}//Mezzanine
+
+#endif
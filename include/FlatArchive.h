@@ -0,0 +1,379 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_FlatArchive_h
+#define Mezz_Foundation_FlatArchive_h
+
+/// @file
+/// @brief A flat, fixed record size archive format that can be read in place without a parse step.
+
+#ifndef SWIG
+    #include "BinarySerialization.h"
+    #include "Introspection.h"
+    #include "MezzException.h"
+
+    #include <array>
+    #include <cstring>
+#endif
+
+namespace Mezzanine
+{
+    /// @brief The version of the flat archive layout written by this build.
+    static constexpr UInt16 FlatArchiveVersion = 1;
+    /// @brief The first four bytes of every flat archive, "MZFA" when read in order.
+    static constexpr UInt32 FlatArchiveMagic = 0x41465A4D;
+    /// @brief A known value written in host byte order so archives from hosts with a different order are rejected.
+    static constexpr UInt32 FlatArchiveByteOrderMark = 0x01020304;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief The header at the start of every flat archive.
+    /// @details The header and all records after it are written in host byte order with no padding, exactly
+    /// as they are meant to be read back.  It is 32 bytes so the first record starts at an offset that is
+    /// suitably aligned for any member type.
+    ///////////////////////////////////////
+    struct FlatArchiveHeader
+    {
+        /// @brief Always FlatArchiveMagic.
+        UInt32 Magic;
+        /// @brief The version of the layout, currently FlatArchiveVersion.
+        UInt16 Version;
+        /// @brief The size of this header in bytes, and the offset of the first record.
+        UInt16 HeaderSize;
+        /// @brief Always FlatArchiveByteOrderMark in the byte order of the host that wrote the archive.
+        UInt32 ByteOrderMark;
+        /// @brief The size of each record in bytes.
+        UInt32 RecordSize;
+        /// @brief A hash of the class name, member names and member types the records were written with.
+        UInt64 SchemaHash;
+        /// @brief The number of records following the header.
+        UInt64 RecordCount;
+    };//FlatArchiveHeader
+
+    static_assert( sizeof(FlatArchiveHeader) == 32, "FlatArchiveHeader is expected to have no padding." );
+
+    namespace FlatArchiveHelpers
+    {
+        /// @brief Convenience type for the type of a registered member.
+        /// @tparam Class The registered class to get the member type from.
+        /// @tparam Idx The index of the member in the registration tuple.
+        template<typename Class, size_t Idx>
+        using MemberTypeAt =
+            typename std::tuple_element_t< Idx, decltype( IntrospectionHelpers::GetMembers<Class>() ) >::MemberType;
+
+        /// @brief Checks to see if a type can be stored in a flat record.
+        /// @tparam CheckType The type to check.
+        /// @return Returns true if CheckType can be copied bytewise and means the same thing in another process.
+        template<typename CheckType>
+        constexpr Boole IsFlatMember()
+            { return std::is_trivially_copyable_v<CheckType> && !std::is_pointer_v<CheckType>; }
+
+        /// @brief Checks to see if every registered member of a class can be stored in a flat record.
+        /// @tparam Class The registered class to check.
+        /// @tparam Idxs An index sequence of every registered member.
+        /// @return Returns true if every member is a flat member, false otherwise.
+        template<typename Class, size_t... Idxs>
+        constexpr Boole IsFlatClass(std::index_sequence<Idxs...>)
+            { return ( IsFlatMember< MemberTypeAt<Class,Idxs> >() && ... ); }
+
+        /// @brief Computes the offset of every registered member of a class in a packed record.
+        /// @tparam Class The registered class to compute offsets for.
+        /// @tparam Idxs An index sequence of every registered member.
+        /// @return Returns the offset of each member, followed by the total size of the record.
+        template<typename Class, size_t... Idxs>
+        constexpr std::array<SizeType,sizeof...(Idxs) + 1> ComputeOffsets(std::index_sequence<Idxs...>)
+        {
+            constexpr SizeType Sizes[] = { sizeof( MemberTypeAt<Class,Idxs> )... };
+            std::array<SizeType,sizeof...(Idxs) + 1> Ret{};
+            for( size_t Idx = 0 ; Idx < sizeof...(Idxs) ; ++Idx )
+                { Ret[Idx + 1] = Ret[Idx] + Sizes[Idx]; }
+            return Ret;
+        }
+    }//FlatArchiveHelpers
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Compile time information about how a registered class is laid out in a flat archive record.
+    /// @details Every registered member is stored, in registration order, back to back with no padding.  Because
+    /// the offset of every member is known at compile time a member can be read straight out of a record, which
+    /// is what lets an archive be used in place from a memory mapped file.
+    /// @n @n
+    /// Only classes whose registered members are all trivially copyable (and not pointers) can be stored flat.
+    /// @tparam Class The registered class being described.
+    ///////////////////////////////////////
+    template<typename Class>
+    struct FlatLayout
+    {
+        /// @brief The type of tuple containing member accessors generated for the class.
+        using TupleType = decltype( IntrospectionHelpers::GetMembers<Class>() );
+        /// @brief Gets the type of a member stored in the record.
+        /// @tparam Idx The index of the member in the registration tuple.
+        template<size_t Idx>
+        using MemberTypeAt = FlatArchiveHelpers::MemberTypeAt<Class,Idx>;
+
+        /// @brief The number of members stored in each record.
+        static constexpr size_t MemberCount = std::tuple_size_v<TupleType>;
+
+        static_assert( MemberCount > 0, "Flat archives require a registered class." );
+        static_assert( FlatArchiveHelpers::IsFlatClass<Class>( std::make_index_sequence<MemberCount>{} ),
+                       "Flat archives require every registered member to be trivially copyable." );
+
+        /// @brief The offset of every member within a record, with the record size as the last entry.
+        static constexpr std::array<SizeType,MemberCount + 1> Offsets =
+            FlatArchiveHelpers::ComputeOffsets<Class>( std::make_index_sequence<MemberCount>{} );
+        /// @brief The size of a single record in bytes.
+        static constexpr SizeType RecordSize = Offsets[MemberCount];
+
+        /// @brief Gets a hash of the layout of the records.
+        /// @remarks This is the schema fingerprint of the class, which covers the names, order and sizes of
+        /// every member and so every offset in the record.
+        /// @return Returns the value stored in the header of archives of this class.
+        static UInt64 GetSchemaHash()
+            { return GetSchemaFingerprint<Class>(); }
+    };//FlatLayout
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A read-only view of a single record in a flat archive.
+    /// @details Values are copied out of the record on access, so the record doesn't need to be aligned.
+    /// @tparam Class The registered class the record was written from.
+    ///////////////////////////////////////
+    template<typename Class>
+    class FlatRecordView
+    {
+    public:
+        /// @brief The type describing the layout of the record.
+        using LayoutType = FlatLayout<Class>;
+        /// @brief The type meant to indicate one byte in the archive.
+        using Byte = BinaryBuffer::Byte;
+    protected:
+        /// @brief The start of the record being viewed.
+        const Byte* Record;
+    public:
+        /// @brief Class constructor.
+        /// @param RecordStart The first byte of the record.  It must remain valid for the life of this view.
+        explicit FlatRecordView(const Byte* RecordStart) noexcept :
+            Record(RecordStart)
+            {  }
+
+        /// @brief Gets the value of a member by its registration index.
+        /// @tparam Idx The index of the member in the registration tuple.
+        /// @return Returns a copy of the member value stored in the record.
+        template<size_t Idx>
+        typename LayoutType::template MemberTypeAt<Idx> Get() const noexcept
+        {
+            typename LayoutType::template MemberTypeAt<Idx> Ret;
+            std::memcpy(&Ret,this->Record + LayoutType::Offsets[Idx],sizeof(Ret));
+            return Ret;
+        }
+        /// @brief Gets the value of a member by its registered name.
+        /// @tparam MemberType The type of the member that will be returned.
+        /// @param Name The name of the member to retrieve.
+        /// @return Returns the member value stored in the record, or a value initialized MemberType if no
+        /// member of that name and type exists.
+        template<typename MemberType>
+        MemberType GetMemberValue(const StringView Name) const
+        {
+            MemberType Ret{};
+            const size_t Index = IntrospectionHelpers::MemberNameTable<Class>::Get().Find(Name);
+            if( Index < LayoutType::MemberCount ) {
+                DoForMember<Class,MemberType>(Name,[&](const auto&) {
+                    std::memcpy(&Ret,this->Record + LayoutType::Offsets[Index],sizeof(Ret));
+                });
+            }
+            return Ret;
+        }
+        /// @brief Assigns every registered member of an object from the record.
+        /// @param Object The object to be assigned.
+        void Load(Class& Object) const
+            { this->LoadImpl(Object,std::make_index_sequence<LayoutType::MemberCount>{}); }
+        /// @brief Gets a pointer to the raw bytes of the record.
+        /// @return Returns a pointer to the first byte of the record.
+        const Byte* GetData() const noexcept
+            { return this->Record; }
+    private:
+        /// @brief Assigns every registered member of an object from the record.
+        /// @tparam Idxs An index sequence of every registered member.
+        /// @param Object The object to be assigned.
+        template<size_t... Idxs>
+        void LoadImpl(Class& Object, std::index_sequence<Idxs...>) const
+        {
+            const auto& Mems = GetRegisteredMembers<Class>();
+            ( std::get<Idxs>(Mems).SetValue(Object,this->Get<Idxs>()), ... );
+        }
+    };//FlatRecordView
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A read-only view of an entire flat archive, such as one in a memory mapped file.
+    /// @details Construction validates the header and checks that the range is large enough for every
+    /// record, after which records can be accessed in constant time without any parsing.  This doesn't own
+    /// the memory it views.
+    /// @tparam Class The registered class the records were written from.
+    ///////////////////////////////////////
+    template<typename Class>
+    class FlatArchiveView
+    {
+    public:
+        /// @brief The type describing the layout of each record.
+        using LayoutType = FlatLayout<Class>;
+        /// @brief The type of view returned for each record.
+        using RecordType = FlatRecordView<Class>;
+        /// @brief The type meant to indicate one byte in the archive.
+        using Byte = BinaryBuffer::Byte;
+    protected:
+        /// @brief A copy of the header at the start of the archive.
+        FlatArchiveHeader Header;
+        /// @brief The first byte of the first record.
+        const Byte* Records = nullptr;
+    public:
+        /// @brief Range constructor.
+        /// @exception Throws a Mezzanine::Exception::EncodingCode if the header is malformed, from an
+        /// incompatible host or layout version, or doesn't match the schema of Class.  Throws a
+        /// Mezzanine::Exception::OutOfRangeCode if the range is too small for the records it claims to hold.
+        /// @param Data The start of the archive.  It must remain valid for the life of this view.
+        /// @param Size The number of bytes in the archive.
+        FlatArchiveView(const void* Data, const SizeType Size)
+        {
+            if( Data == nullptr || Size < sizeof(FlatArchiveHeader) ) {
+                MEZZ_EXCEPTION(OutOfRangeCode, "Buffer is too small to hold a flat archive header.")
+            }
+            std::memcpy(&this->Header,Data,sizeof(FlatArchiveHeader));
+            if( this->Header.Magic != FlatArchiveMagic || this->Header.HeaderSize < sizeof(FlatArchiveHeader) ) {
+                MEZZ_EXCEPTION(EncodingCode, "Buffer does not contain a flat archive.")
+            }
+            if( this->Header.Version != FlatArchiveVersion ) {
+                MEZZ_EXCEPTION(EncodingCode, "Flat archive was written with an unsupported layout version.")
+            }
+            if( this->Header.ByteOrderMark != FlatArchiveByteOrderMark ) {
+                MEZZ_EXCEPTION(EncodingCode, "Flat archive was written on a host with a different byte order.")
+            }
+            if( this->Header.RecordSize != LayoutType::RecordSize ||
+                this->Header.SchemaHash != LayoutType::GetSchemaHash() )
+            {
+                MEZZ_EXCEPTION(EncodingCode, "Flat archive schema does not match the registered class.")
+            }
+            if( Size < this->Header.HeaderSize ||
+                this->Header.RecordCount > ( Size - this->Header.HeaderSize ) / LayoutType::RecordSize )
+            {
+                MEZZ_EXCEPTION(OutOfRangeCode, "Buffer is too small to hold every record in the flat archive.")
+            }
+            this->Records = static_cast<const Byte*>(Data) + this->Header.HeaderSize;
+        }
+        /// @brief Buffer constructor.
+        /// @param Source The buffer holding the archive.  It must outlive this view.
+        explicit FlatArchiveView(const BinaryBuffer& Source) :
+            FlatArchiveView(Source.Binary,Source.Size)
+            {  }
+
+        /// @brief Gets the header of the archive.
+        /// @return Returns a const reference to the validated header.
+        const FlatArchiveHeader& GetHeader() const noexcept
+            { return this->Header; }
+        /// @brief Gets the number of records in the archive.
+        /// @return Returns the record count stored in the header.
+        SizeType size() const noexcept
+            { return static_cast<SizeType>(this->Header.RecordCount); }
+        /// @brief Checks to see if the archive holds no records.
+        /// @return Returns true if the record count is zero, false otherwise.
+        Boole empty() const noexcept
+            { return this->Header.RecordCount == 0; }
+        /// @brief Gets a record without bounds checking.
+        /// @param Index The index of the record to view.
+        /// @return Returns a view of the requested record.
+        RecordType operator[](const SizeType Index) const noexcept
+            { return RecordType(this->Records + Index * LayoutType::RecordSize); }
+        /// @brief Gets a record with bounds checking.
+        /// @exception Throws a Mezzanine::Exception::OutOfRangeCode if Index isn't less than the record count.
+        /// @param Index The index of the record to view.
+        /// @return Returns a view of the requested record.
+        RecordType at(const SizeType Index) const
+        {
+            if( Index >= this->size() ) {
+                MEZZ_EXCEPTION(OutOfRangeCode, "Attempted access beyond range of FlatArchiveView.")
+            }
+            return (*this)[Index];
+        }
+    };//FlatArchiveView
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Flat Serialization
+
+    /// @brief Appends a flat archive of a range of objects.
+    /// @tparam ContainerType The deduced type of the container holding the objects.
+    /// @param Writer The archive writer to append to.
+    /// @param Objects The objects that will each be written as one record.
+    template<typename ContainerType>
+    void SerializeFlatArchive(BinaryArchiveWriter& Writer, const ContainerType& Objects)
+    {
+        using Class = typename ContainerType::value_type;
+        using LayoutType = FlatLayout<Class>;
+
+        FlatArchiveHeader Header;
+        Header.Magic = FlatArchiveMagic;
+        Header.Version = FlatArchiveVersion;
+        Header.HeaderSize = sizeof(FlatArchiveHeader);
+        Header.ByteOrderMark = FlatArchiveByteOrderMark;
+        Header.RecordSize = static_cast<UInt32>(LayoutType::RecordSize);
+        Header.SchemaHash = LayoutType::GetSchemaHash();
+        Header.RecordCount = Objects.size();
+
+        Writer.Reserve( sizeof(FlatArchiveHeader) + Objects.size() * LayoutType::RecordSize );
+        Writer.WriteBytes(&Header,sizeof(FlatArchiveHeader));
+        const auto& Mems = GetRegisteredMembers<Class>();
+        for( const Class& Object : Objects )
+        {
+            IntrospectionHelpers::TupleForEach([&](const auto& Member) {
+                const auto& Value = Member.GetValue(Object);
+                Writer.WriteBytes(&Value,sizeof(Value));
+            }, Mems);
+        }
+    }
+
+    /// @brief Creates a flat archive of a range of objects.
+    /// @tparam ContainerType The deduced type of the container holding the objects.
+    /// @param Objects The objects that will each be written as one record.
+    /// @return Returns a BinaryBuffer containing the archive, ready to be written to disk or viewed in place.
+    template<typename ContainerType>
+    BinaryBuffer SerializeFlatArchive(const ContainerType& Objects)
+    {
+        using LayoutType = FlatLayout<typename ContainerType::value_type>;
+        BinaryArchiveWriter Writer( sizeof(FlatArchiveHeader) + Objects.size() * LayoutType::RecordSize );
+        SerializeFlatArchive(Writer,Objects);
+        return Writer.Finish();
+    }
+}//Mezzanine
+
+#endif
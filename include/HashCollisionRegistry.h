@@ -0,0 +1,131 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_HashCollisionRegistry_h
+#define Mezz_Foundation_HashCollisionRegistry_h
+
+/// @file
+/// @brief A registry that records which string produced each hash, for catching hash collisions.
+
+#ifndef SWIG
+    #include "DataTypes.h"
+
+    #include <functional>
+    #include <mutex>
+    #include <unordered_map>
+    #include <vector>
+#endif
+
+namespace Mezzanine
+{
+SAVE_WARNING_STATE
+SUPPRESS_CLANG_WARNING("-Wpadded")
+
+    /// @brief A record of two different strings that produced the same hash.
+    struct MEZZ_LIB HashCollision
+    {
+        /// @brief The hash both strings produced.
+        UInt64 Hash;
+        /// @brief The string that was registered with the hash first.
+        String Existing;
+        /// @brief The different string that produced the same hash later.
+        String Incoming;
+    };//HashCollision
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A thread-safe map from hashes to the string that first produced each one.
+    /// @details Identifiers that compare only their hashes silently treat two different strings as the same
+    /// name if the hashes collide.  Registering every hashed string here catches that the moment the second
+    /// string is hashed.  Each collision is recorded and passed to the collision handler.  By default the
+    /// handler throws, see ThrowOnCollision().
+    /// @n @n
+    /// Every registration takes a lock and every distinct string is stored, so this is meant for debug builds.
+    ///////////////////////////////////////
+    class MEZZ_LIB HashCollisionRegistry
+    {
+    public:
+        /// @brief The type of callable invoked for each collision detected.
+        using HandlerType = std::function<void(const HashCollision&)>;
+    protected:
+        /// @brief The first string registered with each hash.
+        std::unordered_map<UInt64,String> Registered;
+        /// @brief Every collision detected so far.
+        std::vector<HashCollision> Collisions;
+        /// @brief The callable invoked for each collision detected.
+        HandlerType Handler;
+        /// @brief Serializes access to everything else.
+        mutable std::mutex Lock;
+    public:
+        /// @brief Class constructor.
+        HashCollisionRegistry();
+
+        /// @brief Gets the registry shared by the whole application.
+        /// @return Returns a reference to the global HashCollisionRegistry.
+        static HashCollisionRegistry& GetGlobal();
+        /// @brief The default collision handler, which throws.
+        /// @param Collision The collision to describe.
+        /// @exception Throws a Mezzanine::Exception::EncodingCode naming both strings and their hash.
+        static void ThrowOnCollision(const HashCollision& Collision);
+
+        /// @brief Records the string that produced a hash.
+        /// @remarks Registering the same string with the same hash any number of times is harmless.  A collision
+        /// is recorded before the handler is called, so it is recorded even if the handler throws.
+        /// @param Hash The hash of the string.
+        /// @param Text The string that was hashed.
+        /// @return Returns false if a different string was already registered with the same hash, true otherwise.
+        /// @exception Anything the handler throws.  The default handler throws on every collision.
+        Boole Register(const UInt64 Hash, const StringView Text);
+        /// @brief Sets the callable invoked for each collision detected.
+        /// @param NewHandler The callable to invoke, or an empty function to only record collisions.
+        void SetHandler(HandlerType NewHandler);
+
+        /// @brief Gets every collision detected so far.
+        /// @return Returns a copy of the recorded collisions, in the order they were detected.
+        std::vector<HashCollision> GetCollisions() const;
+        /// @brief Gets the number of distinct hashes registered.
+        /// @return Returns the number of hashes that have a registered string.
+        SizeType GetCount() const;
+        /// @brief Forgets every registered string and recorded collision.
+        void Clear();
+    };//HashCollisionRegistry
+
+RESTORE_WARNING_STATE
+}//Mezzanine
+
+#endif
@@ -0,0 +1,425 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_HashedString_h
+#define Mezz_Foundation_HashedString_h
+
+/// @file
+/// @brief Identifiers that compare as fast as an integer but keep their string.
+
+#ifndef SWIG
+    #include "DataTypes.h"
+    #include "HashCollisionRegistry.h"
+    #include "MurmurHash.h"
+    #include "StringInternPool.h"
+
+    #include <ostream>
+#endif
+
+namespace Mezzanine
+{
+
+#ifndef HASHED_STRING_32_SEED
+/// @def HASHED_STRING_32_SEED
+/// @brief A value used to tweak the hash function for maximum randomness.
+#define HASHED_STRING_32_SEED 1
+#endif
+
+#ifndef HASHED_STRING_64_SEED
+/// @def HASHED_STRING_64_SEED
+/// @brief A value used to tweak the 64-bit hash function for maximum randomness.
+#define HASHED_STRING_64_SEED 1
+#endif
+
+#ifndef HASHED_STRING_COLLISION_CHECKS
+/// @def HASHED_STRING_COLLISION_CHECKS
+/// @brief When non-zero every HashedString64 registers its string with the global HashCollisionRegistry.
+/// @details This is on in debug builds and off when NDEBUG is defined, because every registration takes a lock
+/// and keeps a copy of the string.  Define it when building to override that.
+#ifdef NDEBUG
+    #define HASHED_STRING_COLLISION_CHECKS 0
+#else
+    #define HASHED_STRING_COLLISION_CHECKS 1
+#endif
+#endif
+
+SAVE_WARNING_STATE
+SUPPRESS_CLANG_WARNING("-Wpadded")
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief An identifier that compares as fast as an integer but has a string.
+    /// @details This computes a MurmurA(x86 32bit) hash on creation and interns the
+    /// string in the global StringInternPool. Each instance holds only the hash and a
+    /// pointer to the canonical copy of the string, so copies and moves are trivial
+    /// and repeated identifiers share one copy of their text. @n @n
+    /// Equality compares the interned pointers, so it is exact even when two
+    /// different strings have the same hash.
+    ///////////////////////////////////////
+    class MEZZ_LIB HashedString32
+    {
+    public:
+        /// @brief The type of the computed hash.
+        using HashType = Int32;
+        /// @brief The hash value of an empty string ("").
+        static const HashType EmptyHash = 1364076727;
+
+        /// @brief The text of a string literal and its hash, computed at compile time by operator""_hs.
+        struct Literal
+        {
+            /// @brief The text of the literal, without the null terminator.
+            StringView Text;
+            /// @brief The hash of the text.
+            HashType Hash;
+        };
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Utility
+
+        /// @brief Compute a MurmurA aka MurmurX86-32bit has of a string and return it.
+        /// @param ToBeHashed The string to hash
+        /// @return A 32 bit value approximating unique, which represents the passed string.
+        static HashType Murmur32bit(const String& ToBeHashed);
+        /// @brief Compute a MurmurA aka MurmurX86-32bit has of a string and return it.
+        /// @param ToBeHashed The string to hash
+        /// @return A 32 bit value approximating unique, which represents the passed string.
+        static HashType Murmur32bit(const char* ToBeHashed);
+        /// @brief Compute a MurmurA aka MurmurX86-32bit hash of a string in a way that can be done at compile time.
+        /// @remarks This produces the same value as Murmur32bit, so hashes computed from constants can be compared
+        /// against hashes computed at runtime.
+        /// @param ToBeHashed The string to hash
+        /// @return A 32 bit value approximating unique, which represents the passed string.
+        static constexpr HashType CompileTimeMurmur32bit(const StringView ToBeHashed)
+            { return static_cast<HashType>( Hashing::MurmurHash3_x86_32(ToBeHashed,HASHED_STRING_32_SEED) ); }
+
+    protected:
+        ///////////////////////////////////////////////////////////////////////////////
+        // Data
+
+        /// @brief The canonical copy of the string in the global StringInternPool.
+        const StringInternPool::Entry* Interned;
+        /// @brief The computed hash, kept here so ordering doesn't need to follow the pointer.
+        HashType Hash;
+
+        /// @brief Interns a string in the global pool.
+        /// @param ToIntern The string to intern.
+        /// @param StringHash The hash of the string.
+        /// @return Returns a pointer to the canonical copy of the string.
+        static const StringInternPool::Entry* Intern(const StringView ToIntern, const HashType StringHash);
+
+    public:
+        ///////////////////////////////////////////////////////////////////////////////
+        // Creation
+
+        /// @brief NonComputing Constructor
+        /// @details Skip the hashing overhead and just refer to the interned empty string.
+        HashedString32();
+        /// @brief String Constructor
+        /// @param StartingString The String to work with
+        /// @details Compute the hash of the String and hang onto both for future use.
+        HashedString32(const String& StartingString);
+        /// @brief C-String Constructor
+        /// @param StartingString The String to work with
+        /// @details Compute the hash of the String and hang onto both for future use.
+        HashedString32(const char* StartingString);
+        /// @brief Precomputed Constructor
+        /// @param StartingString The String to work with
+        /// @param PrecomputedHash The value
+        /// @details Does not Compute the hash of the String, Just trusts whatever it is given.
+        HashedString32(const StringView StartingString, const HashType PrecomputedHash);
+        /// @brief Literal Constructor
+        /// @param StartingLiteral A literal created with operator""_hs.
+        /// @details Uses the hash computed when the literal was compiled.
+        HashedString32(const Literal& StartingLiteral);
+        /// @brief Copy constructor
+        /// @param StartingString The other hashed string
+        HashedString32(const HashedString32& StartingString) = default;
+        /// @brief Move constructor.
+        /// @param MovingString The other hashed string.
+        HashedString32(HashedString32&& MovingString) = default;
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Non-Comparison Operators
+
+        /// @brief Assignment operator.
+        /// @param Other The other string to be copied.
+        /// @return Returns a reference to this.
+        HashedString32& operator=(const HashedString32& Other) = default;
+        /// @brief Move assignment operator.
+        /// @param Other The other string to be moved.
+        /// @return Returns a reference to this.
+        HashedString32& operator=(HashedString32&& Other) = default;
+
+        /// @brief Standard String Assignment operator.
+        /// @param Other The other std::string to be copied.
+        /// @return Returns a reference to this.
+        HashedString32& operator=(const String& Other);
+        /// @brief C-String Assignment operator.
+        /// @param Other The other c-string to be copied.
+        /// @return Returns a reference to this.
+        HashedString32& operator=(const char* Other);
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Comparisons
+
+        /// @brief Compare this and another string for equality.
+        /// @param Other The other string to compare this one too.
+        /// @return True if both refer to the same interned string.
+        Boole operator==(const HashedString32& Other) const;
+        /// @brief Compare this and another string for inequality.
+        /// @param Other The other string to compare this one too.
+        /// @return True if the two refer to different interned strings.
+        Boole operator!=(const HashedString32& Other) const;
+        /// @brief Provide a semantically useless, but quite fast sorting order for std containers based on hashes.
+        /// @param Other The other string to compare this one too.
+        /// @return true If the Hash of this is smaller than the hash of the other, or the hashes collide and the
+        /// string of this is smaller.
+        Boole operator<(const HashedString32& Other) const;
+        /// @brief Provide a semantically useless, but quite fast sorting order for std containers based on hashes.
+        /// @param Other The other string to compare this one too.
+        /// @return true If the Hash of this is larger than the hash of the other, or the hashes collide and the
+        /// string of this is larger.
+        Boole operator>(const HashedString32& Other) const;
+
+        /// @return True if this is equal to "", false otherwise.
+        Boole IsEmpty() const;
+
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Data Modifiers/observers
+
+        /// @brief Gets the hash generated from the provided string.
+        /// @return Returns a HashType with the hash in it.
+        HashType GetHash() const;
+        /// @brief Get the string that was used to calculate the hash.
+        /// @return Returns the underlying string.
+        const String& GetString() const;
+        /// @brief Set a new string and recalculate its hash.
+        /// @param NewString The data to hash and store for later use.
+        void SetString(const String& NewString);
+
+    };//HashedString32
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Class External Operators
+
+    /// @brief Creates a combined string between a HashedString32 and a string literal.
+    /// @param Hashed The HashedString32 to concatenate.
+    /// @param Literal The string literal to concatenate.
+    /// @return Returns a string containing the concatenated results of a hashed string and a string literal.
+    String MEZZ_LIB operator+(const HashedString32& Hashed, const char* Literal);
+    /// @brief Creates a combined string between a HashedString32 and a string literal.
+    /// @param Literal The string literal to concatenate.
+    /// @param Hashed The HashedString32 to concatenate.
+    /// @return Returns a string containing the concatenated results of a hashed string and a string literal.
+    String MEZZ_LIB operator+(const char* Literal, const HashedString32& Hashed);
+
+    /// @brief Send the string of a HashedString32 down a stream.
+    /// @param stream The std::ostream to send it down.
+    /// @param x The HashedString32 to Send.
+    /// @return Returns a reference to the stream argument.
+    std::ostream& MEZZ_LIB operator << (std::ostream& stream, const Mezzanine::HashedString32& x);
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief An identifier with a 64-bit hash that compares as fast as an integer but has a string.
+    /// @details This computes the first half of a MurmurHash3_x64_128 hash on creation and
+    /// interns the string in the global StringInternPool, the same as HashedString32. @n @n
+    /// Comparisons only look at the hash, so they are the same for any two instances no
+    /// matter where their strings came from, and the hash can be stored or sent elsewhere
+    /// in place of the string. With millions of identifiers a 32-bit hash is likely to
+    /// collide, a 64-bit one is not. To be sure, when HASHED_STRING_COLLISION_CHECKS is
+    /// non-zero every string hashed is registered with HashCollisionRegistry::GetGlobal,
+    /// which by default throws when two different strings produce the same hash.
+    ///////////////////////////////////////
+    class MEZZ_LIB HashedString64
+    {
+    public:
+        /// @brief The type of the computed hash.
+        using HashType = UInt64;
+        /// @brief The hash value of an empty string ("").
+        static const HashType EmptyHash = 5048724184180415669ull;
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Utility
+
+        /// @brief Compute the first half of a MurmurHash3_x64_128 hash of a string and return it.
+        /// @param ToBeHashed The string to hash
+        /// @return A 64 bit value approximating unique, which represents the passed string.
+        static HashType Murmur64bit(const StringView ToBeHashed);
+
+    protected:
+        ///////////////////////////////////////////////////////////////////////////////
+        // Data
+
+        /// @brief The canonical copy of the string in the global StringInternPool.
+        const StringInternPool::Entry* Interned;
+        /// @brief The computed hash.
+        HashType Hash;
+
+        /// @brief Interns a string and, if collision checks are enabled, registers it.
+        /// @param NewString The string to store.
+        /// @param NewHash The hash of the string.
+        /// @exception Anything the global HashCollisionRegistry handler throws, if collision checks are enabled.
+        void Assign(const StringView NewString, const HashType NewHash);
+
+    public:
+        ///////////////////////////////////////////////////////////////////////////////
+        // Creation
+
+        /// @brief NonComputing Constructor
+        /// @details Skip the hashing overhead and just refer to the interned empty string.
+        HashedString64();
+        /// @brief String Constructor
+        /// @param StartingString The String to work with
+        /// @details Compute the hash of the String and hang onto both for future use.
+        HashedString64(const String& StartingString);
+        /// @brief C-String Constructor
+        /// @param StartingString The String to work with
+        /// @details Compute the hash of the String and hang onto both for future use.
+        HashedString64(const char* StartingString);
+        /// @brief Precomputed Constructor
+        /// @param StartingString The String to work with
+        /// @param PrecomputedHash The value
+        /// @details Does not Compute the hash of the String, Just trusts whatever it is given.
+        HashedString64(const StringView StartingString, const HashType PrecomputedHash);
+        /// @brief Copy constructor
+        /// @param StartingString The other hashed string
+        HashedString64(const HashedString64& StartingString) = default;
+        /// @brief Move constructor.
+        /// @param MovingString The other hashed string.
+        HashedString64(HashedString64&& MovingString) = default;
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Non-Comparison Operators
+
+        /// @brief Assignment operator.
+        /// @param Other The other string to be copied.
+        /// @return Returns a reference to this.
+        HashedString64& operator=(const HashedString64& Other) = default;
+        /// @brief Move assignment operator.
+        /// @param Other The other string to be moved.
+        /// @return Returns a reference to this.
+        HashedString64& operator=(HashedString64&& Other) = default;
+
+        /// @brief Standard String Assignment operator.
+        /// @param Other The other std::string to be copied.
+        /// @return Returns a reference to this.
+        HashedString64& operator=(const String& Other);
+        /// @brief C-String Assignment operator.
+        /// @param Other The other c-string to be copied.
+        /// @return Returns a reference to this.
+        HashedString64& operator=(const char* Other);
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Comparisons
+
+        /// @brief Compare The hash of this and another string for equality.
+        /// @param Other The other string to compare this one too.
+        /// @return True if the hashes are the same.
+        Boole operator==(const HashedString64& Other) const
+            { return Hash == Other.Hash; }
+        /// @brief Compare The hash of this and another string for inequality.
+        /// @param Other The other string to compare this one too.
+        /// @return True if the hashes are different.
+        Boole operator!=(const HashedString64& Other) const
+            { return Hash != Other.Hash; }
+        /// @brief Provide a semantically useless, but quite fast sorting order for std containers based on only hashes.
+        /// @param Other The other string to compare this one too.
+        /// @return true If the Hash of this is smaller than the hash of the other
+        Boole operator<(const HashedString64& Other) const
+            { return Hash < Other.Hash; }
+        /// @brief Provide a semantically useless, but quite fast sorting order for std containers based on only hashes.
+        /// @param Other The other string to compare this one too.
+        /// @return true If the Hash of this is larger than the hash of the other
+        Boole operator>(const HashedString64& Other) const
+            { return Hash > Other.Hash; }
+
+        /// @return True if this is equal to "", false otherwise.
+        Boole IsEmpty() const
+            { return HashedString64::EmptyHash == Hash; }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Data Modifiers/observers
+
+        /// @brief Gets the hash generated from the provided string.
+        /// @return Returns a HashType with the hash in it.
+        HashType GetHash() const
+            { return Hash; }
+        /// @brief Get the string that was used to calculate the hash.
+        /// @return Returns the underlying string.
+        const String& GetString() const
+            { return Interned->Text; }
+        /// @brief Set a new string and recalculate its hash.
+        /// @param NewString The data to hash and store for later use.
+        void SetString(const String& NewString);
+    };//HashedString64
+
+    /// @brief Send the string of a HashedString64 down a stream.
+    /// @param stream The std::ostream to send it down.
+    /// @param x The HashedString64 to Send.
+    /// @return Returns a reference to the stream argument.
+    std::ostream& MEZZ_LIB operator << (std::ostream& stream, const Mezzanine::HashedString64& x);
+
+    inline namespace Literals
+    {
+        /// @brief Gets the hash a HashedString32 of a string literal would have, at compile time.
+        /// @details This is usable anywhere a constant is required, such as the case labels of a switch on
+        /// HashedString32::GetHash.
+        /// @param Literal The string literal to hash.
+        /// @param Length The length of the string literal, not including the null terminator.
+        /// @return Returns the same hash as HashedString32::Murmur32bit would for the same text.
+        constexpr HashedString32::HashType operator""_hash(const char* Literal, const std::size_t Length)
+            { return HashedString32::CompileTimeMurmur32bit( StringView(Literal,Length) ); }
+        /// @brief Hashes a string literal at compile time for creating a HashedString32.
+        /// @details The result converts implicitly to a HashedString32, which interns the text with the hash
+        /// computed here rather than hashing it at runtime.  Once the literal has been interned that is a lookup in
+        /// the pool that never takes a lock.
+        /// @param Literal The string literal to hash.
+        /// @param Length The length of the string literal, not including the null terminator.
+        /// @return Returns the text of the literal and its hash.
+        constexpr HashedString32::Literal operator""_hs(const char* Literal, const std::size_t Length)
+        {
+            return HashedString32::Literal{ StringView(Literal,Length),
+                                            HashedString32::CompileTimeMurmur32bit( StringView(Literal,Length) ) };
+        }
+    }//Literals
+
+RESTORE_WARNING_STATE
+}//Mezzanine
+
+#endif
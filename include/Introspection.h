@@ -41,6 +41,9 @@
 #define Mezz_Foundation_Introspection_h
 
 #ifndef SWIG
+    #include <algorithm>
+    #include <array>
+    #include <limits>
     #include <tuple>
     #include "DataTypes.h"
     #include "DetectionTraits.h"
@@ -284,7 +287,7 @@ namespace Mezzanine {
     /// @param TagToStream The MemberTag value that will be converted and streamed.
     /// @return Returns a reference to the standard output stream.
     std::ostream& operator<<(std::ostream& Stream, const MemberTags TagToStream);//[-Werror=missing-declarations]
-    std::ostream& operator<<(std::ostream& Stream, const MemberTags TagToStream)
+    inline std::ostream& operator<<(std::ostream& Stream, const MemberTags TagToStream)
     {
         Stream << static_cast< std::underlying_type_t<MemberTags> >(TagToStream);
         return Stream;
@@ -349,6 +352,10 @@ namespace Mezzanine {
         using MemberType = typename GetDeducer::DecayedType;
         /// @brief The type returned by the getter method.
         using ReturnType = typename GetDeducer::ReturnType;
+        /// @brief The type returned when getting the member from a const object.
+        using ConstReturnType = std::conditional_t< std::is_same_v<GetterMethod,MemberPtrType<ClassType,MemberType>> ||
+                                                    std::is_same_v<GetterMethod,NonConstRefGetterPtrType<ClassType,MemberType>>,
+                                                    const MemberType&, ReturnType >;
         /// @brief The member pointer type of the setter method.
         using SetterAccessPtr = SetterMethod;
         /// @brief The member pointer type of the getter method.
@@ -475,6 +482,27 @@ namespace Mezzanine {
                 MEZZ_EXCEPTION(IntrospectionNullptrCode, "Cannot Get Member value, no getter provided.")
             }
         }
+        /// @brief Gets the value of a member on a const object.
+        /// @remarks Non-const reference getters are still used to read the member.  They only hand out a reference
+        /// to it, and it is returned as a const reference.
+        /// @exception If the Getter Access pointer is nullptr, then an Mezzanine::Exception::IntrospectionNullptrCode
+        /// will be thrown.
+        /// @param Object The object to retrieve the member value from.
+        /// @return Returns the value of the member.
+        ConstReturnType GetValue(const ClassType& Object) const
+        {
+            if( this->HasGetter() ) {
+                if constexpr( std::is_same_v<GetterAccessPtr,MemberPtrType<ClassType,MemberType>> ) {
+                    return (Object.*GetterPtr);
+                }else if constexpr( std::is_same_v<GetterAccessPtr,NonConstRefGetterPtrType<ClassType,MemberType>> ) {
+                    return (const_cast<ClassType&>(Object).*GetterPtr)();
+                }else{
+                    return (Object.*GetterPtr)();
+                }
+            }else{
+                MEZZ_EXCEPTION(IntrospectionNullptrCode, "Cannot Get Member value, no getter provided.")
+            }
+        }
 
         ///////////////////////////////////////////////////////////////////////////////
         // Simple Query
@@ -496,6 +524,19 @@ namespace Mezzanine {
         /// @return Returns a MemberTags value or mask of values describing extra details about the member.
         static constexpr MemberTags GetTags()
             { return Tags; }
+        /// @brief Checks to see if the member is accessed through a pointer to a data member.
+        /// @return Returns true if the getter is a direct member pointer, false if it's a method.
+        static constexpr Boole IsDirectMember()
+            { return std::is_same_v<GetterAccessPtr,MemberPtrType<ClassType,MemberType>>; }
+        /// @brief Gets the address of the member on an object without copying it.
+        /// @pre This is only available if IsDirectMember() returns true.
+        /// @param Object The object to get the member address from.
+        /// @return Returns a pointer to the member, or nullptr if no getter was provided.
+        const MemberType* GetAddress(const ClassType& Object) const
+        {
+            static_assert( IsDirectMember(), "Member addresses are only available for direct member pointers." );
+            return ( this->HasGetter() ? &(Object.*GetterPtr) : nullptr );
+        }
     };//MemberAccessor
 
     RESTORE_WARNING_STATE
@@ -735,6 +776,276 @@ namespace Mezzanine {
         template<typename Funct, typename... Members>
         constexpr void TupleForEachReverse(Funct&& ToCall, const std::tuple<>& Mems)
             { (void)ToCall;  (void)Mems; }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Member Name Lookup
+
+        /// @brief Hashes a member name for use in a MemberNameTable.
+        /// @param Name The name to be hashed.
+        /// @return Returns a 64-bit FNV-1a hash of the name with its bits mixed so every bit depends on the name.
+        constexpr UInt64 HashMemberName(const StringView Name) noexcept
+        {
+            UInt64 Hash = 14695981039346656037ULL;
+            for( const char Current : Name )
+            {
+                Hash ^= static_cast<UInt8>(Current);
+                Hash *= 1099511628211ULL;
+            }
+            Hash ^= Hash >> 33;
+            Hash *= 0xff51afd7ed558ccdULL;
+            Hash ^= Hash >> 33;
+            return Hash;
+        }
+
+        /// @brief Gets the smallest power of 2 that is equal to or larger than a value.
+        /// @param Val The value to round up.
+        /// @return Returns a power of 2 that is at least 1 and at least Val.
+        constexpr size_t NextPowerOfTwo(const size_t Val) noexcept
+        {
+            size_t Ret = 1;
+            while( Ret < Val )
+                { Ret *= 2; }
+            return Ret;
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        /// @brief A perfect hash table from the names of the registered members of a class to their tuple index.
+        /// @details The table is built with "hash and displace".  A member name is hashed once, the low bits of
+        /// the hash pick a bucket and the bucket's displacement combined with the high bits picks a slot.  The
+        /// slot holds the index of the only member that can have that name, so a lookup is one hash, a couple of
+        /// array reads and one name comparison no matter how many members are registered.
+        /// @n @n
+        /// The table is built the first time a class is looked up by name.  It can't be built at compile time
+        /// because RegisterMembers isn't required to be constexpr.  If two members share a name there is no
+        /// perfect hash, so the table falls back to comparing every name, which keeps the previous behaviour of
+        /// visiting every member with a matching name.
+        /// @tparam Class The class who's member names will be indexed.
+        ///////////////////////////////////////
+        template<typename Class>
+        class MemberNameTable
+        {
+        public:
+            /// @brief The type of tuple containing member accessors generated for the class.
+            using TupleType = decltype( GetMembers<Class>() );
+            /// @brief The type used to store member indexes in the table.
+            using IndexType = UInt16;
+
+            /// @brief The number of members registered for the class.
+            static constexpr size_t MemberCount = std::tuple_size_v<TupleType>;
+            /// @brief The number of slots, kept at a load of one half or less so displacements are easy to find.
+            static constexpr size_t SlotCount = NextPowerOfTwo( MemberCount * 2 );
+            /// @brief The number of buckets, roughly two members per bucket.
+            static constexpr size_t BucketCount = NextPowerOfTwo( ( MemberCount + 1 ) / 2 );
+            /// @brief The value of a slot that no member is placed in.
+            static constexpr IndexType EmptySlot = std::numeric_limits<IndexType>::max();
+
+            static_assert( MemberCount < EmptySlot, "Too many members registered to index by name." );
+        protected:
+            /// @brief The name of each member, in tuple order.
+            std::array<StringView,MemberCount> Names;
+            /// @brief The member index placed in each slot, or EmptySlot.
+            std::array<IndexType,SlotCount> Slots;
+            /// @brief The displacement used to place every member in each bucket.
+            std::array<IndexType,BucketCount> Displacements;
+            /// @brief Whether or not a perfect hash was found.
+            Boole Perfect = false;
+
+            /// @brief Gets the bucket for a hashed name.
+            /// @param Hash The hash of the name.
+            /// @return Returns the index of the bucket the name belongs to.
+            static size_t GetBucket(const UInt64 Hash) noexcept
+                { return static_cast<size_t>( Hash & ( BucketCount - 1 ) ); }
+            /// @brief Gets the slot for a hashed name.
+            /// @remarks The step is always odd, so every displacement from 0 to SlotCount - 1 gives a different slot.
+            /// @param Hash The hash of the name.
+            /// @param Displacement The displacement of the bucket the name belongs to.
+            /// @return Returns the index of the slot the name belongs in.
+            static size_t GetSlot(const UInt64 Hash, const size_t Displacement) noexcept
+            {
+                const UInt64 Start = Hash >> 32;
+                const UInt64 Step = ( Hash >> 16 ) | 1;
+                return static_cast<size_t>( ( Start + Displacement * Step ) & ( SlotCount - 1 ) );
+            }
+
+            /// @brief Attempts to place every member in its own slot.
+            /// @return Returns true if a perfect hash was found, false if the names can't be perfectly hashed.
+            Boole Build()
+            {
+                this->Slots.fill(EmptySlot);
+                this->Displacements.fill(0);
+                for( size_t First = 0 ; First < MemberCount ; ++First )
+                {
+                    for( size_t Second = First + 1 ; Second < MemberCount ; ++Second )
+                    {
+                        if( this->Names[First] == this->Names[Second] ) {
+                            return false;
+                        }
+                    }
+                }
+
+                std::array<UInt64,MemberCount> Hashes;
+                std::array<size_t,BucketCount> BucketSizes;
+                std::array<size_t,BucketCount> BucketOrder;
+                BucketSizes.fill(0);
+                for( size_t MemberIdx = 0 ; MemberIdx < MemberCount ; ++MemberIdx )
+                {
+                    Hashes[MemberIdx] = HashMemberName(this->Names[MemberIdx]);
+                    ++BucketSizes[ GetBucket(Hashes[MemberIdx]) ];
+                }
+                for( size_t BucketIdx = 0 ; BucketIdx < BucketCount ; ++BucketIdx )
+                    { BucketOrder[BucketIdx] = BucketIdx; }
+                // Place the crowded buckets first while the table is still mostly empty.
+                std::stable_sort(BucketOrder.begin(),BucketOrder.end(),[&BucketSizes](size_t Left, size_t Right) {
+                    return BucketSizes[Left] > BucketSizes[Right];
+                });
+
+                for( const size_t BucketIdx : BucketOrder )
+                {
+                    if( BucketSizes[BucketIdx] == 0 ) {
+                        break;
+                    }
+                    Boole Placed = false;
+                    for( size_t Displacement = 0 ; Displacement < SlotCount && !Placed ; ++Displacement )
+                    {
+                        Placed = true;
+                        for( size_t MemberIdx = 0 ; MemberIdx < MemberCount ; ++MemberIdx )
+                        {
+                            if( GetBucket(Hashes[MemberIdx]) != BucketIdx ) {
+                                continue;
+                            }
+                            IndexType& Slot = this->Slots[ GetSlot(Hashes[MemberIdx],Displacement) ];
+                            if( Slot != EmptySlot ) {
+                                Placed = false;
+                                break;
+                            }
+                            Slot = static_cast<IndexType>(MemberIdx);
+                        }
+                        if( Placed ) {
+                            this->Displacements[BucketIdx] = static_cast<IndexType>(Displacement);
+                        }else{
+                            // Undo the members of this bucket that were placed before the collision.
+                            for( IndexType& Slot : this->Slots )
+                            {
+                                if( Slot != EmptySlot && GetBucket(Hashes[Slot]) == BucketIdx ) {
+                                    Slot = EmptySlot;
+                                }
+                            }
+                        }
+                    }
+                    if( !Placed ) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            /// @brief Class constructor.
+            MemberNameTable()
+            {
+                size_t MemberIdx = 0;
+                TupleForEach([this,&MemberIdx](const auto& Member) {
+                    this->Names[MemberIdx++] = Member.GetName();
+                }, GetMembers<Class>());
+                this->Perfect = Build();
+            }
+        public:
+            /// @brief Gets the table for the class, building it if this is the first use.
+            /// @return Returns a const reference to the name table of the class.
+            static const MemberNameTable& Get()
+            {
+                static const MemberNameTable Table;
+                return Table;
+            }
+
+            /// @brief Gets whether a perfect hash was found for the member names.
+            /// @return Returns false if the class has more than one member with the same name, true otherwise.
+            Boole IsPerfect() const noexcept
+                { return this->Perfect; }
+
+            /// @brief Finds the tuple index of a named member.
+            /// @param Name The name of the member to find.
+            /// @return Returns the index of the first member with the given name, or MemberCount if there isn't one.
+            size_t Find(const StringView Name) const noexcept
+            {
+                if constexpr( MemberCount > 0 ) {
+                    if( this->Perfect ) {
+                        const UInt64 Hash = HashMemberName(Name);
+                        const IndexType MemberIdx = this->Slots[ GetSlot(Hash,this->Displacements[GetBucket(Hash)]) ];
+                        if( MemberIdx != EmptySlot && this->Names[MemberIdx] == Name ) {
+                            return MemberIdx;
+                        }
+                        return MemberCount;
+                    }
+                    for( size_t MemberIdx = 0 ; MemberIdx < MemberCount ; ++MemberIdx )
+                    {
+                        if( this->Names[MemberIdx] == Name ) {
+                            return MemberIdx;
+                        }
+                    }
+                }
+                (void)Name;
+                return MemberCount;
+            }
+        };//MemberNameTable
+
+        /// @brief Invokes a callable with the member at a specific tuple index.
+        /// @tparam Idx The index of the member to invoke with.
+        /// @tparam Tuple The type of tuple holding the members.
+        /// @tparam Funct The type of callable to invoke.
+        /// @param Mems The tuple of members.
+        /// @param ToCall The callable to invoke with the member.
+        template<size_t Idx, typename Tuple, typename Funct>
+        void InvokeForMemberAt(const Tuple& Mems, Funct& ToCall)
+            { ToCall( std::get<Idx>(Mems) ); }
+
+        /// @brief Invokes a callable with the member at a runtime tuple index.
+        /// @details This uses a table of functions indexed by the member index, so it costs one indirect call
+        /// rather than a comparison per member.
+        /// @tparam Funct The type of callable to invoke.
+        /// @tparam Members Variadic template type for the members in the tuple.
+        /// @tparam Idxs An index sequence of every index in the tuple.
+        /// @param Mems The tuple of members.
+        /// @param Index The index of the member to invoke with.  Must be less than the size of the tuple.
+        /// @param ToCall The callable to invoke with the member.
+        template<typename Funct, typename... Members, size_t... Idxs>
+        void InvokeForMemberIdx(const std::tuple<Members...>& Mems, const size_t Index, Funct& ToCall,
+                                std::index_sequence<Idxs...>)
+        {
+            using InvokeFunct = void(*)(const std::tuple<Members...>&, Funct&);
+            static constexpr InvokeFunct JumpTable[] = { &InvokeForMemberAt<Idxs,std::tuple<Members...>,Funct>... };
+            JumpTable[Index](Mems,ToCall);
+        }
+
+        /// @brief Invokes a callable with every registered member of a class that has a specific name.
+        /// @tparam Class The class to search for the named member.
+        /// @tparam Funct The type of callable to invoke.
+        /// @param Name The name of the member to invoke the callable with.
+        /// @param ToCall The callable to invoke with the named member.
+        template<typename Class, typename Funct>
+        void DoForNamedMember(const StringView Name, Funct& ToCall)
+        {
+            using TableType = MemberNameTable<Class>;
+            using TupleType = typename TableType::TupleType;
+            if constexpr( TableType::MemberCount > 0 ) {
+                const TableType& Table = TableType::Get();
+                const TupleType& Mems = MemberHolder<Class,TupleType>::Members;
+                if( Table.IsPerfect() ) {
+                    const size_t Index = Table.Find(Name);
+                    if( Index < TableType::MemberCount ) {
+                        InvokeForMemberIdx(Mems,Index,ToCall,std::make_index_sequence<TableType::MemberCount>{});
+                    }
+                }else{
+                    TupleForEach([&](const auto& Member) {
+                        if( Name == Member.GetName() ) {
+                            ToCall(Member);
+                        }
+                    }, Mems);
+                }
+            }else{
+                (void)Name;
+                (void)ToCall;
+            }
+        }
     }//IntrospectionHelpers
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -864,6 +1175,7 @@ namespace Mezzanine {
     }
 
     /// @brief Invokes a callable for a specific named member on a class.
+    /// @remarks The member is found with a perfect hash of the member names, see IntrospectionHelpers::MemberNameTable.
     /// @tparam Class Provided type that will be searched for the named member.
     /// @tparam MemberType The type of the MemberAccessor that is expected to be passed into the callable.
     /// @tparam Funct Deduced parameter for the callback method to invoke with the named member.
@@ -872,16 +1184,13 @@ namespace Mezzanine {
     template<typename Class, typename MemberType, typename Funct>
     void DoForMember(const StringView Name, Funct&& ToCall)
     {
-        DoForAllMembers<Class>(
-            [&](const auto& Member) {
-                using CurrType = typename std::decay_t<decltype(Member)>::MemberType;
-                if constexpr( std::is_same_v<CurrType,MemberType> ) {
-                    if( Name == Member.GetName() ) {
-                        ToCall(Member);
-                    }
-                }
+        auto TypedCall = [&ToCall](const auto& Member) {
+            using CurrType = typename std::decay_t<decltype(Member)>::MemberType;
+            if constexpr( std::is_same_v<CurrType,MemberType> ) {
+                ToCall(Member);
             }
-        );
+        };
+        IntrospectionHelpers::DoForNamedMember<Class>(Name,TypedCall);
     }
 
     /// @brief Checks to see if a class has a named member.
@@ -891,15 +1200,8 @@ namespace Mezzanine {
     template<typename Class>
     Boole HasMember(const StringView Name)
     {
-        Boole Found = false;
-        DoForAllMembers<Class>(
-            [&](const auto& Member) {
-                if( Name == Member.GetName() ) {
-                    Found = true;
-                }
-            }
-        );
-        return Found;
+        using TableType = IntrospectionHelpers::MemberNameTable<Class>;
+        return TableType::Get().Find(Name) < TableType::MemberCount;
     }
 
     /// @brief Convenience method for getting a specific named member on an object.
@@ -0,0 +1,337 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_IntrospectiveHash_h
+#define Mezz_Foundation_IntrospectiveHash_h
+
+/// @file
+/// @brief Hashing and equality functors for registered classes, generated from their registered members.
+
+#ifndef SWIG
+    #include "BinarySerialization.h"
+    #include "ContainerTools.h"
+    #include "Introspection.h"
+    #include "MurmurHash.h"
+
+    #include <cstring>
+    #include <functional>
+#endif
+
+namespace Mezzanine
+{
+    template<typename Class>
+    struct IntrospectiveHash;
+    template<typename Class>
+    struct IntrospectiveEqual;
+
+    namespace IntrospectiveHashHelpers
+    {
+        using BinarySerializationHelpers::is_pair;
+
+        /// @brief The seed used for every block hashed.
+        static constexpr UInt32 HashSeed = 0x9747B28C;
+
+        /// @brief Hashes a block of bytes.
+        /// @param Bytes The start of the block.
+        /// @param Length The number of bytes in the block.
+        /// @return Returns the first 64 bits of a 128-bit Murmur hash of the block.
+        inline UInt64 HashBytes(const void* Bytes, const SizeType Length) noexcept
+            { return Hashing::MurmurHash3_x64_128(Bytes,Length,HashSeed).Hash[0]; }
+        /// @brief Folds another hash into a running hash.
+        /// @param Hash The running hash.
+        /// @param Value The hash to fold in.
+        /// @return Returns the updated running hash, which depends on the order values are folded in.
+        constexpr UInt64 Combine(UInt64 Hash, const UInt64 Value) noexcept
+        {
+            Hash = ( Hash ^ Value ) * 0x9E3779B97F4A7C15ULL;
+            return Hash ^ ( Hash >> 32 );
+        }
+
+        /// @brief Checks to see if a registered member takes part in hashing and equality.
+        /// @tparam AccessorType The MemberAccessor type of the member to check.
+        /// @return Returns true if the member is not tagged Generated, false otherwise.
+        template<typename AccessorType>
+        constexpr Boole IsHashedMember()
+            { return ( AccessorType::GetTags() & MemberTags::Generated ) == MemberTags::None; }
+        /// @brief Checks to see if a type can be hashed and compared as raw bytes.
+        /// @tparam CheckType The type to check.
+        /// @remarks Registered classes are never bytewise, since they may carry Generated members or bytes that
+        /// aren't registered at all.  They are hashed and compared through their own members instead.
+        /// @return Returns true if equal values of CheckType always have identical bytes, false otherwise.
+        template<typename CheckType>
+        constexpr Boole IsBytewise()
+            { return std::has_unique_object_representations_v<CheckType> && !IsRegistered<CheckType>(); }
+        /// @brief Checks to see if a registered member can be merged with its neighbours into one block.
+        /// @remarks Only classes with a standard layout are merged, so every object of the class has its
+        /// members at the same offsets and is split into the same blocks.
+        /// @tparam Class The class the member belongs to.
+        /// @tparam AccessorType The MemberAccessor type of the member to check.
+        /// @return Returns true if the member is a bytewise data member of a standard layout class.
+        template<typename Class, typename AccessorType>
+        constexpr Boole IsBlockMember()
+        {
+            return std::is_standard_layout_v<Class> &&
+                   AccessorType::IsDirectMember() &&
+                   IsBytewise<typename AccessorType::MemberType>();
+        }
+
+        /// @brief Convenience type for data function detection.
+        /// @tparam Class The class to test.
+        template<typename Class>
+        using DataFunct_t = decltype(std::declval<const Class&>().data());
+        /// @brief Type for is_detected that tests for the existence of data on a class.
+        /// @tparam Class The class that will be checked for the presence of a data function.
+        template<typename Class>
+        using HasData_t = std::is_detected<DataFunct_t,Class>;
+        /// @brief Checks to see if a container stores bytewise elements contiguously.
+        /// @tparam ContainerType The type of container to check.
+        /// @return Returns true if the elements can be hashed and compared as one block.
+        template<typename ContainerType>
+        constexpr Boole IsBytewiseContainer()
+        {
+            if constexpr( HasData_t<ContainerType>::value ) {
+                using ElementType = typename ContainerType::value_type;
+                return IsBytewise<ElementType>() &&
+                       std::is_same_v<DataFunct_t<ContainerType>,const ElementType*>;
+            }else{
+                return false;
+            }
+        }
+
+        /// @brief Convenience type for std::hash detection.
+        /// @tparam Type The type to test.
+        template<typename Type>
+        using StdHash_t = decltype(std::hash<Type>{}(std::declval<const Type&>()));
+        /// @brief Type for is_detected that tests for a usable std::hash specialization.
+        /// @tparam Type The type that will be checked.
+        template<typename Type>
+        using HasStdHash = std::is_detected<StdHash_t,Type>;
+
+        /// @brief Hashes a single value of any supported type.
+        /// @tparam ValueType The deduced type of value to hash.
+        /// @param Value The value to hash.
+        /// @return Returns a 64-bit hash of the value.
+        template<typename ValueType>
+        UInt64 HashValue(const ValueType& Value)
+        {
+            if constexpr( IsBytewise<ValueType>() ) {
+                return HashBytes(&Value,sizeof(ValueType));
+            }else if constexpr( std::is_floating_point_v<ValueType> ) {
+                // Positive and negative zero compare equal, so they need to hash equal.
+                const ValueType Normalized = ( Value == ValueType(0) ? ValueType(0) : Value );
+                return HashBytes(&Normalized,sizeof(ValueType));
+            }else if constexpr( std::is_same_v<ValueType,String> ) {
+                return HashBytes(Value.data(),Value.size());
+            }else if constexpr( IsRegistered<ValueType>() ) {
+                return IntrospectiveHash<ValueType>{}.GetHash(Value);
+            }else if constexpr( is_pair<ValueType>::value ) {
+                return Combine( HashValue(Value.first), HashValue(Value.second) );
+            }else if constexpr( IsBytewiseContainer<ValueType>() ) {
+                using ElementType = typename ValueType::value_type;
+                return Combine( Value.size(), HashBytes(Value.data(),Value.size() * sizeof(ElementType)) );
+            }else if constexpr( IsContainer<ValueType>() ) {
+                UInt64 Hash = Value.size();
+                for( const auto& Element : Value )
+                    { Hash = Combine( Hash, HashValue(Element) ); }
+                return Hash;
+            }else{
+                static_assert( HasStdHash<ValueType>::value, "Type cannot be hashed introspectively." );
+                return std::hash<ValueType>{}(Value);
+            }
+        }
+
+        /// @brief Compares two values of any supported type.
+        /// @tparam ValueType The deduced type of values to compare.
+        /// @param Left The first value to compare.
+        /// @param Right The second value to compare.
+        /// @return Returns true if the values are equal, false otherwise.
+        template<typename ValueType>
+        Boole ValuesEqual(const ValueType& Left, const ValueType& Right)
+        {
+            if constexpr( IsRegistered<ValueType>() ) {
+                return IntrospectiveEqual<ValueType>{}(Left,Right);
+            }else if constexpr( is_pair<ValueType>::value ) {
+                return ValuesEqual(Left.first,Right.first) && ValuesEqual(Left.second,Right.second);
+            }else if constexpr( IsBytewiseContainer<ValueType>() ) {
+                using ElementType = typename ValueType::value_type;
+                return Left.size() == Right.size() &&
+                       ( Left.size() == 0 ||
+                         std::memcmp(Left.data(),Right.data(),Left.size() * sizeof(ElementType)) == 0 );
+            }else if constexpr( IsContainer<ValueType>() && !std::is_same_v<ValueType,String> ) {
+                if( Left.size() != Right.size() ) {
+                    return false;
+                }
+                auto RightIt = Right.begin();
+                for( const auto& LeftElement : Left )
+                {
+                    if( !ValuesEqual(LeftElement,*RightIt) ) {
+                        return false;
+                    }
+                    ++RightIt;
+                }
+                return true;
+            }else{
+                return Left == Right;
+            }
+        }
+    }//IntrospectiveHashHelpers
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A hashing functor for registered classes that hashes every registered member.
+    /// @details Every registered member not tagged Generated is folded into the hash in registration order.
+    /// Generated members are caches of other members, so they can't change the identity of an object.
+    /// @n @n
+    /// In standard layout classes, runs of data members that sit back to back in memory and have unique object
+    /// representations (integers, enums and unregistered PODs of them, but not floats) are hashed as one block with
+    /// a single Murmur call.  Registration order should follow declaration order to get the longest runs.  All
+    /// other members are hashed one at a time; Strings and contiguous containers of bytewise elements are still
+    /// hashed as one block each, registered members are hashed recursively, and anything else falls back to
+    /// std::hash.
+    /// @tparam Class The registered class to hash.
+    ///////////////////////////////////////
+    template<typename Class>
+    struct IntrospectiveHash
+    {
+        static_assert( IsRegistered<Class>(), "IntrospectiveHash requires a registered class." );
+
+        /// @brief Computes the full 64-bit hash of an object.
+        /// @param Object The object to hash.
+        /// @return Returns a 64-bit hash of every hashed member of the object.
+        UInt64 GetHash(const Class& Object) const
+        {
+            using namespace IntrospectiveHashHelpers;
+
+            UInt64 Hash = HashSeed;
+            const char* BlockStart = nullptr;
+            const char* BlockEnd = nullptr;
+            auto FlushBlock = [&]() {
+                if( BlockStart != BlockEnd ) {
+                    Hash = Combine( Hash, HashBytes( BlockStart, static_cast<SizeType>(BlockEnd - BlockStart) ) );
+                }
+                BlockStart = BlockEnd = nullptr;
+            };
+            DoForAllMembers<Class>([&](const auto& Member) {
+                using AccessorType = std::decay_t<decltype(Member)>;
+                using MemberType = typename AccessorType::MemberType;
+                if constexpr( IsHashedMember<AccessorType>() ) {
+                    if constexpr( IsBlockMember<Class,AccessorType>() ) {
+                        const char* Address = reinterpret_cast<const char*>( Member.GetAddress(Object) );
+                        if( Address != BlockEnd ) {
+                            FlushBlock();
+                            BlockStart = Address;
+                        }
+                        BlockEnd = Address + sizeof(MemberType);
+                    }else{
+                        FlushBlock();
+                        Hash = Combine( Hash, HashValue( Member.GetValue(Object) ) );
+                    }
+                }
+            });
+            FlushBlock();
+            return Hash;
+        }
+        /// @brief Computes the hash of an object.
+        /// @param Object The object to hash.
+        /// @return Returns a hash of every hashed member of the object.
+        size_t operator()(const Class& Object) const
+            { return static_cast<size_t>( this->GetHash(Object) ); }
+    };//IntrospectiveHash
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief An equality functor for registered classes that compares every registered member.
+    /// @details This compares exactly the members IntrospectiveHash hashes, so the two can be used together as
+    /// the hasher and key comparison of an unordered container.  Runs of members that IntrospectiveHash hashes
+    /// as one block are compared with a single memcmp.
+    /// @tparam Class The registered class to compare.
+    ///////////////////////////////////////
+    template<typename Class>
+    struct IntrospectiveEqual
+    {
+        static_assert( IsRegistered<Class>(), "IntrospectiveEqual requires a registered class." );
+
+        /// @brief Compares two objects.
+        /// @param Left The first object to compare.
+        /// @param Right The second object to compare.
+        /// @return Returns true if every hashed member is equal, false otherwise.
+        Boole operator()(const Class& Left, const Class& Right) const
+        {
+            using namespace IntrospectiveHashHelpers;
+            if( &Left == &Right ) {
+                return true;
+            }
+
+            const char* LeftBase = reinterpret_cast<const char*>(&Left);
+            const char* RightBase = reinterpret_cast<const char*>(&Right);
+            const char* BlockStart = nullptr;
+            const char* BlockEnd = nullptr;
+            Boole Equal = true;
+            auto FlushBlock = [&]() {
+                if( Equal && BlockStart != BlockEnd ) {
+                    const char* RightStart = RightBase + ( BlockStart - LeftBase );
+                    Equal = std::memcmp( BlockStart, RightStart, static_cast<SizeType>(BlockEnd - BlockStart) ) == 0;
+                }
+                BlockStart = BlockEnd = nullptr;
+            };
+            DoForAllMembers<Class>([&](const auto& Member) {
+                using AccessorType = std::decay_t<decltype(Member)>;
+                using MemberType = typename AccessorType::MemberType;
+                if constexpr( IsHashedMember<AccessorType>() ) {
+                    if( !Equal ) {
+                        return;
+                    }
+                    if constexpr( IsBlockMember<Class,AccessorType>() ) {
+                        const char* Address = reinterpret_cast<const char*>( Member.GetAddress(Left) );
+                        if( Address != BlockEnd ) {
+                            FlushBlock();
+                            BlockStart = Address;
+                        }
+                        BlockEnd = Address + sizeof(MemberType);
+                    }else{
+                        FlushBlock();
+                        Equal = Equal && ValuesEqual( Member.GetValue(Left), Member.GetValue(Right) );
+                    }
+                }
+            });
+            FlushBlock();
+            return Equal;
+        }
+    };//IntrospectiveEqual
+}//Mezzanine
+
+#endif
@@ -0,0 +1,506 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_JSONSerialization_h
+#define Mezz_Foundation_JSONSerialization_h
+
+/// @file
+/// @brief A compact JSON writer and reader driven by the member tuples of the Introspection system.
+
+#ifndef SWIG
+    #include "BinarySerialization.h"
+    #include "MezzException.h"
+    #include "StringTools.h"
+
+    #include <cmath>
+#endif
+
+namespace Mezzanine
+{
+    namespace JSONSerializationHelpers
+    {
+        using BinarySerializationHelpers::AlwaysFalse;
+        using BinarySerializationHelpers::IsRawValue;
+        using BinarySerializationHelpers::IsSkippedMember;
+        using BinarySerializationHelpers::IsStringValue;
+        using BinarySerializationHelpers::is_pair;
+
+        /// @brief The deepest nesting of arrays and objects that will be skipped before the input is rejected.
+        static constexpr SizeType MaxSkipDepth = 256;
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Writing
+
+        /// @brief Appends text verbatim.
+        /// @param Writer The archive to append to.
+        /// @param Text The text to append.
+        inline void WriteText(BinaryArchiveWriter& Writer, const StringView Text)
+            { Writer.WriteBytes(Text.data(),Text.size()); }
+        /// @brief Appends a single character.
+        /// @param Writer The archive to append to.
+        /// @param Char The character to append.
+        inline void WriteChar(BinaryArchiveWriter& Writer, const char Char)
+            { Writer.WriteRaw( static_cast<UInt8>(Char) ); }
+
+        /// @brief Appends a quoted and escaped JSON string.
+        /// @remarks Runs of characters that don't need escaping are copied in one go.
+        /// @param Writer The archive to append to.
+        /// @param Text The unescaped text of the string.
+        inline void WriteJSONString(BinaryArchiveWriter& Writer, const StringView Text)
+        {
+            static constexpr char HexDigits[] = "0123456789abcdef";
+            Writer.Reserve( Text.size() + 2 );
+            WriteChar(Writer,'"');
+            SizeType RunStart = 0;
+            for( SizeType Idx = 0 ; Idx < Text.size() ; ++Idx )
+            {
+                const unsigned char Current = static_cast<unsigned char>( Text[Idx] );
+                if( Current >= 0x20 && Current != '"' && Current != '\\' ) {
+                    continue;
+                }
+                WriteText( Writer, Text.substr(RunStart,Idx - RunStart) );
+                RunStart = Idx + 1;
+                switch( Current )
+                {
+                    case '"':   WriteText(Writer,"\\\"");  break;
+                    case '\\':  WriteText(Writer,"\\\\");  break;
+                    case '\n':  WriteText(Writer,"\\n");   break;
+                    case '\r':  WriteText(Writer,"\\r");   break;
+                    case '\t':  WriteText(Writer,"\\t");   break;
+                    case '\b':  WriteText(Writer,"\\b");   break;
+                    case '\f':  WriteText(Writer,"\\f");   break;
+                    default:
+                    {
+                        const char Escape[] = { '\\', 'u', '0', '0', HexDigits[Current >> 4], HexDigits[Current & 0xF] };
+                        WriteText( Writer, StringView(Escape,sizeof(Escape)) );
+                        break;
+                    }
+                }
+            }
+            WriteText( Writer, Text.substr(RunStart) );
+            WriteChar(Writer,'"');
+        }
+
+        /// @brief Appends an arithmetic value as a JSON number or literal.
+        /// @remarks JSON can't represent infinities or NaN, so those are written as null.
+        /// @tparam ValueType The deduced type of value to write.
+        /// @param Writer The archive to append to.
+        /// @param Value The value to write.
+        template<typename ValueType>
+        void WriteNumber(BinaryArchiveWriter& Writer, const ValueType Value)
+        {
+            if constexpr( std::is_same_v<ValueType,Boole> ) {
+                WriteText( Writer, Value ? "true" : "false" );
+            }else if constexpr( std::is_enum_v<ValueType> ) {
+                WriteNumber( Writer, static_cast< std::underlying_type_t<ValueType> >(Value) );
+            }else{
+                if constexpr( std::is_floating_point_v<ValueType> ) {
+                    if( !std::isfinite(Value) ) {
+                        WriteText(Writer,"null");
+                        return;
+                    }
+                }
+                // Large enough for the round trip text of any arithmetic type.
+                char Buffer[64];
+                const SizeType Length = StringTools::ConvertToChars( Value, Buffer, sizeof(Buffer) );
+                WriteText( Writer, StringView( Buffer, Length ) );
+            }
+        }
+
+        template<typename ValueType>
+        void WriteValue(BinaryArchiveWriter& Writer, const ValueType& Value);
+
+        /// @brief Appends every archived member of a registered class as a JSON object.
+        /// @tparam Class The deduced registered class type being written.
+        /// @param Writer The archive to append to.
+        /// @param Object The object whose members will be written.
+        template<typename Class>
+        void WriteMembers(BinaryArchiveWriter& Writer, const Class& Object)
+        {
+            Boole First = true;
+            WriteChar(Writer,'{');
+            DoForAllMembers<Class>([&](const auto& Member) {
+                using AccessorType = std::decay_t<decltype(Member)>;
+                if constexpr( !IsSkippedMember<AccessorType>() ) {
+                    if( !First ) {
+                        WriteChar(Writer,',');
+                    }
+                    First = false;
+                    WriteJSONString(Writer,Member.GetName());
+                    WriteChar(Writer,':');
+                    WriteValue(Writer,Member.GetValue(Object));
+                }
+            });
+            WriteChar(Writer,'}');
+        }
+
+        /// @brief Appends a single value of any supported type.
+        /// @details Arithmetic values and enums become numbers, Booles become true or false, Strings become
+        /// strings and registered classes become objects.  Pairs become two element arrays.  Associative
+        /// containers with String keys become objects, and other containers become arrays.  Anything else is
+        /// converted with ConvertToString and written as a string.
+        /// @tparam ValueType The deduced type of value to write.
+        /// @param Writer The archive to append to.
+        /// @param Value The value to write.
+        template<typename ValueType>
+        void WriteValue(BinaryArchiveWriter& Writer, const ValueType& Value)
+        {
+            if constexpr( IsRawValue<ValueType>() ) {
+                WriteNumber(Writer,Value);
+            }else if constexpr( IsStringValue<ValueType>() ) {
+                WriteJSONString(Writer,Value);
+            }else if constexpr( IsRegistered<ValueType>() ) {
+                WriteMembers(Writer,Value);
+            }else if constexpr( is_pair<ValueType>::value ) {
+                WriteChar(Writer,'[');
+                WriteValue(Writer,Value.first);
+                WriteChar(Writer,',');
+                WriteValue(Writer,Value.second);
+                WriteChar(Writer,']');
+            }else if constexpr( IsContainer<ValueType>() ) {
+                constexpr Boole AsObject = []() {
+                    if constexpr( IsAssociativeContainer<ValueType>() ) {
+                        return IsStringValue<typename ValueType::key_type>();
+                    }else{
+                        return false;
+                    }
+                }();
+                Boole First = true;
+                WriteChar( Writer, AsObject ? '{' : '[' );
+                for( const auto& Element : Value )
+                {
+                    if( !First ) {
+                        WriteChar(Writer,',');
+                    }
+                    First = false;
+                    if constexpr( AsObject ) {
+                        WriteJSONString(Writer,Element.first);
+                        WriteChar(Writer,':');
+                        WriteValue(Writer,Element.second);
+                    }else{
+                        WriteValue(Writer,Element);
+                    }
+                }
+                WriteChar( Writer, AsObject ? '}' : ']' );
+            }else{
+                WriteJSONString( Writer, StringTools::ConvertToString(Value) );
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Reading
+
+        /// @brief Throws the exception for malformed JSON.
+        /// @param Message A description of what was wrong.
+        [[noreturn]] inline void ThrowMalformed(const char* Message)
+            { MEZZ_EXCEPTION(EncodingCode, Message) }
+
+        /// @brief Gets the next character without consuming it.
+        /// @exception Throws a Mezzanine::Exception::OutOfRangeCode if the archive is exhausted.
+        /// @param Reader The archive to read from.
+        /// @return Returns the next character.
+        inline char PeekChar(BinaryArchiveReader& Reader)
+        {
+            if( Reader.GetRemaining() == 0 ) {
+                Reader.ThrowOverrun();
+            }
+            return static_cast<char>( *Reader.GetCurrent() );
+        }
+        /// @brief Consumes any whitespace and then gets the next character without consuming it.
+        /// @param Reader The archive to read from.
+        /// @return Returns the next character that isn't whitespace.
+        inline char PeekToken(BinaryArchiveReader& Reader)
+        {
+            char Current = PeekChar(Reader);
+            while( Current == ' ' || Current == '\n' || Current == '\r' || Current == '\t' )
+            {
+                Reader.Skip(1);
+                Current = PeekChar(Reader);
+            }
+            return Current;
+        }
+        /// @brief Consumes whitespace and then a specific character.
+        /// @exception Throws a Mezzanine::Exception::EncodingCode if the next character isn't Expected.
+        /// @param Reader The archive to read from.
+        /// @param Expected The character that must come next.
+        inline void ExpectToken(BinaryArchiveReader& Reader, const char Expected)
+        {
+            if( PeekToken(Reader) != Expected ) {
+                ThrowMalformed("Unexpected character in JSON.");
+            }
+            Reader.Skip(1);
+        }
+        /// @brief Consumes a literal keyword if it comes next.
+        /// @param Reader The archive to read from.
+        /// @param Literal The keyword to check for.
+        /// @return Returns true if the keyword was consumed, false if something else comes next.
+        inline Boole TryLiteral(BinaryArchiveReader& Reader, const StringView Literal)
+        {
+            if( PeekToken(Reader) != Literal[0] ) {
+                return false;
+            }
+            if( Reader.GetRemaining() < Literal.size() ||
+                StringView( reinterpret_cast<const char*>( Reader.GetCurrent() ), Literal.size() ) != Literal )
+            {
+                ThrowMalformed("Unknown JSON literal.");
+            }
+            Reader.Skip( Literal.size() );
+            return true;
+        }
+        /// @brief Consumes the characters of a JSON number without converting them.
+        /// @param Reader The archive to read from.
+        /// @return Returns a view of the number text, valid as long as the archive.
+        inline StringView ReadNumberText(BinaryArchiveReader& Reader)
+        {
+            PeekToken(Reader);
+            const char* Start = reinterpret_cast<const char*>( Reader.GetCurrent() );
+            SizeType Length = 0;
+            while( Length < Reader.GetRemaining() )
+            {
+                const char Current = Start[Length];
+                if( !( StringTools::IsDigit(Current) || Current == '-' || Current == '+' ||
+                       Current == '.' || Current == 'e' || Current == 'E' ) )
+                {
+                    break;
+                }
+                ++Length;
+            }
+            if( Length == 0 ) {
+                ThrowMalformed("Expected a JSON number.");
+            }
+            Reader.Skip(Length);
+            return StringView(Start,Length);
+        }
+
+        /// @brief Reads a JSON string and decodes its escapes.
+        /// @param Reader The archive to read from.
+        /// @param Dest The String to replace with the decoded text.
+        void MEZZ_LIB ReadJSONString(BinaryArchiveReader& Reader, String& Dest);
+        /// @brief Consumes a JSON value of any kind without storing it.
+        /// @param Reader The archive to read from.
+        /// @param Depth The current nesting depth, used to reject absurdly nested input.
+        void MEZZ_LIB SkipValue(BinaryArchiveReader& Reader, const SizeType Depth = 0);
+
+        /// @brief Reads the items of a JSON array or object, calling a callable for each one.
+        /// @tparam Funct The type of callable to invoke for each item.
+        /// @param Reader The archive to read from.
+        /// @param Open The character that opens the array or object.
+        /// @param Close The character that closes the array or object.
+        /// @param ReadItem The callable that consumes one item.
+        template<typename Funct>
+        void ReadItems(BinaryArchiveReader& Reader, const char Open, const char Close, Funct&& ReadItem)
+        {
+            ExpectToken(Reader,Open);
+            if( PeekToken(Reader) == Close ) {
+                Reader.Skip(1);
+                return;
+            }
+            while( true )
+            {
+                ReadItem();
+                const char Next = PeekToken(Reader);
+                Reader.Skip(1);
+                if( Next == Close ) {
+                    return;
+                }else if( Next != ',' ) {
+                    ThrowMalformed("Expected a comma between JSON items.");
+                }
+            }
+        }
+
+        template<typename ValueType>
+        void ReadValue(BinaryArchiveReader& Reader, ValueType& Value);
+
+        /// @brief Reads a JSON object into the members of a registered class.
+        /// @remarks Members are matched by name in any order.  Unknown keys and skipped members are ignored, and
+        /// members that are missing or null keep their current value.
+        /// @tparam Class The deduced registered class type being read.
+        /// @param Reader The archive to read from.
+        /// @param Object The object whose members will be assigned.
+        template<typename Class>
+        void ReadMembers(BinaryArchiveReader& Reader, Class& Object)
+        {
+            String Key;
+            ReadItems(Reader,'{','}',[&]() {
+                ReadJSONString(Reader,Key);
+                ExpectToken(Reader,':');
+                Boole Consumed = false;
+                auto ReadMember = [&](const auto& Member) {
+                    using AccessorType = std::decay_t<decltype(Member)>;
+                    if constexpr( !IsSkippedMember<AccessorType>() ) {
+                        if( !TryLiteral(Reader,"null") ) {
+                            typename AccessorType::MemberType Value{};
+                            ReadValue(Reader,Value);
+                            Member.SetValue(Object,std::move(Value));
+                        }
+                        Consumed = true;
+                    }
+                };
+                IntrospectionHelpers::DoForNamedMember<Class>(Key,ReadMember);
+                if( !Consumed ) {
+                    SkipValue(Reader);
+                }
+            });
+        }
+
+        /// @brief Reads a single value of any supported type.
+        /// @remarks Containers are cleared before their elements are read.  A null leaves Value untouched.
+        /// @tparam ValueType The deduced type of value to read.
+        /// @param Reader The archive to read from.
+        /// @param Value The value to assign.
+        template<typename ValueType>
+        void ReadValue(BinaryArchiveReader& Reader, ValueType& Value)
+        {
+            if( TryLiteral(Reader,"null") ) {
+                return;
+            }
+            if constexpr( std::is_same_v<ValueType,Boole> ) {
+                if( TryLiteral(Reader,"true") ) {
+                    Value = true;
+                }else if( TryLiteral(Reader,"false") ) {
+                    Value = false;
+                }else{
+                    ThrowMalformed("Expected a JSON boolean.");
+                }
+            }else if constexpr( IsRawValue<ValueType>() ) {
+                using ParseType = typename std::conditional_t< std::is_enum_v<ValueType>,
+                                                               std::underlying_type<ValueType>,
+                                                               std::common_type<ValueType> >::type;
+                const StringView Text = ReadNumberText(Reader);
+                ParseType Parsed{};
+                if( !StringTools::ConvertFromChars(Text,Parsed) ) {
+                    ThrowMalformed("JSON number could not be converted to the member type.");
+                }
+                Value = static_cast<ValueType>(Parsed);
+            }else if constexpr( IsStringValue<ValueType>() ) {
+                ReadJSONString(Reader,Value);
+            }else if constexpr( IsRegistered<ValueType>() ) {
+                ReadMembers(Reader,Value);
+            }else if constexpr( is_pair<ValueType>::value ) {
+                ExpectToken(Reader,'[');
+                ReadValue(Reader,Value.first);
+                ExpectToken(Reader,',');
+                ReadValue(Reader,Value.second);
+                ExpectToken(Reader,']');
+            }else if constexpr( IsContainer<ValueType>() ) {
+                Value.clear();
+                if constexpr( IsAssociativeContainer<ValueType>() ) {
+                    if constexpr( IsStringValue<typename ValueType::key_type>() ) {
+                        ReadItems(Reader,'{','}',[&]() {
+                            typename ValueType::key_type Key{};
+                            typename ValueType::mapped_type Mapped{};
+                            ReadJSONString(Reader,Key);
+                            ExpectToken(Reader,':');
+                            ReadValue(Reader,Mapped);
+                            AddToContainer(Value,std::move(Key),std::move(Mapped));
+                        });
+                    }else{
+                        ReadItems(Reader,'[',']',[&]() {
+                            std::pair<typename ValueType::key_type,typename ValueType::mapped_type> Element{};
+                            ReadValue(Reader,Element);
+                            AddToContainer(Value,std::move(Element.first),std::move(Element.second));
+                        });
+                    }
+                }else{
+                    ReadItems(Reader,'[',']',[&]() {
+                        typename ValueType::value_type Element{};
+                        ReadValue(Reader,Element);
+                        AddToContainer(Value,std::move(Element));
+                    });
+                }
+            }else{
+                String Text;
+                ReadJSONString(Reader,Text);
+                Value = StringTools::ConvertFromString<ValueType>(Text);
+            }
+        }
+    }//JSONSerializationHelpers
+
+    /// @brief Appends a registered object to a JSON archive as a single object.
+    /// @details Members are written in registration order, keyed by their registered names, skipping those
+    /// tagged Local or Generated.  No whitespace is written.  See JSONSerializationHelpers::WriteValue for how
+    /// each type of member is written.
+    /// @tparam Class The deduced registered class type being written.
+    /// @param Writer The archive to append the JSON text to.
+    /// @param Object The object to write.
+    template<typename Class>
+    void SerializeJSON(BinaryArchiveWriter& Writer, const Class& Object)
+    {
+        static_assert( IsRegistered<Class>(), "Only registered classes can be written as JSON." );
+        JSONSerializationHelpers::WriteMembers(Writer,Object);
+    }
+    /// @brief Writes a registered object as JSON text.
+    /// @tparam Class The deduced registered class type being written.
+    /// @param Object The object to write.
+    /// @return Returns a BinaryBuffer containing exactly the JSON text, without a null terminator.
+    template<typename Class>
+    BinaryBuffer SerializeJSON(const Class& Object)
+    {
+        BinaryArchiveWriter Writer;
+        SerializeJSON(Writer,Object);
+        return Writer.Finish();
+    }
+
+    /// @brief Reads a JSON object into a registered object.
+    /// @details Members may appear in any order.  Unknown keys are skipped and missing members are left as they
+    /// are, so objects written by older or newer versions of a class can still be read.
+    /// @exception Throws a Mezzanine::Exception::EncodingCode if the JSON is malformed or a value doesn't fit its
+    /// member, or a Mezzanine::Exception::OutOfRangeCode if the text ends before the object does.
+    /// @tparam Class The deduced registered class type being read.
+    /// @param Reader The archive to read the JSON text from.
+    /// @param Object The object to assign the read members to.
+    template<typename Class>
+    void DeserializeJSON(BinaryArchiveReader& Reader, Class& Object)
+    {
+        static_assert( IsRegistered<Class>(), "Only registered classes can be read from JSON." );
+        JSONSerializationHelpers::ReadMembers(Reader,Object);
+    }
+    /// @brief Reads JSON text into a registered object.
+    /// @tparam Class The deduced registered class type being read.
+    /// @param Source The buffer containing the JSON text.
+    /// @param Object The object to assign the read members to.
+    template<typename Class>
+    void DeserializeJSON(const BinaryBuffer& Source, Class& Object)
+    {
+        BinaryArchiveReader Reader(Source);
+        DeserializeJSON(Reader,Object);
+    }
+}//Mezzanine
+
+#endif
@@ -0,0 +1,561 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_MessagePackSerialization_h
+#define Mezz_Foundation_MessagePackSerialization_h
+
+/// @file
+/// @brief A compact MessagePack writer and reader driven by the member tuples of the Introspection system.
+
+#ifndef SWIG
+    #include "BinarySerialization.h"
+    #include "MezzException.h"
+    #include "StringTools.h"
+
+    #include <cstring>
+    #include <limits>
+#endif
+
+namespace Mezzanine
+{
+    namespace MessagePackHelpers
+    {
+        using BinarySerializationHelpers::IsRawValue;
+        using BinarySerializationHelpers::IsSkippedMember;
+        using BinarySerializationHelpers::IsStringValue;
+        using BinarySerializationHelpers::is_pair;
+
+        /// @brief The deepest nesting of arrays and maps that will be skipped before the input is rejected.
+        static constexpr SizeType MaxSkipDepth = 256;
+
+        /// @brief The leading bytes of the MessagePack formats used by the writer and reader.
+        enum class Format : UInt8
+        {
+            PositiveFixInt = 0x00,  ///< 0x00 - 0x7F, the value is the byte itself.
+            FixMap = 0x80,          ///< 0x80 - 0x8F, the low 4 bits are the entry count.
+            FixArray = 0x90,        ///< 0x90 - 0x9F, the low 4 bits are the element count.
+            FixStr = 0xA0,          ///< 0xA0 - 0xBF, the low 5 bits are the byte count.
+            Nil = 0xC0,
+            False = 0xC2,
+            True = 0xC3,
+            Bin8 = 0xC4,
+            Bin16 = 0xC5,
+            Bin32 = 0xC6,
+            Ext8 = 0xC7,
+            Ext16 = 0xC8,
+            Ext32 = 0xC9,
+            Float32 = 0xCA,
+            Float64 = 0xCB,
+            UInt8 = 0xCC,
+            UInt16 = 0xCD,
+            UInt32 = 0xCE,
+            UInt64 = 0xCF,
+            Int8 = 0xD0,
+            Int16 = 0xD1,
+            Int32 = 0xD2,
+            Int64 = 0xD3,
+            FixExt1 = 0xD4,
+            FixExt2 = 0xD5,
+            FixExt4 = 0xD6,
+            FixExt8 = 0xD7,
+            FixExt16 = 0xD8,
+            Str8 = 0xD9,
+            Str16 = 0xDA,
+            Str32 = 0xDB,
+            Array16 = 0xDC,
+            Array32 = 0xDD,
+            Map16 = 0xDE,
+            Map32 = 0xDF,
+            NegativeFixInt = 0xE0   ///< 0xE0 - 0xFF, the byte is the value as an Int8.
+        };
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Writing
+
+        /// @brief Appends a format byte followed by an unsigned integer in big-endian byte order.
+        /// @tparam UIntType The unsigned integer type that determines how many bytes are written.
+        /// @param Writer The archive to append to.
+        /// @param Leading The format byte to write first.
+        /// @param Value The integer to write after the format byte.
+        template<typename UIntType>
+        void WriteTagged(BinaryArchiveWriter& Writer, const Format Leading, const UIntType Value)
+        {
+            UInt8 Encoded[ sizeof(UIntType) + 1 ];
+            Encoded[0] = static_cast<UInt8>(Leading);
+            for( SizeType Idx = 0 ; Idx < sizeof(UIntType) ; ++Idx )
+                { Encoded[ sizeof(UIntType) - Idx ] = static_cast<UInt8>( Value >> ( Idx * 8 ) ); }
+            Writer.WriteBytes(Encoded,sizeof(Encoded));
+        }
+        /// @brief Appends a single format byte.
+        /// @param Writer The archive to append to.
+        /// @param Leading The byte to write, which may carry a small value in its low bits.
+        inline void WriteFormat(BinaryArchiveWriter& Writer, const UInt8 Leading)
+            { Writer.WriteRaw(Leading); }
+
+        /// @brief Appends an unsigned integer in the smallest format that can hold it.
+        /// @param Writer The archive to append to.
+        /// @param Value The integer to write.
+        inline void WriteUnsigned(BinaryArchiveWriter& Writer, const UInt64 Value)
+        {
+            if( Value < 0x80 ) {
+                WriteFormat( Writer, static_cast<UInt8>(Value) );
+            }else if( Value <= std::numeric_limits<UInt8>::max() ) {
+                WriteTagged( Writer, Format::UInt8, static_cast<UInt8>(Value) );
+            }else if( Value <= std::numeric_limits<UInt16>::max() ) {
+                WriteTagged( Writer, Format::UInt16, static_cast<UInt16>(Value) );
+            }else if( Value <= std::numeric_limits<UInt32>::max() ) {
+                WriteTagged( Writer, Format::UInt32, static_cast<UInt32>(Value) );
+            }else{
+                WriteTagged( Writer, Format::UInt64, Value );
+            }
+        }
+        /// @brief Appends a signed integer in the smallest format that can hold it.
+        /// @remarks Non-negative values use the unsigned formats, as the MessagePack specification recommends.
+        /// @param Writer The archive to append to.
+        /// @param Value The integer to write.
+        inline void WriteSigned(BinaryArchiveWriter& Writer, const Int64 Value)
+        {
+            if( Value >= 0 ) {
+                WriteUnsigned( Writer, static_cast<UInt64>(Value) );
+            }else if( Value >= -32 ) {
+                WriteFormat( Writer, static_cast<UInt8>(Value) );
+            }else if( Value >= std::numeric_limits<Int8>::min() ) {
+                WriteTagged( Writer, Format::Int8, static_cast<UInt8>(Value) );
+            }else if( Value >= std::numeric_limits<Int16>::min() ) {
+                WriteTagged( Writer, Format::Int16, static_cast<UInt16>(Value) );
+            }else if( Value >= std::numeric_limits<Int32>::min() ) {
+                WriteTagged( Writer, Format::Int32, static_cast<UInt32>(Value) );
+            }else{
+                WriteTagged( Writer, Format::Int64, static_cast<UInt64>(Value) );
+            }
+        }
+        /// @brief Appends the header of a str, array or map with the smallest format that can hold its size.
+        /// @param Writer The archive to append to.
+        /// @param Count The number of bytes, elements or entries that will follow.
+        /// @param Fixed The format byte of the fixed size variant.
+        /// @param FixedLimit The count the fixed size variant can't reach.
+        /// @param Sized8 The format with an 8 bit count, or Format::Nil if there isn't one.
+        /// @param Sized16 The format with a 16 bit count.
+        /// @param Sized32 The format with a 32 bit count.
+        inline void WriteHeader(BinaryArchiveWriter& Writer, const SizeType Count, const Format Fixed,
+                                const SizeType FixedLimit, const Format Sized8, const Format Sized16,
+                                const Format Sized32)
+        {
+            if( Count < FixedLimit ) {
+                WriteFormat( Writer, static_cast<UInt8>( static_cast<SizeType>(Fixed) | Count ) );
+            }else if( Sized8 != Format::Nil && Count <= std::numeric_limits<UInt8>::max() ) {
+                WriteTagged( Writer, Sized8, static_cast<UInt8>(Count) );
+            }else if( Count <= std::numeric_limits<UInt16>::max() ) {
+                WriteTagged( Writer, Sized16, static_cast<UInt16>(Count) );
+            }else if( Count <= std::numeric_limits<UInt32>::max() ) {
+                WriteTagged( Writer, Sized32, static_cast<UInt32>(Count) );
+            }else{
+                MEZZ_EXCEPTION(InvalidLengthCode, "MessagePack can't hold more than 2^32-1 items in one value.")
+            }
+        }
+        /// @brief Appends the header of an array.
+        /// @param Writer The archive to append to.
+        /// @param Count The number of elements that will follow.
+        inline void WriteArrayHeader(BinaryArchiveWriter& Writer, const SizeType Count)
+            { WriteHeader(Writer,Count,Format::FixArray,16,Format::Nil,Format::Array16,Format::Array32); }
+        /// @brief Appends the header of a map.
+        /// @param Writer The archive to append to.
+        /// @param Count The number of key and value pairs that will follow.
+        inline void WriteMapHeader(BinaryArchiveWriter& Writer, const SizeType Count)
+            { WriteHeader(Writer,Count,Format::FixMap,16,Format::Nil,Format::Map16,Format::Map32); }
+        /// @brief Appends a str.
+        /// @param Writer The archive to append to.
+        /// @param Text The UTF-8 text to write.
+        inline void WriteString(BinaryArchiveWriter& Writer, const StringView Text)
+        {
+            WriteHeader(Writer,Text.size(),Format::FixStr,32,Format::Str8,Format::Str16,Format::Str32);
+            Writer.WriteBytes(Text.data(),Text.size());
+        }
+
+        /// @brief Appends an arithmetic or enum value in the smallest format that holds it exactly.
+        /// @remarks float is written as a float32, any other floating point type as a float64.
+        /// @tparam ValueType The deduced type of value to write.
+        /// @param Writer The archive to append to.
+        /// @param Value The value to write.
+        template<typename ValueType>
+        void WriteNumber(BinaryArchiveWriter& Writer, const ValueType Value)
+        {
+            if constexpr( std::is_same_v<ValueType,Boole> ) {
+                WriteFormat( Writer, static_cast<UInt8>( Value ? Format::True : Format::False ) );
+            }else if constexpr( std::is_enum_v<ValueType> ) {
+                WriteNumber( Writer, static_cast< std::underlying_type_t<ValueType> >(Value) );
+            }else if constexpr( std::is_same_v<ValueType,float> ) {
+                UInt32 Bits = 0;
+                std::memcpy(&Bits,&Value,sizeof(Bits));
+                WriteTagged(Writer,Format::Float32,Bits);
+            }else if constexpr( std::is_floating_point_v<ValueType> ) {
+                const double Converted = static_cast<double>(Value);
+                UInt64 Bits = 0;
+                std::memcpy(&Bits,&Converted,sizeof(Bits));
+                WriteTagged(Writer,Format::Float64,Bits);
+            }else if constexpr( std::is_signed_v<ValueType> ) {
+                WriteSigned( Writer, static_cast<Int64>(Value) );
+            }else{
+                WriteUnsigned( Writer, static_cast<UInt64>(Value) );
+            }
+        }
+
+        template<typename ValueType>
+        void WriteValue(BinaryArchiveWriter& Writer, const ValueType& Value);
+
+        /// @brief Appends every archived member of a registered class as a map keyed by member name.
+        /// @tparam Class The deduced registered class type being written.
+        /// @param Writer The archive to append to.
+        /// @param Object The object whose members will be written.
+        template<typename Class>
+        void WriteMembers(BinaryArchiveWriter& Writer, const Class& Object)
+        {
+            SizeType EntryCount = 0;
+            DoForAllMembers<Class>([&EntryCount](const auto& Member) {
+                EntryCount += !IsSkippedMember< std::decay_t<decltype(Member)> >();
+            });
+            WriteMapHeader(Writer,EntryCount);
+            DoForAllMembers<Class>([&](const auto& Member) {
+                using AccessorType = std::decay_t<decltype(Member)>;
+                if constexpr( !IsSkippedMember<AccessorType>() ) {
+                    WriteString(Writer,Member.GetName());
+                    WriteValue(Writer,Member.GetValue(Object));
+                }
+            });
+        }
+
+        /// @brief Appends a single value of any supported type.
+        /// @details Arithmetic values and enums become ints, floats or bools, Strings become strs and registered
+        /// classes become maps.  Pairs become two element arrays.  Associative containers become maps and other
+        /// containers become arrays.  Anything else is converted with ConvertToString and written as a str.
+        /// @tparam ValueType The deduced type of value to write.
+        /// @param Writer The archive to append to.
+        /// @param Value The value to write.
+        template<typename ValueType>
+        void WriteValue(BinaryArchiveWriter& Writer, const ValueType& Value)
+        {
+            if constexpr( IsRawValue<ValueType>() ) {
+                WriteNumber(Writer,Value);
+            }else if constexpr( IsStringValue<ValueType>() ) {
+                WriteString(Writer,Value);
+            }else if constexpr( IsRegistered<ValueType>() ) {
+                WriteMembers(Writer,Value);
+            }else if constexpr( is_pair<ValueType>::value ) {
+                WriteArrayHeader(Writer,2);
+                WriteValue(Writer,Value.first);
+                WriteValue(Writer,Value.second);
+            }else if constexpr( IsContainer<ValueType>() ) {
+                const SizeType Count = static_cast<SizeType>( std::distance(Value.begin(),Value.end()) );
+                if constexpr( IsAssociativeContainer<ValueType>() ) {
+                    WriteMapHeader(Writer,Count);
+                    for( const auto& Element : Value )
+                    {
+                        WriteValue(Writer,Element.first);
+                        WriteValue(Writer,Element.second);
+                    }
+                }else{
+                    WriteArrayHeader(Writer,Count);
+                    for( const auto& Element : Value )
+                        { WriteValue(Writer,Element); }
+                }
+            }else{
+                WriteString( Writer, StringTools::ConvertToString(Value) );
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Reading
+
+        /// @brief Throws the exception for MessagePack that doesn't match what was expected.
+        /// @param Message A description of what was wrong.
+        [[noreturn]] inline void ThrowMismatch(const char* Message)
+            { MEZZ_EXCEPTION(EncodingCode, Message) }
+
+        /// @brief Gets the next format byte without consuming it.
+        /// @exception Throws a Mezzanine::Exception::OutOfRangeCode if the archive is exhausted.
+        /// @param Reader The archive to read from.
+        /// @return Returns the next byte.
+        inline UInt8 PeekFormat(BinaryArchiveReader& Reader)
+        {
+            if( Reader.GetRemaining() == 0 ) {
+                Reader.ThrowOverrun();
+            }
+            return *Reader.GetCurrent();
+        }
+        /// @brief Consumes a nil if it comes next.
+        /// @param Reader The archive to read from.
+        /// @return Returns true if a nil was consumed, false if something else comes next.
+        inline Boole TryNil(BinaryArchiveReader& Reader)
+        {
+            if( PeekFormat(Reader) != static_cast<UInt8>(Format::Nil) ) {
+                return false;
+            }
+            Reader.Skip(1);
+            return true;
+        }
+        /// @brief Reads an unsigned integer in big-endian byte order.
+        /// @tparam UIntType The unsigned integer type that determines how many bytes are read.
+        /// @param Reader The archive to read from.
+        /// @return Returns the integer read.
+        template<typename UIntType>
+        UIntType ReadBigEndian(BinaryArchiveReader& Reader)
+        {
+            UInt8 Encoded[ sizeof(UIntType) ];
+            Reader.ReadBytes(Encoded,sizeof(Encoded));
+            UIntType Value = 0;
+            for( SizeType Idx = 0 ; Idx < sizeof(UIntType) ; ++Idx )
+                { Value = static_cast<UIntType>( ( Value << 8 ) | Encoded[Idx] ); }
+            return Value;
+        }
+
+        /// @brief Reads an integer of any format.
+        /// @exception Throws a Mezzanine::Exception::EncodingCode if the next value isn't an int.
+        /// @param Reader The archive to read from.
+        /// @param Negative Set to true if the value read is negative.
+        /// @return Returns the magnitude of a non-negative value, or the two's complement bits of a negative one.
+        UInt64 MEZZ_LIB ReadInteger(BinaryArchiveReader& Reader, Boole& Negative);
+        /// @brief Reads a float32, float64 or int as a double.
+        /// @exception Throws a Mezzanine::Exception::EncodingCode if the next value isn't a number.
+        /// @param Reader The archive to read from.
+        /// @return Returns the value read.
+        double MEZZ_LIB ReadDouble(BinaryArchiveReader& Reader);
+        /// @brief Reads a str without copying it.
+        /// @exception Throws a Mezzanine::Exception::EncodingCode if the next value isn't a str.
+        /// @param Reader The archive to read from.
+        /// @return Returns a view of the text, valid as long as the archive.
+        StringView MEZZ_LIB ReadStringView(BinaryArchiveReader& Reader);
+        /// @brief Reads the header of an array.
+        /// @exception Throws a Mezzanine::Exception::EncodingCode if the next value isn't an array.
+        /// @param Reader The archive to read from.
+        /// @return Returns the number of elements that follow.
+        SizeType MEZZ_LIB ReadArrayHeader(BinaryArchiveReader& Reader);
+        /// @brief Reads the header of a map.
+        /// @exception Throws a Mezzanine::Exception::EncodingCode if the next value isn't a map.
+        /// @param Reader The archive to read from.
+        /// @return Returns the number of key and value pairs that follow.
+        SizeType MEZZ_LIB ReadMapHeader(BinaryArchiveReader& Reader);
+        /// @brief Consumes a value of any format without storing it.
+        /// @param Reader The archive to read from.
+        /// @param Depth The current nesting depth, used to reject absurdly nested input.
+        void MEZZ_LIB SkipValue(BinaryArchiveReader& Reader, const SizeType Depth = 0);
+
+        /// @brief Reads an int, bool or number into an arithmetic or enum value.
+        /// @exception Throws a Mezzanine::Exception::OutOfRangeCode if an int doesn't fit in ValueType.
+        /// @tparam ValueType The deduced type of value to read.
+        /// @param Reader The archive to read from.
+        /// @param Value The value to assign.
+        template<typename ValueType>
+        void ReadNumber(BinaryArchiveReader& Reader, ValueType& Value)
+        {
+            if constexpr( std::is_same_v<ValueType,Boole> ) {
+                const UInt8 Leading = Reader.ReadRaw<UInt8>();
+                if( Leading == static_cast<UInt8>(Format::True) ) {
+                    Value = true;
+                }else if( Leading == static_cast<UInt8>(Format::False) ) {
+                    Value = false;
+                }else{
+                    ThrowMismatch("Expected a MessagePack bool.");
+                }
+            }else if constexpr( std::is_enum_v<ValueType> ) {
+                std::underlying_type_t<ValueType> Underlying{};
+                ReadNumber(Reader,Underlying);
+                Value = static_cast<ValueType>(Underlying);
+            }else if constexpr( std::is_floating_point_v<ValueType> ) {
+                Value = static_cast<ValueType>( ReadDouble(Reader) );
+            }else{
+                Boole Negative = false;
+                const UInt64 Bits = ReadInteger(Reader,Negative);
+                Boole Fits = false;
+                if constexpr( std::is_signed_v<ValueType> ) {
+                    const Int64 Signed = static_cast<Int64>(Bits);
+                    Fits = ( Negative || Signed >= 0 ) &&
+                           Signed >= static_cast<Int64>( std::numeric_limits<ValueType>::min() ) &&
+                           Signed <= static_cast<Int64>( std::numeric_limits<ValueType>::max() );
+                }else{
+                    Fits = !Negative && Bits <= static_cast<UInt64>( std::numeric_limits<ValueType>::max() );
+                }
+                if( !Fits ) {
+                    MEZZ_EXCEPTION(OutOfRangeCode, "MessagePack int does not fit in the member type.")
+                }
+                Value = static_cast<ValueType>(Bits);
+            }
+        }
+
+        template<typename ValueType>
+        void ReadValue(BinaryArchiveReader& Reader, ValueType& Value);
+
+        /// @brief Reads a map into the members of a registered class.
+        /// @remarks Members are matched by name in any order.  Unknown keys and skipped members are ignored, and
+        /// members that are missing or nil keep their current value.
+        /// @tparam Class The deduced registered class type being read.
+        /// @param Reader The archive to read from.
+        /// @param Object The object whose members will be assigned.
+        template<typename Class>
+        void ReadMembers(BinaryArchiveReader& Reader, Class& Object)
+        {
+            const SizeType EntryCount = ReadMapHeader(Reader);
+            for( SizeType EntryIdx = 0 ; EntryIdx < EntryCount ; ++EntryIdx )
+            {
+                const StringView Key = ReadStringView(Reader);
+                Boole Consumed = false;
+                auto ReadMember = [&](const auto& Member) {
+                    using AccessorType = std::decay_t<decltype(Member)>;
+                    if constexpr( !IsSkippedMember<AccessorType>() ) {
+                        if( !TryNil(Reader) ) {
+                            typename AccessorType::MemberType Value{};
+                            ReadValue(Reader,Value);
+                            Member.SetValue(Object,std::move(Value));
+                        }
+                        Consumed = true;
+                    }
+                };
+                IntrospectionHelpers::DoForNamedMember<Class>(Key,ReadMember);
+                if( !Consumed ) {
+                    SkipValue(Reader);
+                }
+            }
+        }
+
+        /// @brief Reads a single value of any supported type.
+        /// @remarks Containers are cleared before their elements are read.  A nil leaves Value untouched.
+        /// @tparam ValueType The deduced type of value to read.
+        /// @param Reader The archive to read from.
+        /// @param Value The value to assign.
+        template<typename ValueType>
+        void ReadValue(BinaryArchiveReader& Reader, ValueType& Value)
+        {
+            if( TryNil(Reader) ) {
+                return;
+            }
+            if constexpr( IsRawValue<ValueType>() ) {
+                ReadNumber(Reader,Value);
+            }else if constexpr( IsStringValue<ValueType>() ) {
+                Value = ReadStringView(Reader);
+            }else if constexpr( IsRegistered<ValueType>() ) {
+                ReadMembers(Reader,Value);
+            }else if constexpr( is_pair<ValueType>::value ) {
+                if( ReadArrayHeader(Reader) != 2 ) {
+                    ThrowMismatch("Expected a MessagePack array with two elements.");
+                }
+                ReadValue(Reader,Value.first);
+                ReadValue(Reader,Value.second);
+            }else if constexpr( IsContainer<ValueType>() ) {
+                Value.clear();
+                if constexpr( IsAssociativeContainer<ValueType>() ) {
+                    const SizeType Count = ReadMapHeader(Reader);
+                    for( SizeType Idx = 0 ; Idx < Count ; ++Idx )
+                    {
+                        typename ValueType::key_type Key{};
+                        typename ValueType::mapped_type Mapped{};
+                        ReadValue(Reader,Key);
+                        ReadValue(Reader,Mapped);
+                        AddToContainer(Value,std::move(Key),std::move(Mapped));
+                    }
+                }else{
+                    const SizeType Count = ReadArrayHeader(Reader);
+                    if constexpr( ContainerDetect::HasReserve<ValueType>() ) {
+                        // Every element takes at least one byte, which bounds the reservation on hostile input.
+                        Value.reserve( std::min( Count, Reader.GetRemaining() ) );
+                    }
+                    for( SizeType Idx = 0 ; Idx < Count ; ++Idx )
+                    {
+                        typename ValueType::value_type Element{};
+                        ReadValue(Reader,Element);
+                        AddToContainer(Value,std::move(Element));
+                    }
+                }
+            }else{
+                Value = StringTools::ConvertFromString<ValueType>( ReadStringView(Reader) );
+            }
+        }
+    }//MessagePackHelpers
+
+    /// @brief Appends a registered object to a MessagePack archive as a single map.
+    /// @details Members are written in registration order, keyed by their registered names, skipping those
+    /// tagged Local or Generated.  Every value uses the smallest format that holds it exactly.  See
+    /// MessagePackHelpers::WriteValue for how each type of member is written.
+    /// @tparam Class The deduced registered class type being written.
+    /// @param Writer The archive to append the encoded object to.
+    /// @param Object The object to write.
+    template<typename Class>
+    void SerializeMessagePack(BinaryArchiveWriter& Writer, const Class& Object)
+    {
+        static_assert( IsRegistered<Class>(), "Only registered classes can be written as MessagePack." );
+        MessagePackHelpers::WriteMembers(Writer,Object);
+    }
+    /// @brief Writes a registered object as MessagePack.
+    /// @tparam Class The deduced registered class type being written.
+    /// @param Object The object to write.
+    /// @return Returns a BinaryBuffer containing the encoded object.
+    template<typename Class>
+    BinaryBuffer SerializeMessagePack(const Class& Object)
+    {
+        BinaryArchiveWriter Writer;
+        SerializeMessagePack(Writer,Object);
+        return Writer.Finish();
+    }
+
+    /// @brief Reads a MessagePack map into a registered object.
+    /// @details Members may appear in any order.  Unknown keys are skipped and missing members are left as they
+    /// are, so objects written by older or newer versions of a class can still be read.
+    /// @exception Throws a Mezzanine::Exception::EncodingCode if a value has the wrong format for its member, or
+    /// a Mezzanine::Exception::OutOfRangeCode if an int doesn't fit its member or the archive ends before the
+    /// object does.
+    /// @tparam Class The deduced registered class type being read.
+    /// @param Reader The archive to read the encoded object from.
+    /// @param Object The object to assign the read members to.
+    template<typename Class>
+    void DeserializeMessagePack(BinaryArchiveReader& Reader, Class& Object)
+    {
+        static_assert( IsRegistered<Class>(), "Only registered classes can be read from MessagePack." );
+        MessagePackHelpers::ReadMembers(Reader,Object);
+    }
+    /// @brief Reads MessagePack into a registered object.
+    /// @tparam Class The deduced registered class type being read.
+    /// @param Source The buffer containing the encoded object.
+    /// @param Object The object to assign the read members to.
+    template<typename Class>
+    void DeserializeMessagePack(const BinaryBuffer& Source, Class& Object)
+    {
+        BinaryArchiveReader Reader(Source);
+        DeserializeMessagePack(Reader,Object);
+    }
+}//Mezzanine
+
+#endif
@@ -60,8 +60,16 @@ namespace Hashing {
     /// @n@n
     /// The different hashing fuctions are:
     ///   - @ref MurmurHash3_x86_32
+    ///   - @ref MurmurHash3_x86_32_Batch
     ///   - @ref MurmurHash3_x86_128
     ///   - @ref MurmurHash3_x64_128
+    /// @n@n
+    /// Data that arrives in pieces can be hashed without joining the pieces first by
+    /// using @ref MurmurHash3Stream_x86_32, @ref MurmurHash3Stream_x86_128 or
+    /// @ref MurmurHash3Stream_x64_128, which produce the same hashes as the functions above.
+    /// Whole blocks are mixed as soon as they arrive and the bytes of an incomplete block
+    /// are carried over to the next update, so splitting the data at any points produces
+    /// the same hash as hashing all of it at once.
 
     /// @brief A convenience type for the return value of a x86 128-bit Hashing function.
     struct MurmurHashResult_x86_128
@@ -85,6 +93,87 @@ namespace Hashing {
     /// @return Returns a 32-bit Hash of the Key.
     [[nodiscard]]
     UInt32 MurmurHash3_x86_32(const void* Key, const SizeType Length, const UInt32 Seed) noexcept;
+    /// @brief A Murmur hash function for 32-bit platforms that can be evaluated at compile time.
+    /// @remarks Blocks are assembled from the characters in little-endian order, so this produces the same hash
+    /// as the pointer and length overload on little-endian hosts.  Prefer the pointer and length overload for
+    /// data that is only known at runtime, it reads whole blocks at once.
+    /// @param Key The text that will be hashed.
+    /// @param Seed The base number to salt the hash with.
+    /// @return Returns a 32-bit Hash of the Key.
+    [[nodiscard]]
+    constexpr UInt32 MurmurHash3_x86_32(const StringView Key, const UInt32 Seed) noexcept
+    {
+        constexpr UInt32 x86_32_Constant_One = 0xcc9e2d51;
+        constexpr UInt32 x86_32_Constant_Two = 0x1b873593;
+
+        auto Rotate = [](const UInt32 Value, const UInt32 Shift) {
+            return static_cast<UInt32>( ( Value << Shift ) | ( Value >> ( 32 - Shift ) ) );
+        };
+        auto GetByte = [Key](const SizeType Index) {
+            return static_cast<UInt32>( static_cast<UInt8>( Key[Index] ) );
+        };
+
+        const SizeType NumBlocks = Key.size() / 4;
+        UInt32 OutputHash = Seed;
+
+        //----------
+        // Body
+
+        for( SizeType BlockIdx = 0 ; BlockIdx < NumBlocks ; BlockIdx++ )
+        {
+            const SizeType Offset = BlockIdx * 4;
+            UInt32 KeyBlock = GetByte(Offset) | ( GetByte(Offset + 1) << 8 ) |
+                              ( GetByte(Offset + 2) << 16 ) | ( GetByte(Offset + 3) << 24 );
+
+            KeyBlock *= x86_32_Constant_One;
+            KeyBlock = Rotate(KeyBlock,15);
+            KeyBlock *= x86_32_Constant_Two;
+
+            OutputHash ^= KeyBlock;
+            OutputHash = Rotate(OutputHash,13);
+            OutputHash = ( OutputHash * 5 ) + 0xe6546b64;
+        }
+
+        //----------
+        // Tail
+
+        const SizeType TailStart = NumBlocks * 4;
+        UInt32 TailBlock = 0;
+        switch( Key.size() & 3 )
+        {
+            case 3: TailBlock ^= GetByte(TailStart + 2) << 16;  [[fallthrough]];
+            case 2: TailBlock ^= GetByte(TailStart + 1) << 8;   [[fallthrough]];
+            case 1: TailBlock ^= GetByte(TailStart);
+                    TailBlock *= x86_32_Constant_One;
+                    TailBlock = Rotate(TailBlock,15);
+                    TailBlock *= x86_32_Constant_Two;
+                    OutputHash ^= TailBlock;
+        }
+
+        //----------
+        // Finalization
+
+        OutputHash ^= static_cast<UInt32>( Key.size() );
+        OutputHash ^= OutputHash >> 16;
+        OutputHash *= 0x85ebca6b;
+        OutputHash ^= OutputHash >> 13;
+        OutputHash *= 0xc2b2ae35;
+        OutputHash ^= OutputHash >> 16;
+        return OutputHash;
+    }
+    /// @brief Hashes many keys with the 32-bit Murmur hash, several keys at a time.
+    /// @remarks On x86 processors with SSE4.1, AVX2 or AVX-512 the keys are hashed in groups of 4, 8 or 16, one
+    /// key per vector lane, picked at runtime.  Every other platform and any keys left over after the last
+    /// whole group are hashed one at a time.  Each result is identical to @ref MurmurHash3_x86_32 on the same
+    /// key.  Groups are only mixed together as far as their shortest key, so this works best on many keys of
+    /// similar length.
+    /// @param Keys An array of Count pointers to the data that will be hashed.
+    /// @param Lengths An array of Count byte lengths, one for each Key.
+    /// @param Count The number of keys to hash.
+    /// @param Seed The base number to salt every hash with.
+    /// @param Out An array of at least Count elements that the 32-bit Hash of each Key will be written to.
+    void MurmurHash3_x86_32_Batch(const void* const* Keys, const SizeType* Lengths, const SizeType Count,
+                                  const UInt32 Seed, UInt32* Out) noexcept;
     /// @brief A Murmur hash function for 32-bit platforms that produces a 128-bit hash.
     /// @remarks This function can be run on 64-bit platforms.  See @ref murmurhash page for more details.
     /// @param Key A pointer to the data that will be hashed.
@@ -101,6 +190,122 @@ namespace Hashing {
     /// @return Returns a 128-bit Hash of the Key.
     [[nodiscard]]
     MurmurHashResult_x64_128 MurmurHash3_x64_128(const void* Key, const SizeType Length, const UInt32 Seed) noexcept;
+SAVE_WARNING_STATE
+SUPPRESS_CLANG_WARNING("-Wpadded")
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Computes the same hash as @ref MurmurHash3_x86_32 from data that arrives in pieces.
+    /// @details Blocks are 4 bytes, so at most 3 bytes are carried between updates.  Useful for hashing
+    /// identifiers read from a stream without first gathering them into a String.  See @ref murmurhash.
+    ///////////////////////////////////////
+    class MEZZ_LIB MurmurHash3Stream_x86_32
+    {
+    protected:
+        /// @brief The bytes of the incomplete block carried over from earlier updates.
+        UInt8 Pending[4];
+        /// @brief The hash of every whole block so far.
+        UInt32 Hash;
+        /// @brief The number of bytes hashed so far.
+        SizeType TotalLength;
+    public:
+        /// @brief Class constructor.
+        /// @param Seed The base number to salt the hash with.
+        explicit MurmurHash3Stream_x86_32(const UInt32 Seed = 0) noexcept;
+
+        /// @brief Discards everything hashed so far and starts a new hash.
+        /// @param Seed The base number to salt the new hash with.
+        void Reset(const UInt32 Seed) noexcept;
+        /// @brief Adds the next piece of data to the hash.
+        /// @param Data A pointer to the data that will be hashed.
+        /// @param Length The byte length of the Data.
+        void Update(const void* Data, const SizeType Length) noexcept;
+        /// @brief Gets the hash of everything added so far.
+        /// @remarks This doesn't change the stream, more data can still be added afterwards.
+        /// @return Returns a 32-bit Hash of every piece of data added since construction or the last reset.
+        [[nodiscard]]
+        UInt32 Finalize() const noexcept;
+        /// @brief Gets the number of bytes added so far.
+        /// @return Returns the combined byte length of every piece of data added.
+        [[nodiscard]]
+        SizeType GetLength() const noexcept;
+    };//MurmurHash3Stream_x86_32
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Computes the same hash as @ref MurmurHash3_x86_128 from data that arrives in pieces.
+    /// @details Blocks are 16 bytes mixed as four 32-bit lanes, so up to 15 bytes are carried between updates.
+    /// See @ref murmurhash.
+    ///////////////////////////////////////
+    class MEZZ_LIB MurmurHash3Stream_x86_128
+    {
+    protected:
+        /// @brief The bytes of the incomplete block carried over from earlier updates.
+        UInt8 Pending[16];
+        /// @brief The four parts of the hash of every whole block so far.
+        UInt32 State[4];
+        /// @brief The number of bytes hashed so far.
+        SizeType TotalLength;
+    public:
+        /// @brief Class constructor.
+        /// @param Seed The base number to salt the hash with.
+        explicit MurmurHash3Stream_x86_128(const UInt32 Seed = 0) noexcept;
+
+        /// @brief Discards everything hashed so far and starts a new hash.
+        /// @param Seed The base number to salt the new hash with.
+        void Reset(const UInt32 Seed) noexcept;
+        /// @brief Adds the next piece of data to the hash.
+        /// @param Data A pointer to the data that will be hashed.
+        /// @param Length The byte length of the Data.
+        void Update(const void* Data, const SizeType Length) noexcept;
+        /// @brief Gets the hash of everything added so far.
+        /// @remarks This doesn't change the stream, more data can still be added afterwards.
+        /// @return Returns a 128-bit Hash of every piece of data added since construction or the last reset.
+        [[nodiscard]]
+        MurmurHashResult_x86_128 Finalize() const noexcept;
+        /// @brief Gets the number of bytes added so far.
+        /// @return Returns the combined byte length of every piece of data added.
+        [[nodiscard]]
+        SizeType GetLength() const noexcept;
+    };//MurmurHash3Stream_x86_128
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Computes the same hash as @ref MurmurHash3_x64_128 from data that arrives in pieces.
+    /// @details Blocks are 16 bytes mixed as two 64-bit lanes, so up to 15 bytes are carried between updates.
+    /// This is the fastest of the three on 64-bit hosts, prefer it for large files and network payloads.
+    /// See @ref murmurhash.
+    ///////////////////////////////////////
+    class MEZZ_LIB MurmurHash3Stream_x64_128
+    {
+    protected:
+        /// @brief The bytes of the incomplete block carried over from earlier updates.
+        UInt8 Pending[16];
+        /// @brief The two parts of the hash of every whole block so far.
+        UInt64 State[2];
+        /// @brief The number of bytes hashed so far.
+        SizeType TotalLength;
+    public:
+        /// @brief Class constructor.
+        /// @param Seed The base number to salt the hash with.
+        explicit MurmurHash3Stream_x64_128(const UInt32 Seed = 0) noexcept;
+
+        /// @brief Discards everything hashed so far and starts a new hash.
+        /// @param Seed The base number to salt the new hash with.
+        void Reset(const UInt32 Seed) noexcept;
+        /// @brief Adds the next piece of data to the hash.
+        /// @param Data A pointer to the data that will be hashed.
+        /// @param Length The byte length of the Data.
+        void Update(const void* Data, const SizeType Length) noexcept;
+        /// @brief Gets the hash of everything added so far.
+        /// @remarks This doesn't change the stream, more data can still be added afterwards.
+        /// @return Returns a 128-bit Hash of every piece of data added since construction or the last reset.
+        [[nodiscard]]
+        MurmurHashResult_x64_128 Finalize() const noexcept;
+        /// @brief Gets the number of bytes added so far.
+        /// @return Returns the combined byte length of every piece of data added.
+        [[nodiscard]]
+        SizeType GetLength() const noexcept;
+    };//MurmurHash3Stream_x64_128
+
+RESTORE_WARNING_STATE
 }//Hashing
 }//Mezzanine
 
@@ -0,0 +1,101 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_ParallelSerialization_h
+#define Mezz_Foundation_ParallelSerialization_h
+
+/// @file
+/// @brief Tools for serializing large collections in independent chunks on several threads.
+
+#ifndef SWIG
+    #include "DataTypes.h"
+
+    #include <functional>
+    #include <ostream>
+#endif
+
+namespace Mezzanine
+{
+SAVE_WARNING_STATE
+SUPPRESS_CLANG_WARNING("-Wpadded")
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Settings for splitting a collection into chunks that are serialized in parallel.
+    ///////////////////////////////////////
+    struct MEZZ_LIB ParallelChunkOptions
+    {
+        /// @brief The number of items serialized together into one buffer.
+        SizeType ChunkSize = 4096;
+        /// @brief The number of threads serializing chunks, or 0 to use one per hardware thread.
+        SizeType ThreadCount = 0;
+        /// @brief The most chunks that can be serialized but not yet written at once, or 0 for twice the thread
+        /// count.  This bounds memory use to about this many chunks no matter how large the collection is.
+        SizeType MaxChunksInFlight = 0;
+    };//ParallelChunkOptions
+
+RESTORE_WARNING_STATE
+
+    /// @brief Convenience type for the callable that serializes one chunk of a collection.
+    /// @details It is passed the index of the first item in the chunk, the index one past the last item, and the
+    /// buffer to append the serialized items to.  It is called from worker threads, several at a time, so it
+    /// must only read shared state.  The buffer is empty when passed in and its capacity is reused across chunks.
+    using ChunkSerializeFunct = std::function<void(const SizeType Begin, const SizeType End, String& Buffer)>;
+
+    /// @brief Serializes a collection in chunks on several threads and writes the chunks to a stream in order.
+    /// @details The items are split into ranges of ChunkSize.  Worker threads claim ranges in order and serialize
+    /// each into its own buffer, while the calling thread writes finished buffers to the stream strictly in
+    /// range order.  The output is therefore byte for byte the same as serializing every range one after
+    /// another, no matter how many threads are used or how they are scheduled.
+    /// @n @n
+    /// A worker won't start a range more than MaxChunksInFlight ranges ahead of the last one written, so only
+    /// that many buffers are ever alive.  If only one thread would be used, everything runs on the calling thread.
+    /// @exception If ChunkSize is 0, an InvalidLength exception is thrown.  If SerializeChunk throws, the first
+    /// exception is rethrown on the calling thread once the workers have stopped; chunks before the failing one
+    /// may already have been written.
+    /// @param Stream The stream to write the serialized chunks to.
+    /// @param ItemCount The number of items in the collection.
+    /// @param Options The chunk size, thread count and memory bound to use.
+    /// @param SerializeChunk The callable that serializes one range of items into a buffer.
+    void MEZZ_LIB ParallelSerializeChunks(std::ostream& Stream,
+                                          const SizeType ItemCount,
+                                          const ParallelChunkOptions& Options,
+                                          const ChunkSerializeFunct& SerializeChunk);
+}//Mezzanine
+
+#endif
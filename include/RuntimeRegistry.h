@@ -0,0 +1,360 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_RuntimeRegistry_h
+#define Mezz_Foundation_RuntimeRegistry_h
+
+/// @file
+/// @brief A registry of type-erased member tables for looking up registered classes by name at runtime.
+
+#ifndef SWIG
+    #include "Introspection.h"
+    #include "MezzException.h"
+    #include "StaticAny.h"
+
+    #include <typeinfo>
+    #include <unordered_map>
+    #include <vector>
+#endif
+
+namespace Mezzanine
+{
+    /// @brief The type-erased container member values are passed around in by the runtime registry.
+    /// @remarks Values up to 32 bytes are stored inline, larger values spill to a pooled heap allocation.
+    using RuntimeValue = SmallAny<32>;
+
+    namespace RuntimeRegistryHelpers
+    {
+        /// @brief Gets the value of a registered member on a type-erased object.
+        /// @tparam Class The registered class the object is an instance of.
+        /// @tparam Idx The index of the member in the registered members tuple.
+        /// @param Object A pointer to the object to get the member value from.
+        /// @return Returns a RuntimeValue holding a copy of the member value.
+        template<typename Class, size_t Idx>
+        RuntimeValue GetMemberValue(const void* Object)
+        {
+            const auto& Member = std::get<Idx>( GetRegisteredMembers<Class>() );
+            return RuntimeValue( Member.GetValue( *static_cast<const Class*>(Object) ) );
+        }
+        /// @brief Sets the value of a registered member on a type-erased object.
+        /// @exception If the value isn't holding the exact type of the member, a BadCast exception is thrown.
+        /// @tparam Class The registered class the object is an instance of.
+        /// @tparam Idx The index of the member in the registered members tuple.
+        /// @param Object A pointer to the object to set the member value on.
+        /// @param Value The value to assign to the member.
+        template<typename Class, size_t Idx>
+        void SetMemberValue(void* Object, const RuntimeValue& Value)
+        {
+            const auto& Member = std::get<Idx>( GetRegisteredMembers<Class>() );
+            using MemberType = typename std::decay_t<decltype(Member)>::MemberType;
+            Member.SetValue( *static_cast<Class*>(Object), StaticAnyCast<MemberType>(Value) );
+        }
+    }//RuntimeRegistryHelpers
+
+SAVE_WARNING_STATE
+SUPPRESS_CLANG_WARNING("-Wpadded")
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief The type-erased description of a single registered member.
+    ///////////////////////////////////////
+    struct MEZZ_LIB RuntimeMemberInfo
+    {
+        /// @brief Convenience type for the function that gets a member value from an object.
+        using GetterFunct = RuntimeValue(*)(const void* Object);
+        /// @brief Convenience type for the function that sets a member value on an object.
+        using SetterFunct = void(*)(void* Object, const RuntimeValue& Value);
+
+        /// @brief The registered name of the member.
+        StringView Name;
+        /// @brief The type of the member.
+        const std::type_info* Type = nullptr;
+        /// @brief The function that gets the member value from an object.
+        GetterFunct Getter = nullptr;
+        /// @brief The function that sets the member value on an object.
+        SetterFunct Setter = nullptr;
+        /// @brief The metadata tags the member was registered with.
+        MemberTags Tags = MemberTags::None;
+        /// @brief Whether or not the member was registered with a getter.
+        Boole Gettable = false;
+        /// @brief Whether or not the member was registered with a setter.
+        Boole Settable = false;
+    };//RuntimeMemberInfo
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief The type-erased description of a registered class and all of its registered members.
+    /// @details The members are stored in a flat table in registration order, with a hash index from member
+    /// name to table position.  Getting or setting a member by name is one hash lookup and one indirect call.
+    ///////////////////////////////////////
+    class MEZZ_LIB RuntimeClassInfo
+    {
+    public:
+        /// @brief Convenience type for the container storing the member table.
+        using MemberContainer = std::vector<RuntimeMemberInfo>;
+        /// @brief Convenience type for the index from member name to member table position.
+        using IndexContainer = std::unordered_map<StringView,SizeType>;
+    protected:
+        /// @brief The table of every registered member, in registration order.
+        MemberContainer Members;
+        /// @brief The position of each member in the table by name.
+        IndexContainer MemberIndex;
+        /// @brief The registered name of the class.
+        StringView Name;
+        /// @brief The type of the class.
+        const std::type_info* Type = nullptr;
+        /// @brief The size of an instance of the class in bytes.
+        SizeType Size = 0;
+
+        /// @brief Adds every registered member of a class to the member table.
+        /// @tparam Class The registered class being described.
+        /// @tparam Idxs The indexes of every member in the registered members tuple.
+        template<typename Class, size_t... Idxs>
+        void AddMembers(std::index_sequence<Idxs...>)
+            { ( this->AddMember<Class,Idxs>(), ... ); }
+        /// @brief Adds a single registered member of a class to the member table.
+        /// @tparam Class The registered class being described.
+        /// @tparam Idx The index of the member in the registered members tuple.
+        template<typename Class, size_t Idx>
+        void AddMember()
+        {
+            const auto& Member = std::get<Idx>( GetRegisteredMembers<Class>() );
+            using AccessorType = std::decay_t<decltype(Member)>;
+            using MemberType = typename AccessorType::MemberType;
+
+            RuntimeMemberInfo Info;
+            Info.Name = Member.GetName();
+            Info.Type = &typeid(MemberType);
+            Info.Getter = &RuntimeRegistryHelpers::GetMemberValue<Class,Idx>;
+            Info.Setter = &RuntimeRegistryHelpers::SetMemberValue<Class,Idx>;
+            Info.Tags = AccessorType::GetTags();
+            Info.Gettable = Member.HasGetter();
+            Info.Settable = Member.HasSetter();
+            // If a name is registered twice the first member keeps it, matching the order of DoForMember.
+            this->MemberIndex.emplace(Info.Name,this->Members.size());
+            this->Members.push_back(Info);
+        }
+
+        /// @brief Verifies an object is an instance of the described class.
+        /// @exception If the object type doesn't match, a BadCast exception is thrown.
+        /// @param ObjectType The type of the object being accessed.
+        void CheckType(const std::type_info& ObjectType) const;
+    public:
+        /// @brief Class constructor.
+        RuntimeClassInfo() = default;
+
+        /// @brief Builds the description of a registered class.
+        /// @tparam Class The registered class to describe.
+        /// @return Returns a RuntimeClassInfo describing the class and its members.
+        template<typename Class>
+        static RuntimeClassInfo Build()
+        {
+            static_assert( IsRegistered<Class>(), "Only registered classes can be described at runtime." );
+            RuntimeClassInfo Ret;
+            Ret.Name = GetRegisteredName<Class>();
+            Ret.Type = &typeid(Class);
+            Ret.Size = sizeof(Class);
+            Ret.Members.reserve( Mezzanine::GetMemberCount<Class>() );
+            Ret.MemberIndex.reserve( Mezzanine::GetMemberCount<Class>() );
+            Ret.AddMembers<Class>( std::make_index_sequence< Mezzanine::GetMemberCount<Class>() >() );
+            return Ret;
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Class Query
+
+        /// @brief Gets the registered name of the class.
+        /// @return Returns a StringView of the registered name of the class.
+        StringView GetName() const
+            { return this->Name; }
+        /// @brief Gets the type of the class.
+        /// @return Returns the type_info of the class.
+        const std::type_info& GetType() const
+            { return *(this->Type); }
+        /// @brief Gets the size of an instance of the class.
+        /// @return Returns the size of the class in bytes.
+        SizeType GetSize() const
+            { return this->Size; }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Member Query
+
+        /// @brief Gets the number of registered members.
+        /// @return Returns the number of members in the member table.
+        SizeType GetMemberCount() const
+            { return this->Members.size(); }
+        /// @brief Gets the table of registered members.
+        /// @return Returns a const reference to the member table, in registration order.
+        const MemberContainer& GetMembers() const
+            { return this->Members; }
+        /// @brief Gets a member by its position in the table.
+        /// @exception If the index is out of bounds, an OutOfRange exception is thrown.
+        /// @param Index The position of the member in registration order.
+        /// @return Returns a const reference to the member description.
+        const RuntimeMemberInfo& GetMember(const SizeType Index) const;
+        /// @brief Finds a member by name.
+        /// @param MemberName The registered name of the member to find.
+        /// @return Returns a pointer to the member description, or nullptr if no member has that name.
+        const RuntimeMemberInfo* FindMember(const StringView MemberName) const;
+        /// @brief Gets a member by name.
+        /// @exception If no member has that name, an OutOfRange exception is thrown.
+        /// @param MemberName The registered name of the member to get.
+        /// @return Returns a const reference to the member description.
+        const RuntimeMemberInfo& GetMember(const StringView MemberName) const;
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Member Access
+
+        /// @brief Gets the value of a member on a type-erased object.
+        /// @pre Object must point to an instance of the described class.
+        /// @exception If no member has that name, an OutOfRange exception is thrown.
+        /// @param Object A pointer to the object to get the member value from.
+        /// @param MemberName The registered name of the member to get.
+        /// @return Returns a RuntimeValue holding a copy of the member value.
+        RuntimeValue GetValue(const void* Object, const StringView MemberName) const;
+        /// @brief Sets the value of a member on a type-erased object.
+        /// @pre Object must point to an instance of the described class.
+        /// @exception If no member has that name, an OutOfRange exception is thrown.  If the value isn't
+        /// holding the exact type of the member, a BadCast exception is thrown.
+        /// @param Object A pointer to the object to set the member value on.
+        /// @param MemberName The registered name of the member to set.
+        /// @param Value The value to assign to the member.
+        void SetValue(void* Object, const StringView MemberName, const RuntimeValue& Value) const;
+
+        /// @brief Gets the value of a member on an object.
+        /// @exception If the object isn't an instance of the described class, a BadCast exception is thrown.
+        /// If no member has that name, an OutOfRange exception is thrown.
+        /// @tparam Class The type of object to get the member value from.
+        /// @param Object The object to get the member value from.
+        /// @param MemberName The registered name of the member to get.
+        /// @return Returns a RuntimeValue holding a copy of the member value.
+        template<typename Class>
+        RuntimeValue GetValue(const Class& Object, const StringView MemberName) const
+        {
+            this->CheckType( typeid(Class) );
+            return this->GetValue( static_cast<const void*>(&Object), MemberName );
+        }
+        /// @brief Sets the value of a member on an object.
+        /// @exception If the object isn't an instance of the described class or the value isn't holding the
+        /// exact type of the member, a BadCast exception is thrown.  If no member has that name, an OutOfRange
+        /// exception is thrown.
+        /// @tparam Class The type of object to set the member value on.
+        /// @param Object The object to set the member value on.
+        /// @param MemberName The registered name of the member to set.
+        /// @param Value The value to assign to the member.
+        template<typename Class>
+        void SetValue(Class& Object, const StringView MemberName, const RuntimeValue& Value) const
+        {
+            this->CheckType( typeid(Class) );
+            this->SetValue( static_cast<void*>(&Object), MemberName, Value );
+        }
+    };//RuntimeClassInfo
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief An opt-in registry of registered classes that can be looked up by their registered name.
+    /// @details Classes are added with @ref Register, which walks the registered members once and caches a
+    /// RuntimeClassInfo for the class.  After that, tooling that only knows a class name can find the class and
+    /// get or set its members without instantiating any templates, at the cost of one hash lookup for the class
+    /// and one for the member.
+    /// @n @n
+    /// The registry is meant to be filled once at startup.  Registering isn't synchronized, but once every
+    /// class is registered the registry can be queried from any number of threads.
+    ///////////////////////////////////////
+    class MEZZ_LIB RuntimeRegistry
+    {
+    public:
+        /// @brief Convenience type for the container storing the class descriptions.
+        using ClassContainer = std::unordered_map<StringView,RuntimeClassInfo>;
+    protected:
+        /// @brief The description of every registered class by name.
+        ClassContainer Classes;
+
+        /// @brief Stores the description of a class.
+        /// @exception If a different class was already registered with the same name, a BadCast exception is
+        /// thrown.
+        /// @param Info The description of the class to store.
+        /// @return Returns a reference to the stored description.
+        const RuntimeClassInfo& Insert(RuntimeClassInfo&& Info);
+    public:
+        /// @brief Class constructor.
+        RuntimeRegistry() = default;
+
+        /// @brief Gets the registry shared by the whole application.
+        /// @return Returns a reference to the global RuntimeRegistry.
+        static RuntimeRegistry& GetGlobal();
+
+        /// @brief Adds a registered class to the registry.
+        /// @remarks Registering a class more than once is harmless, the existing description is returned.
+        /// @exception If the class has no registered name, an InvalidLength exception is thrown.  If a different
+        /// class was already registered with the same name, a BadCast exception is thrown.
+        /// @tparam Class The registered class to add.
+        /// @return Returns a reference to the cached description of the class.
+        template<typename Class>
+        const RuntimeClassInfo& Register()
+        {
+            const StringView Name = GetRegisteredName<Class>();
+            if( Name.empty() ) {
+                MEZZ_EXCEPTION(InvalidLengthCode, "Classes need a registered name to be looked up at runtime.")
+            }
+            const RuntimeClassInfo* Existing = this->Find(Name);
+            if( Existing != nullptr && Existing->GetType() == typeid(Class) ) {
+                return *Existing;
+            }
+            return this->Insert( RuntimeClassInfo::Build<Class>() );
+        }
+
+        /// @brief Gets the number of classes in the registry.
+        /// @return Returns the number of registered classes.
+        SizeType GetClassCount() const
+            { return this->Classes.size(); }
+        /// @brief Finds a class by name.
+        /// @param Name The registered name of the class to find.
+        /// @return Returns a pointer to the class description, or nullptr if no class has that name.
+        const RuntimeClassInfo* Find(const StringView Name) const;
+        /// @brief Gets a class by name.
+        /// @exception If no class has that name, an OutOfRange exception is thrown.
+        /// @param Name The registered name of the class to get.
+        /// @return Returns a const reference to the class description.
+        const RuntimeClassInfo& Get(const StringView Name) const;
+        /// @brief Removes every class from the registry.
+        void Clear();
+    };//RuntimeRegistry
+
+RESTORE_WARNING_STATE
+}//Mezzanine
+
+#endif
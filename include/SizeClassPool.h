@@ -0,0 +1,211 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_SizeClassPool_h
+#define Mezz_Foundation_SizeClassPool_h
+
+/// @file
+/// @brief This file describes and implements a thread-local free-list for fixed size blocks of memory.
+
+#ifndef SWIG
+    #include "DataTypes.h"
+
+    #include <cstddef>
+    #include <new>
+#endif
+
+namespace Mezzanine
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A free-list of recycled blocks of memory that all have the same size and alignment.
+    /// @details Small objects that are created and destroyed constantly (like the reference counters used by
+    /// CountedPtr) can spend most of their lifetime cost in the general purpose allocator. This keeps blocks that
+    /// were freed in a singly-linked list so they can be handed out again with a pointer swap and without
+    /// calling into the allocator at all.
+    /// @n @n
+    /// Each thread has its own cache, so no locks or atomics are needed on the hot path. Every block is allocated
+    /// on its own with the global operator new, which means a block allocated by one thread can safely be freed by
+    /// another; it just joins the cache of the thread that freed it. Each cache keeps at most MaxCachedBlocks, any
+    /// beyond that are returned to the global allocator. When a thread exits its cache is returned as well.
+    /// @n @n
+    /// There is one pool per size class, not per type, so all types of the same size and alignment share blocks.
+    /// @tparam BlockSize The size in bytes of each block.
+    /// @tparam BlockAlign The alignment of each block.
+    ///////////////////////////////////////////////////////////////////////////////
+    template<SizeType BlockSize, SizeType BlockAlign = alignof(std::max_align_t)>
+    class SizeClassPool
+    {
+    public:
+        /// @brief The most blocks a single thread will keep around for reuse.
+        static constexpr SizeType MaxCachedBlocks = 1024;
+        /// @brief The size of each block handed out after padding it to hold a free-list link.
+        static constexpr SizeType StorageSize = ( BlockSize < sizeof(void*) ? sizeof(void*) : BlockSize );
+        /// @brief Whether or not the blocks need more alignment than operator new provides by default.
+        static constexpr Boole OverAligned = ( BlockAlign > __STDCPP_DEFAULT_NEW_ALIGNMENT__ );
+
+        static_assert( BlockSize > 0, "Blocks must have a size." );
+        static_assert( ( BlockAlign & ( BlockAlign - 1 ) ) == 0, "Block alignment must be a power of 2." );
+    private:
+        /// @brief The header overlaid on a block while it sits in the free-list.
+        struct FreeBlock
+        {
+            /// @brief The next block available for reuse, or nullptr if this is the last.
+            FreeBlock* Next;
+        };//FreeBlock
+
+        /// @brief The per-thread list of blocks ready for reuse.
+        /// @details This is trivially destructible on purpose, so it remains usable while other thread_local
+        /// objects are being destroyed. The CacheReleaser is responsible for emptying it.
+        struct ThreadCache
+        {
+            /// @brief The first free block, or nullptr if the cache is empty.
+            FreeBlock* Head;
+            /// @brief The number of blocks currently in the cache.
+            SizeType Count;
+            /// @brief Set once the thread is exiting, after that blocks go directly to the global allocator.
+            Boole Retired;
+        };//ThreadCache
+
+        /// @brief Returns the blocks in a ThreadCache to the global allocator when its thread exits.
+        struct CacheReleaser
+        {
+            /// @brief Frees every block in the cache of the current thread and retires it.
+            ~CacheReleaser()
+            {
+                SizeClassPool::Trim();
+                SizeClassPool::GetCache().Retired = true;
+            }
+        };//CacheReleaser
+
+        /// @brief Gets the cache of the current thread.
+        /// @return A reference to the free-list for this size class on this thread.
+        static ThreadCache& GetCache() noexcept
+        {
+            static thread_local ThreadCache Cache = { nullptr, 0, false };
+            return Cache;
+        }
+
+        /// @brief Ensures the current thread will return its cached blocks on exit.
+        static void RegisterReleaser() noexcept
+            { static thread_local CacheReleaser Releaser; (void)Releaser; }
+
+        /// @brief Gets a fresh block from the global allocator.
+        /// @return A pointer to an uninitialized block.
+        static void* AllocateBlock()
+        {
+            if constexpr( OverAligned ) {
+                return ::operator new( StorageSize, std::align_val_t(BlockAlign) );
+            }else{
+                return ::operator new( StorageSize );
+            }
+        }
+
+        /// @brief Gives a block back to the global allocator.
+        /// @param Block The block to free.
+        static void DeallocateBlock(void* Block) noexcept
+        {
+            if constexpr( OverAligned ) {
+                ::operator delete( Block, std::align_val_t(BlockAlign) );
+            }else{
+                ::operator delete( Block );
+            }
+        }
+    public:
+        /// @brief Gets a block from the cache of this thread, or from the global allocator if it is empty.
+        /// @exception This can throw std::bad_alloc if the global allocator is used and fails.
+        /// @return A pointer to an uninitialized block of at least BlockSize bytes aligned to BlockAlign.
+        static void* Allocate()
+        {
+            ThreadCache& Cache = GetCache();
+            if( Cache.Head != nullptr ) {
+                FreeBlock* Ret = Cache.Head;
+                Cache.Head = Ret->Next;
+                --Cache.Count;
+                return Ret;
+            }
+            return AllocateBlock();
+        }
+
+        /// @brief Returns a block to the cache of this thread for later reuse.
+        /// @param Block A block acquired from Allocate on any thread, with any object in it already destroyed.
+        static void Deallocate(void* Block) noexcept
+        {
+            if( Block == nullptr ) {
+                return;
+            }
+            ThreadCache& Cache = GetCache();
+            if( Cache.Retired || Cache.Count >= MaxCachedBlocks ) {
+                DeallocateBlock(Block);
+                return;
+            }
+            if( Cache.Head == nullptr ) {
+                RegisterReleaser();
+            }
+            FreeBlock* Freed = ::new(Block) FreeBlock{ Cache.Head };
+            Cache.Head = Freed;
+            ++Cache.Count;
+        }
+
+        /// @brief Gets the amount of blocks waiting for reuse on the current thread.
+        /// @return The number of blocks in the cache of this thread.
+        static SizeType GetCachedCount() noexcept
+            { return GetCache().Count; }
+
+        /// @brief Returns every block cached by the current thread to the global allocator.
+        static void Trim() noexcept
+        {
+            ThreadCache& Cache = GetCache();
+            while( Cache.Head != nullptr )
+            {
+                FreeBlock* Current = Cache.Head;
+                Cache.Head = Current->Next;
+                DeallocateBlock(Current);
+            }
+            Cache.Count = 0;
+        }
+    };//SizeClassPool
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief The SizeClassPool used for objects of a given type.
+    /// @tparam T The type that will be stored in the blocks.
+    template<typename T>
+    using SizeClassPoolFor = SizeClassPool<sizeof(T),alignof(T)>;
+}//Mezzanine
+
+#endif // Mezz_Foundation_SizeClassPool_h
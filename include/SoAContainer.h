@@ -0,0 +1,608 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_SoAContainer_h
+#define Mezz_Foundation_SoAContainer_h
+
+/// @file
+/// @brief A container that stores each registered member of a class in its own contiguous column.
+
+#ifndef SWIG
+    #include "Introspection.h"
+    #include "MezzException.h"
+
+    #include <algorithm>
+    #include <memory>
+#endif
+
+namespace Mezzanine
+{
+    template<typename Class>
+    class SoAContainer;
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A non-owning view of a contiguous run of elements.
+    /// @tparam ElementType The type of element being viewed.
+    ///////////////////////////////////////
+    template<typename ElementType>
+    class SoAColumnSpan
+    {
+    public:
+        /// @brief The type of element being viewed.
+        using value_type = std::remove_const_t<ElementType>;
+        /// @brief The type used to describe the number of elements.
+        using size_type = SizeType;
+        /// @brief The type of iterator used to traverse the elements.
+        using iterator = ElementType*;
+    protected:
+        /// @brief The first element being viewed.
+        ElementType* Data = nullptr;
+        /// @brief The number of elements being viewed.
+        SizeType Count = 0;
+    public:
+        /// @brief Blank constructor.
+        SoAColumnSpan() = default;
+        /// @brief Descriptive constructor.
+        /// @param First The first element to view.
+        /// @param ElementCount The number of elements to view.
+        SoAColumnSpan(ElementType* First, const SizeType ElementCount) noexcept :
+            Data(First),
+            Count(ElementCount)
+            {  }
+
+        /// @brief Gets an element without bounds checking.
+        /// @param Index The index of the element to retrieve.
+        /// @return Returns a reference to the element at the specified index.
+        ElementType& operator[](const SizeType Index) const noexcept
+            { return this->Data[Index]; }
+
+        /// @brief Gets the first element being viewed.
+        /// @return Returns a pointer to the first element, or nullptr if the span is empty.
+        ElementType* data() const noexcept
+            { return this->Data; }
+        /// @brief Gets the number of elements being viewed.
+        /// @return Returns the number of elements in the span.
+        SizeType size() const noexcept
+            { return this->Count; }
+        /// @brief Checks to see if no elements are being viewed.
+        /// @return Returns true if the span is empty, false otherwise.
+        Boole empty() const noexcept
+            { return this->Count == 0; }
+        /// @brief Gets an iterator to the first element.
+        /// @return Returns an iterator to the start of the span.
+        iterator begin() const noexcept
+            { return this->Data; }
+        /// @brief Gets an iterator to one past the last element.
+        /// @return Returns an iterator to the end of the span.
+        iterator end() const noexcept
+            { return this->Data + this->Count; }
+    };//SoAColumnSpan
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A proxy for a single row of an SoAContainer that behaves like an instance of the registered class.
+    /// @details Rows can be passed to GetMemberValue and SetMemberValue in place of an object, in which case the
+    /// named member is read from or written to its column directly.
+    /// @warning A row is invalidated by anything that reallocates its container, like a push_back past the
+    /// current capacity.
+    /// @tparam Class The registered class the container holds.
+    ///////////////////////////////////////
+    template<typename Class>
+    class SoARow
+    {
+    public:
+        /// @brief The type of container the row belongs to.
+        using ContainerType = SoAContainer<Class>;
+    protected:
+        /// @brief The container the row belongs to.
+        ContainerType* Container;
+        /// @brief The index of the row in the container.
+        SizeType Row;
+    public:
+        /// @brief Class constructor.
+        /// @param Owner The container the row belongs to.
+        /// @param RowIndex The index of the row in the container.
+        SoARow(ContainerType* Owner, const SizeType RowIndex) noexcept :
+            Container(Owner),
+            Row(RowIndex)
+            {  }
+
+        /// @brief Gets the index of this row in its container.
+        /// @return Returns the index of the row.
+        SizeType GetIndex() const noexcept
+            { return this->Row; }
+        /// @brief Gets a member of this row by its registration index.
+        /// @tparam Idx The index of the member in the registration tuple.
+        /// @return Returns a reference to the element in the column of the member.
+        template<size_t Idx>
+        auto& Get() const noexcept
+            { return this->Container->template GetElement<Idx>(this->Row); }
+
+        /// @brief Gets the value of a member by its registered name.
+        /// @tparam MemberType The type of the member that will be returned.
+        /// @param Name The name of the member to retrieve.
+        /// @return Returns the value of the member, or a value initialized MemberType if no member of that
+        /// name and type exists.
+        template<typename MemberType>
+        MemberType GetMemberValue(const StringView Name) const
+        {
+            MemberType Ret{};
+            this->Container->DoForNamedElement(this->Row,Name,[&Ret](auto& Element) {
+                if constexpr( std::is_same_v<std::decay_t<decltype(Element)>,MemberType> ) {
+                    Ret = Element;
+                }
+            });
+            return Ret;
+        }
+        /// @brief Sets the value of a member by its registered name.
+        /// @remarks Nothing is assigned if no member of that name and type exists.
+        /// @tparam MemberType The type of the member that will be assigned.
+        /// @tparam ValueType The type of the value to be converted to the member type.
+        /// @param Name The name of the member to assign.
+        /// @param Val The value to assign to the member.
+        template<typename MemberType, typename ValueType>
+        void SetMemberValue(const StringView Name, ValueType&& Val) const
+        {
+            this->Container->DoForNamedElement(this->Row,Name,[&Val](auto& Element) {
+                if constexpr( std::is_same_v<std::decay_t<decltype(Element)>,MemberType> ) {
+                    Element = std::forward<ValueType>(Val);
+                }
+            });
+        }
+
+        /// @brief Copies every registered member of this row to an object.
+        /// @param Object The object to be assigned.
+        void Load(Class& Object) const
+            { this->Container->Load(this->Row,Object); }
+        /// @brief Copies every registered member of an object to this row.
+        /// @param Object The object to copy from.
+        void Store(const Class& Object) const
+            { this->Container->Store(this->Row,Object); }
+    };//SoARow
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A structure-of-arrays container for a registered class.
+    /// @details Instead of storing whole objects, each registered member is stored in its own array.  All of the
+    /// arrays share a capacity and grow together, so row N of every column belongs to the same logical object.
+    /// Processing a single member over every row only touches that member's column, which keeps caches and
+    /// vector units busy with nothing but the data being processed.
+    /// @n @n
+    /// Only the registered members are stored.  Objects are decomposed through their accessors when added and
+    /// rebuilt through their accessors when loaded, so Class must be default constructible, as must every
+    /// member type.
+    /// @tparam Class The registered class to store.
+    ///////////////////////////////////////
+    template<typename Class>
+    class SoAContainer
+    {
+    public:
+        /// @brief The type of tuple containing member accessors generated for the class.
+        using TupleType = decltype( IntrospectionHelpers::GetMembers<Class>() );
+        /// @brief Gets the type of a member stored in a column.
+        /// @tparam Idx The index of the member in the registration tuple.
+        template<size_t Idx>
+        using MemberTypeAt = typename std::tuple_element_t<Idx,TupleType>::MemberType;
+        /// @brief The type of proxy used to access a row.
+        using RowType = SoARow<Class>;
+
+        /// @brief The number of columns, one for each registered member.
+        static constexpr size_t MemberCount = std::tuple_size_v<TupleType>;
+
+        static_assert( MemberCount > 0, "SoAContainer requires a registered class." );
+    protected:
+        /// @brief Gets the type of the storage of every column.
+        /// @tparam Idxs An index sequence of every registered member.
+        template<size_t... Idxs>
+        static auto MakeColumns(std::index_sequence<Idxs...>)
+            -> std::tuple< std::unique_ptr< MemberTypeAt<Idxs>[] >... >;
+        /// @brief Convenience type for the storage of every column.
+        using ColumnTuple = decltype( MakeColumns( std::make_index_sequence<MemberCount>{} ) );
+
+        /// @brief The array of every column.
+        ColumnTuple Columns;
+        /// @brief The number of rows in use.
+        SizeType Count = 0;
+        /// @brief The number of rows allocated in every column.
+        SizeType Capacity = 0;
+
+        /// @brief Moves every column into newly allocated arrays.
+        /// @tparam Idxs An index sequence of every registered member.
+        /// @param NewCapacity The number of rows to allocate.
+        template<size_t... Idxs>
+        void Reallocate(const SizeType NewCapacity, std::index_sequence<Idxs...>)
+        {
+            ColumnTuple NewColumns( std::make_unique< MemberTypeAt<Idxs>[] >(NewCapacity)... );
+            ( std::move( std::get<Idxs>(this->Columns).get(),
+                         std::get<Idxs>(this->Columns).get() + this->Count,
+                         std::get<Idxs>(NewColumns).get() ), ... );
+            this->Columns = std::move(NewColumns);
+            this->Capacity = NewCapacity;
+        }
+        /// @brief Resets a range of unused rows to value initialized members, releasing anything they own.
+        /// @tparam Idxs An index sequence of every registered member.
+        /// @param First The first row to reset.
+        /// @param Last One past the last row to reset.
+        template<size_t... Idxs>
+        void ResetRows(const SizeType First, const SizeType Last, std::index_sequence<Idxs...>)
+        {
+            ( std::fill( std::get<Idxs>(this->Columns).get() + First,
+                         std::get<Idxs>(this->Columns).get() + Last,
+                         MemberTypeAt<Idxs>{} ), ... );
+        }
+        /// @brief Copies the used rows of another container into this one.
+        /// @tparam Idxs An index sequence of every registered member.
+        /// @param Other The container to copy from.
+        template<size_t... Idxs>
+        void CopyRows(const SoAContainer& Other, std::index_sequence<Idxs...>)
+        {
+            ( std::copy( std::get<Idxs>(Other.Columns).get(),
+                         std::get<Idxs>(Other.Columns).get() + Other.Count,
+                         std::get<Idxs>(this->Columns).get() ), ... );
+        }
+        /// @brief Grows every column if there is no room for another row.
+        void GrowIfFull()
+        {
+            if( this->Count == this->Capacity ) {
+                this->reserve( this->Capacity > 0 ? this->Capacity * 2 : 8 );
+            }
+        }
+
+        /// @brief Invokes a callable with the element of a specific column in a row.
+        /// @tparam Idx The index of the column.
+        /// @tparam Funct The type of callable to invoke.
+        /// @param Self The container holding the element.
+        /// @param Row The row of the element.
+        /// @param ToCall The callable to invoke with the element.
+        template<size_t Idx, typename Funct>
+        static void InvokeForElementAt(SoAContainer& Self, const SizeType Row, Funct& ToCall)
+            { ToCall( Self.template GetElement<Idx>(Row) ); }
+        /// @brief Invokes a callable with the element of a runtime column index in a row.
+        /// @tparam Funct The type of callable to invoke.
+        /// @tparam Idxs An index sequence of every registered member.
+        /// @param Column The index of the column.  Must be less than MemberCount.
+        /// @param Row The row of the element.
+        /// @param ToCall The callable to invoke with the element.
+        template<typename Funct, size_t... Idxs>
+        void InvokeForElementIdx(const size_t Column, const SizeType Row, Funct& ToCall, std::index_sequence<Idxs...>)
+        {
+            using InvokeFunct = void(*)(SoAContainer&, const SizeType, Funct&);
+            static constexpr InvokeFunct JumpTable[] = { &SoAContainer::InvokeForElementAt<Idxs,Funct>... };
+            JumpTable[Column](*this,Row,ToCall);
+        }
+    public:
+        /// @brief Class constructor.
+        SoAContainer() = default;
+        /// @brief Copy constructor.
+        /// @param Other The container to copy.
+        SoAContainer(const SoAContainer& Other)
+        {
+            this->reserve(Other.Count);
+            this->CopyRows(Other,std::make_index_sequence<MemberCount>{});
+            this->Count = Other.Count;
+        }
+        /// @brief Move constructor.
+        /// @param Other The container to move from.
+        SoAContainer(SoAContainer&& Other) noexcept :
+            Columns( std::move(Other.Columns) ),
+            Count(Other.Count),
+            Capacity(Other.Capacity)
+        {
+            Other.Count = 0;
+            Other.Capacity = 0;
+        }
+        /// @brief Class destructor.
+        ~SoAContainer() = default;
+
+        /// @brief Copy assignment operator.
+        /// @param Other The container to copy.
+        /// @return Returns a reference to this.
+        SoAContainer& operator=(const SoAContainer& Other)
+        {
+            if( this != &Other ) {
+                SoAContainer Copy(Other);
+                *this = std::move(Copy);
+            }
+            return *this;
+        }
+        /// @brief Move assignment operator.
+        /// @param Other The container to move from.
+        /// @return Returns a reference to this.
+        SoAContainer& operator=(SoAContainer&& Other) noexcept
+        {
+            std::swap(this->Columns,Other.Columns);
+            std::swap(this->Count,Other.Count);
+            std::swap(this->Capacity,Other.Capacity);
+            return *this;
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Size and Capacity
+
+        /// @brief Gets the number of rows in the container.
+        /// @return Returns the number of objects stored.
+        SizeType size() const noexcept
+            { return this->Count; }
+        /// @brief Gets the number of rows that can be stored without reallocating.
+        /// @return Returns the number of rows allocated in every column.
+        SizeType capacity() const noexcept
+            { return this->Capacity; }
+        /// @brief Checks to see if the container holds no rows.
+        /// @return Returns true if the container is empty, false otherwise.
+        Boole empty() const noexcept
+            { return this->Count == 0; }
+        /// @brief Makes sure a number of rows can be stored without reallocating.
+        /// @param NewCapacity The number of rows to make room for.
+        void reserve(const SizeType NewCapacity)
+        {
+            if( NewCapacity > this->Capacity ) {
+                this->Reallocate(NewCapacity,std::make_index_sequence<MemberCount>{});
+            }
+        }
+        /// @brief Changes the number of rows in the container.
+        /// @remarks New rows are assigned from a default constructed Class.
+        /// @param NewSize The number of rows the container should hold.
+        void resize(const SizeType NewSize)
+        {
+            this->reserve(NewSize);
+            if( NewSize > this->Count ) {
+                const Class Default{};
+                for( SizeType Row = this->Count ; Row < NewSize ; ++Row )
+                    { this->Store(Row,Default); }
+            }else{
+                this->ResetRows(NewSize,this->Count,std::make_index_sequence<MemberCount>{});
+            }
+            this->Count = NewSize;
+        }
+        /// @brief Removes every row from the container.
+        /// @remarks The capacity is kept.
+        void clear()
+        {
+            this->ResetRows(0,this->Count,std::make_index_sequence<MemberCount>{});
+            this->Count = 0;
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Rows
+
+        /// @brief Adds a row with the members of an object to the end of the container.
+        /// @param Object The object to copy the members from.
+        void push_back(const Class& Object)
+        {
+            this->GrowIfFull();
+            this->Store(this->Count,Object);
+            ++this->Count;
+        }
+        /// @brief Adds a row assigned from a default constructed Class to the end of the container.
+        /// @return Returns a proxy to the new row.
+        RowType emplace_back()
+        {
+            this->GrowIfFull();
+            this->Store(this->Count,Class{});
+            return RowType(this,this->Count++);
+        }
+        /// @brief Removes the last row of the container.
+        void pop_back()
+        {
+            this->ResetRows(this->Count - 1,this->Count,std::make_index_sequence<MemberCount>{});
+            --this->Count;
+        }
+
+        /// @brief Gets a row without bounds checking.
+        /// @param Row The index of the row to access.
+        /// @return Returns a proxy to the requested row.
+        RowType operator[](const SizeType Row) noexcept
+            { return RowType(this,Row); }
+        /// @brief Gets a row with bounds checking.
+        /// @exception Throws a Mezzanine::Exception::OutOfRangeCode if Row isn't less than the size.
+        /// @param Row The index of the row to access.
+        /// @return Returns a proxy to the requested row.
+        RowType at(const SizeType Row)
+        {
+            if( Row >= this->Count ) {
+                MEZZ_EXCEPTION(OutOfRangeCode, "Attempted access beyond range of SoAContainer.")
+            }
+            return RowType(this,Row);
+        }
+
+        /// @brief Copies every registered member of a row to an object.
+        /// @param Row The index of the row to copy from.
+        /// @param Object The object to be assigned.
+        void Load(const SizeType Row, Class& Object) const
+        {
+            const SoAContainer* Self = this;
+            DoForAllMembersIdx([&](const auto& Member, auto Idx) {
+                Member.SetValue(Object,Self->template GetElement<decltype(Idx)::value>(Row));
+            });
+        }
+        /// @brief Rebuilds an object from a row.
+        /// @param Row The index of the row to copy from.
+        /// @return Returns a new object with every registered member assigned from the row.
+        Class Load(const SizeType Row) const
+        {
+            Class Ret{};
+            this->Load(Row,Ret);
+            return Ret;
+        }
+        /// @brief Copies every registered member of an object to a row.
+        /// @param Row The index of the row to assign.
+        /// @param Object The object to copy from.
+        void Store(const SizeType Row, const Class& Object)
+        {
+            DoForAllMembersIdx([&](const auto& Member, auto Idx) {
+                this->template GetElement<decltype(Idx)::value>(Row) = Member.GetValue(Object);
+            });
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Columns
+
+        /// @brief Gets a single element of a column.
+        /// @tparam Idx The index of the member in the registration tuple.
+        /// @param Row The row of the element.
+        /// @return Returns a reference to the element.
+        template<size_t Idx>
+        MemberTypeAt<Idx>& GetElement(const SizeType Row) noexcept
+            { return std::get<Idx>(this->Columns)[Row]; }
+        /// @brief Gets a single element of a column.
+        /// @tparam Idx The index of the member in the registration tuple.
+        /// @param Row The row of the element.
+        /// @return Returns a const reference to the element.
+        template<size_t Idx>
+        const MemberTypeAt<Idx>& GetElement(const SizeType Row) const noexcept
+            { return std::get<Idx>(this->Columns)[Row]; }
+
+        /// @brief Gets every element of a column.
+        /// @tparam Idx The index of the member in the registration tuple.
+        /// @return Returns a span of the column for every row in the container.
+        template<size_t Idx>
+        SoAColumnSpan< MemberTypeAt<Idx> > GetColumn() noexcept
+            { return { std::get<Idx>(this->Columns).get(), this->Count }; }
+        /// @brief Gets every element of a column.
+        /// @tparam Idx The index of the member in the registration tuple.
+        /// @return Returns a const span of the column for every row in the container.
+        template<size_t Idx>
+        SoAColumnSpan< const MemberTypeAt<Idx> > GetColumn() const noexcept
+            { return { std::get<Idx>(this->Columns).get(), this->Count }; }
+        /// @brief Gets every element of a column by the registered name of its member.
+        /// @tparam MemberType The type of the member.
+        /// @param Name The name of the member.
+        /// @return Returns a span of the column, or an empty span if no member of that name and type exists.
+        template<typename MemberType>
+        SoAColumnSpan<MemberType> GetColumn(const StringView Name)
+        {
+            MemberType* First = nullptr;
+            if( this->Capacity > 0 ) {
+                this->DoForNamedElement(0,Name,[&First](auto& Element) {
+                    if constexpr( std::is_same_v<std::decay_t<decltype(Element)>,MemberType> ) {
+                        First = &Element;
+                    }
+                });
+            }
+            return { First, First != nullptr ? this->Count : 0 };
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Iteration
+
+        /// @brief Invokes a callable with every registered member and its index.
+        /// @tparam Funct The type of callable to invoke.  It will be passed the member accessor and an
+        /// std::integral_constant holding the index of the member.
+        /// @param ToCall The callable to invoke for every member.
+        template<typename Funct>
+        static void DoForAllMembersIdx(Funct&& ToCall)
+        {
+            SoAContainer::DoForAllMembersIdxImpl(ToCall,GetRegisteredMembers<Class>(),
+                                                 std::make_index_sequence<MemberCount>{});
+        }
+        /// @brief Invokes a callable with the element of a named member in a row.
+        /// @remarks The member is found with the perfect hash of the member names of the class.  Nothing is
+        /// invoked if there is no member with that name.
+        /// @tparam Funct The type of callable to invoke.  It will be passed a non-const reference to the element.
+        /// @param Row The row of the element.
+        /// @param Name The name of the member.
+        /// @param ToCall The callable to invoke with the element.
+        template<typename Funct>
+        void DoForNamedElement(const SizeType Row, const StringView Name, Funct&& ToCall)
+        {
+            const size_t Column = IntrospectionHelpers::MemberNameTable<Class>::Get().Find(Name);
+            if( Column < MemberCount ) {
+                this->InvokeForElementIdx(Column,Row,ToCall,std::make_index_sequence<MemberCount>{});
+            }
+        }
+    private:
+        /// @brief Implementation of DoForAllMembersIdx.
+        /// @tparam Funct The type of callable to invoke.
+        /// @tparam Idxs An index sequence of every registered member.
+        /// @param ToCall The callable to invoke for every member.
+        /// @param Mems The tuple of registered members.
+        template<typename Funct, size_t... Idxs>
+        static void DoForAllMembersIdxImpl(Funct& ToCall, const TupleType& Mems, std::index_sequence<Idxs...>)
+            { ( ToCall( std::get<Idxs>(Mems), std::integral_constant<size_t,Idxs>{} ), ... ); }
+    };//SoAContainer
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // Introspection Overloads
+
+    /// @brief Gets a specific named member of a row in an SoAContainer.
+    /// @tparam MemberType The type of the member that will be returned.
+    /// @tparam Class The class type stored in the container.
+    /// @param Row The row to get the value from.
+    /// @param Name The name of the member to retrieve.
+    /// @return Returns the value of the member, or a value initialized MemberType if it doesn't exist.
+    template<typename MemberType, typename Class>
+    MemberType GetMemberValue(const SoARow<Class>& Row, const StringView Name)
+        { return Row.template GetMemberValue<MemberType>(Name); }
+    /// @brief Gets a specific named member of a row in an SoAContainer.
+    /// @tparam MemberType The type of the member that will be returned.
+    /// @tparam Class The class type stored in the container.
+    /// @param Row The row to get the value from.
+    /// @param Name The name of the member to retrieve.
+    /// @return Returns the value of the member, or a value initialized MemberType if it doesn't exist.
+    template<typename MemberType, typename Class>
+    MemberType GetMemberValue(SoARow<Class>& Row, const StringView Name)
+        { return Row.template GetMemberValue<MemberType>(Name); }
+
+    /// @brief Sets the value of a specific named member of a row in an SoAContainer.
+    /// @tparam MemberType The type of the member that will be assigned.
+    /// @tparam Class The class type stored in the container.
+    /// @tparam ValueType The type of the value to be converted to the named member type.
+    /// @param Row The row to set the value on.
+    /// @param Name The name of the member to set.
+    /// @param Val The value that will be used to set the named member.
+    template<typename MemberType,
+             typename Class,
+             typename ValueType,
+             typename = std::enable_if_t< std::is_convertible_v<ValueType,MemberType> >>
+    void SetMemberValue(const SoARow<Class>& Row, const StringView Name, ValueType&& Val)
+        { Row.template SetMemberValue<MemberType>(Name,std::forward<ValueType>(Val)); }
+    /// @brief Sets the value of a specific named member of a row in an SoAContainer.
+    /// @tparam MemberType The type of the member that will be assigned.
+    /// @tparam Class The class type stored in the container.
+    /// @tparam ValueType The type of the value to be converted to the named member type.
+    /// @param Row The row to set the value on.
+    /// @param Name The name of the member to set.
+    /// @param Val The value that will be used to set the named member.
+    template<typename MemberType,
+             typename Class,
+             typename ValueType,
+             typename = std::enable_if_t< std::is_convertible_v<ValueType,MemberType> >>
+    void SetMemberValue(SoARow<Class>& Row, const StringView Name, ValueType&& Val)
+        { Row.template SetMemberValue<MemberType>(Name,std::forward<ValueType>(Val)); }
+}//Mezzanine
+
+#endif
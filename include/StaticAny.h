@@ -46,35 +46,29 @@
 #ifndef SWIG
     #include "DataTypes.h"
     #include "MezzException.h"
+    #include "SizeClassPool.h"
+
+    #include <algorithm>
+    #include <cstring>
 #endif
 
 namespace Mezzanine
 {
     // Forward Declares
-    template<size_t AnySize,size_t AnyAlign>
+    template<size_t AnySize,size_t AnyAlign,Boole AnyHeapSpill>
     class StaticAny;
 
-    template<class ElementType, size_t AnySize, size_t AnyAlign>
-    ElementType& StaticAnyCast(StaticAny<AnySize,AnyAlign>& Any);
-
-    template<class ElementType, size_t AnySize, size_t AnyAlign>
-    const ElementType& StaticAnyCast(const StaticAny<AnySize,AnyAlign>& Any);
+    template<class ElementType, size_t AnySize, size_t AnyAlign, Boole AnyHeapSpill>
+    ElementType& StaticAnyCast(StaticAny<AnySize,AnyAlign,AnyHeapSpill>& Any);
 
-    template<class ElementType, size_t AnySize, size_t AnyAlign>
-    ElementType* StaticAnyCast(StaticAny<AnySize,AnyAlign>* Any);
+    template<class ElementType, size_t AnySize, size_t AnyAlign, Boole AnyHeapSpill>
+    const ElementType& StaticAnyCast(const StaticAny<AnySize,AnyAlign,AnyHeapSpill>& Any);
 
-    template<class ElementType, size_t AnySize, size_t AnyAlign>
-    const ElementType* StaticAnyCast(const StaticAny<AnySize,AnyAlign>* Any);
+    template<class ElementType, size_t AnySize, size_t AnyAlign, Boole AnyHeapSpill>
+    ElementType* StaticAnyCast(StaticAny<AnySize,AnyAlign,AnyHeapSpill>* Any);
 
-    /// @brief A list of operations that can be done on the storage of a StaticAny.
-    enum class StaticAnyOperations
-    {
-        QueryType, ///< The operation that will retrieve the type stored by a StaticAny.
-        QuerySize, ///< The operation that will retrieve the size of the object stored by a StaticAny.
-        Copy,      ///< The operation that will copy the object stored by a StaticAny.
-        Move,      ///< The operation that will move the object stored by a StaticAny.
-        Destroy    ///< The operation that will destroy the object stored by a StaticAny.
-    };
+    template<class ElementType, size_t AnySize, size_t AnyAlign, Boole AnyHeapSpill>
+    const ElementType* StaticAnyCast(const StaticAny<AnySize,AnyAlign,AnyHeapSpill>* Any);
 
     /// @brief A simple type trait to help identify static_any types.
     /// @tparam ElementType Can be anything.  Doesn't matter.
@@ -87,10 +81,11 @@ namespace Mezzanine
     /// @brief A simple type trait to help identify static_any types.
     /// @tparam CheckSize The size of the StaticAny.  This is a deduced parameter.
     /// @tparam CheckAlign The alignment of the StaticAny storage.  This is a deduced parameter.
+    /// @tparam CheckHeapSpill Whether the StaticAny can store large elements on the heap.  This is a deduced parameter.
     /// @details If the type being checked is a StaticAny, this is the overload that will
     /// be deemed the best fit and used.
-    template<size_t CheckSize, size_t CheckAlign>
-    struct is_static_any< StaticAny<CheckSize,CheckAlign> > : public std::true_type
+    template<size_t CheckSize, size_t CheckAlign, Boole CheckHeapSpill>
+    struct is_static_any< StaticAny<CheckSize,CheckAlign,CheckHeapSpill> > : public std::true_type
     {  };
 
     /// @brief Similar to is_static_any but will decay the ElementType prior to checking.
@@ -121,61 +116,166 @@ namespace Mezzanine
     /// @brief A namespace for utilities that facilitate the operation of the StaticAny.
     namespace StaticAnyHelpers
     {
-        /// @brief Umbrella function housing our type-specific operations.
-        /// @details This function performs one of multiple operations, as determined by the first
-        /// parameter.  The function template type is used for type storage while the StaticAny
-        /// instance holds a type-erased pointer to the function.  Having multiple operations in
-        /// one function helps reduce the need for multiple function pointers on the StaticAny.
-        /// @tparam ElementType The type of element to be stored/managed by the StaticAny using
-        /// this function.
-        /// @param Op An enum value specifying the operation to be performed.
-        /// @param AnyStorage A void pointer to the storage space of the StaticAny being operated
-        /// on.  This parameter is is ignored by QueryType and QuerySize operations.
-        /// @param Datum A pointer to the data to be used or populated.  This parameter is ignored by
-        /// the Destroy operation.  With the Copy and Move operations this parameter should be the
-        /// StaticAny being Copied/Moved from (the source of the Copy/Move).
+        /// @brief Copy constructs an element from another element of the same type.
+        /// @tparam ElementType The type of element being copied.
+        /// @param Dest Uninitialized storage for the new element.
+        /// @param Source The element to copy.
         template<class ElementType>
-        void Operation(const StaticAnyOperations Op, void* AnyStorage, void* Datum)
+        void CopyElement(void* Dest, const void* Source)
         {
-            switch( Op )
-            {
-                case StaticAnyOperations::QueryType:
-                {
-                    *reinterpret_cast<const std::type_info**>(Datum) = &typeid(ElementType);
-                    break;
-                }
-                case StaticAnyOperations::QuerySize:
-                {
-                    *reinterpret_cast<size_t*>(Datum) = sizeof(ElementType);
-                    break;
-                }
-                case StaticAnyOperations::Copy:
-                {
-                    ElementType* CastedElement = reinterpret_cast<ElementType*>(AnyStorage);
-                    ElementType* OtherElement = reinterpret_cast<ElementType*>(Datum);
-                    assert(CastedElement);
-                    assert(OtherElement);
-                    ::new (CastedElement) ElementType(*OtherElement);
-                    break;
-                }
-                case StaticAnyOperations::Move:
-                {
-                    ElementType* CastedElement = reinterpret_cast<ElementType*>(AnyStorage);
-                    ElementType* OtherElement = reinterpret_cast<ElementType*>(Datum);
-                    assert(CastedElement);
-                    assert(OtherElement);
-                    ::new (CastedElement) ElementType( std::move(*OtherElement) );
-                    break;
-                }
-                case StaticAnyOperations::Destroy:
-                {
-                    ElementType* CastedElement = reinterpret_cast<ElementType*>(AnyStorage);
-                    CastedElement->~ElementType();
-                    break;
-                }
+            assert(Dest);
+            assert(Source);
+            ::new (Dest) ElementType( *reinterpret_cast<const ElementType*>(Source) );
+        }
+
+        /// @brief Move constructs an element from another element of the same type.
+        /// @tparam ElementType The type of element being moved.
+        /// @param Dest Uninitialized storage for the new element.
+        /// @param Source The element to move from, it is left alive in a moved-from state.
+        template<class ElementType>
+        void MoveElement(void* Dest, void* Source)
+        {
+            assert(Dest);
+            assert(Source);
+            ::new (Dest) ElementType( std::move( *reinterpret_cast<ElementType*>(Source) ) );
+        }
+
+        /// @brief Destroys an element.
+        /// @tparam ElementType The type of element being destroyed.
+        /// @param Element The element to destroy.
+        template<class ElementType>
+        void DestroyElement(void* Element)
+            { reinterpret_cast<ElementType*>(Element)->~ElementType(); }
+
+        /// @brief The largest element that will be placed in a pooled size class when it is stored on the heap.
+        constexpr size_t MaxPooledElementSize = 256;
+
+        /// @brief Gets the size class used for an element stored on the heap.
+        /// @param Size The size of the element.
+        /// @return Returns the next power of 2 equal to or larger than Size, with a minimum of 16.
+        constexpr size_t GetSpillSizeClass(const size_t Size) noexcept
+        {
+            size_t Ret = 16;
+            while( Ret < Size )
+                { Ret *= 2; }
+            return Ret;
+        }
+
+        /// @brief Allocates uninitialized heap storage for an element.
+        /// @details Elements up to MaxPooledElementSize share a SizeClassPool per power of 2 size, so creating and
+        /// destroying them repeatedly doesn't touch the global allocator.  Larger elements use operator new.
+        /// @tparam ElementType The type of element the storage is for.
+        /// @return Returns a pointer to storage suitable for an ElementType.
+        template<class ElementType>
+        void* AllocateElement()
+        {
+            constexpr size_t ElementAlign = std::max( alignof(ElementType), alignof(std::max_align_t) );
+            if constexpr( sizeof(ElementType) <= MaxPooledElementSize ) {
+                return SizeClassPool<GetSpillSizeClass(sizeof(ElementType)),ElementAlign>::Allocate();
+            }else if constexpr( ElementAlign > __STDCPP_DEFAULT_NEW_ALIGNMENT__ ) {
+                return ::operator new( sizeof(ElementType), std::align_val_t(ElementAlign) );
+            }else{
+                return ::operator new( sizeof(ElementType) );
             }
         }
 
+        /// @brief Frees heap storage allocated with AllocateElement.
+        /// @tparam ElementType The type of element the storage was for.
+        /// @param Element The storage to free, the element in it must already be destroyed.
+        template<class ElementType>
+        void DeallocateElement(void* Element) noexcept
+        {
+            constexpr size_t ElementAlign = std::max( alignof(ElementType), alignof(std::max_align_t) );
+            if constexpr( sizeof(ElementType) <= MaxPooledElementSize ) {
+                SizeClassPool<GetSpillSizeClass(sizeof(ElementType)),ElementAlign>::Deallocate(Element);
+            }else if constexpr( ElementAlign > __STDCPP_DEFAULT_NEW_ALIGNMENT__ ) {
+                ::operator delete( Element, std::align_val_t(ElementAlign) );
+            }else{
+                ::operator delete( Element );
+            }
+        }
+
+        /// @brief Gets the type information of an element type.
+        /// @tparam ElementType The type to get information on.
+        /// @return Returns a const reference to the std::type_info of ElementType.
+        template<class ElementType>
+        const std::type_info& GetElementType() noexcept
+            { return typeid(ElementType); }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        /// @brief A table of the type-specific operations a StaticAny needs to manage an element.
+        /// @details One of these exists per element type, and a StaticAny storing an element points to the table
+        /// for that type. Each operation is a direct function pointer, so using one costs a single indirect call.
+        /// The trait flags allow the StaticAny to skip the call entirely for types that don't need it, such as a
+        /// memcpy instead of a copy constructor call for trivially copyable types.
+        ///////////////////////////////////////
+        struct VTable
+        {
+            /// @brief Function pointer type for retrieving the type of the element.
+            using TypeFunct = const std::type_info& (*)() noexcept;
+            /// @brief Function pointer type for copying an element into uninitialized storage.
+            using CopyFunct = void(*)(void* Dest, const void* Source);
+            /// @brief Function pointer type for moving an element into uninitialized storage.
+            using MoveFunct = void(*)(void* Dest, void* Source);
+            /// @brief Function pointer type for destroying an element.
+            using DestroyFunct = void(*)(void* Element);
+            /// @brief Function pointer type for allocating heap storage for an element.
+            using AllocateFunct = void*(*)();
+            /// @brief Function pointer type for freeing heap storage of an element.
+            using DeallocateFunct = void(*)(void* Element) noexcept;
+
+            /// @brief Retrieves the std::type_info of the element.
+            TypeFunct GetType;
+            /// @brief Copy constructs the element.
+            CopyFunct Copy;
+            /// @brief Move constructs the element.
+            MoveFunct Move;
+            /// @brief Destroys the element.
+            DestroyFunct Destroy;
+            /// @brief Allocates heap storage for the element when it doesn't fit in a StaticAny buffer.
+            AllocateFunct Allocate;
+            /// @brief Frees heap storage for the element.
+            DeallocateFunct Deallocate;
+            /// @brief The size of the element in bytes.
+            size_t Size;
+            /// @brief The alignment requirement of the element.
+            size_t Align;
+            /// @brief Whether or not the element can be copied and moved with memcpy.
+            Boole TriviallyCopyable;
+            /// @brief Whether or not destroying the element can be skipped.
+            Boole TriviallyDestructible;
+        };//VTable
+
+        /// @brief The table of operations for a specific element type.
+        /// @tparam ElementType The decayed type of element the table is for.
+        template<class ElementType>
+        inline constexpr VTable VTableFor = {
+            &GetElementType<ElementType>,
+            &CopyElement<ElementType>,
+            &MoveElement<ElementType>,
+            &DestroyElement<ElementType>,
+            &AllocateElement<ElementType>,
+            &DeallocateElement<ElementType>,
+            sizeof(ElementType),
+            alignof(ElementType),
+            std::is_trivially_copyable_v<ElementType>,
+            std::is_trivially_destructible_v<ElementType>
+        };
+
+        /// @brief Checks whether a table is for a specific element type.
+        /// @details Tables are normally unique per type so this is usually just a pointer comparison. If a type
+        /// crosses a shared library boundary it can end up with more than one table, so when the pointer
+        /// doesn't match the type information is compared as well.
+        /// @tparam ElementType The decayed type to check for.
+        /// @param Table The table to check, may be nullptr.
+        /// @return Returns true if Table manages elements of ElementType.
+        template<class ElementType>
+        Boole IsVTableFor(const VTable* Table) noexcept
+        {
+            return ( Table == &VTableFor<ElementType> ) ||
+                   ( Table != nullptr && Table->GetType() == typeid(ElementType) );
+        }
+
         /// @brief Verifies the number provided can be used for memory alignment (is a power of 2).
         /// @param Val The number to check if can be used for a valid alignment.
         /// @return Returns true if the value specified is a power of 2.
@@ -194,6 +294,12 @@ namespace Mezzanine
                 { Ret *= 2; }
             return Ret;
         }
+
+        /// @brief Gets the buffer size needed by a StaticAny that can store elements on the heap.
+        /// @param Size The requested buffer size.
+        /// @return Returns Size, or the size of a pointer if that is larger.
+        constexpr size_t GetSpillBufferSize(const size_t Size) noexcept
+            { return std::max( Size, sizeof(void*) ); }
     }//StaticAnyHelpers
 
 SAVE_WARNING_STATE
@@ -203,42 +309,68 @@ SUPPRESS_CLANG_WARNING("-Wpadded")
     /// @brief A container that uses type-erasure to store a single instance of a type with a specific size.
     /// @tparam AnySize The size of the object to be stored.  Smaller objects may be stored as well.
     /// @tparam AnyAlign The alignment requirement for objects to be stored in this StaticAny.
+    /// @tparam AnyHeapSpill Whether or not elements too large or too aligned for the internal buffer are
+    /// allowed.  If false, storing them is a compile error.  If true they are stored in a pooled heap
+    /// allocation and the internal buffer holds a pointer to it.  See SmallAny.
     /// @remarks Extended alignment (any alignment that exceeds std::max_align_t) is not supported by this
     /// class.  This class allows for a custom alignment to be specified if desired.  Extreme care should
     /// be taken when using this as placing an object into the StaticAny that has an alignment requirement
     /// greater than what was specified can cause undefined behavior.
     ///////////////////////////////////////
-    template<size_t AnySize, size_t AnyAlign = StaticAnyHelpers::GetBestAlign(AnySize)>
+    template<size_t AnySize, size_t AnyAlign = StaticAnyHelpers::GetBestAlign(AnySize), Boole AnyHeapSpill = false>
     class StaticAny
     {
     public:
         /// @brief Convenience type for the type of "this".
-        using SelfType = StaticAny<AnySize,AnyAlign>;
-        /// @brief Function pointer type containing our operations for the stored data.
-        using OperationFunct = void(*)(const StaticAnyOperations Op, void* Any, void* Datum);
+        using SelfType = StaticAny<AnySize,AnyAlign,AnyHeapSpill>;
+        /// @brief The table of type-specific operations for the stored data.
+        using VTableType = StaticAnyHelpers::VTable;
         /// @brief The type of internal buffer where our object will be stored.
         using BufferType = typename std::aligned_storage<AnySize,AnyAlign>::type;
     protected:
         static_assert(StaticAnyHelpers::IsValidAlignment(AnyAlign),"Invalid alignment value specified.");
         static_assert(AnySize > 0,"StaticAny must have a storage space greater than zero.");
         static_assert(AnyAlign <= alignof(std::max_align_t),"StaticAny does not support Extended Alignment.");
+        static_assert(!AnyHeapSpill || ( AnySize >= sizeof(void*) && AnyAlign >= alignof(void*) ),
+                      "A StaticAny that can store elements on the heap must be able to store a pointer.");
 
         // Friend declarations for the various implementations of StaticAnyCast.
-        template<size_t,size_t>
+        template<size_t,size_t,Boole>
         friend class StaticAny;
-        template<class ElementType, size_t AnyCastSize, size_t AnyCastAlign>
-        friend ElementType& StaticAnyCast(StaticAny<AnyCastSize,AnyCastAlign>& Any);
-        template<class ElementType, size_t AnyCastSize, size_t AnyCastAlign>
-        friend const ElementType& StaticAnyCast(const StaticAny<AnyCastSize,AnyCastAlign>& Any);
-        template<class ElementType, size_t AnyCastSize, size_t AnyCastAlign>
-        friend ElementType* StaticAnyCast(StaticAny<AnyCastSize,AnyCastAlign>* Any);
-        template<class ElementType, size_t AnyCastSize, size_t AnyCastAlign>
-        friend const ElementType* StaticAnyCast(const StaticAny<AnyCastSize,AnyCastAlign>* Any);
-
-        /// @brief Internal buffer storing our type-erased Element.
+        template<class ElementType, size_t AnyCastSize, size_t AnyCastAlign, Boole AnyCastHeapSpill>
+        friend ElementType& StaticAnyCast(StaticAny<AnyCastSize,AnyCastAlign,AnyCastHeapSpill>& Any);
+        template<class ElementType, size_t AnyCastSize, size_t AnyCastAlign, Boole AnyCastHeapSpill>
+        friend const ElementType& StaticAnyCast(const StaticAny<AnyCastSize,AnyCastAlign,AnyCastHeapSpill>& Any);
+        template<class ElementType, size_t AnyCastSize, size_t AnyCastAlign, Boole AnyCastHeapSpill>
+        friend ElementType* StaticAnyCast(StaticAny<AnyCastSize,AnyCastAlign,AnyCastHeapSpill>* Any);
+        template<class ElementType, size_t AnyCastSize, size_t AnyCastAlign, Boole AnyCastHeapSpill>
+        friend const ElementType* StaticAnyCast(const StaticAny<AnyCastSize,AnyCastAlign,AnyCastHeapSpill>* Any);
+
+        /// @brief Internal buffer storing our type-erased Element, or a pointer to it if it is on the heap.
         BufferType InternalStorage;
-        /// @brief Pointer to the operation function for performing common operations on our Element.
-        OperationFunct ElementOp = nullptr;
+        /// @brief Pointer to the table of operations for performing common operations on our Element.
+        const VTableType* ElementVTable = nullptr;
+
+        /// @brief Checks whether another kind of StaticAny can be converted to this kind.
+        /// @tparam OtherSize The storage size of the other StaticAny.
+        /// @tparam OtherAlign The storage alignment of the other StaticAny.
+        /// @tparam OtherHeapSpill Whether the other StaticAny can store elements on the heap.
+        /// @return Returns true if any element the other StaticAny can store can also be stored in this.
+        template<size_t OtherSize, size_t OtherAlign, Boole OtherHeapSpill>
+        static constexpr Boole CanStoreFrom() noexcept
+            { return AnyHeapSpill || ( !OtherHeapSpill && OtherSize <= AnySize && OtherAlign <= AnyAlign ); }
+        /// @brief Checks whether an element will be stored in the internal buffer.
+        /// @param VTable The table of operations for the element type.
+        /// @return Returns true if the element fits in the internal buffer, false if it goes on the heap.
+        static constexpr Boole IsInline(const VTableType* VTable) noexcept
+        {
+            if constexpr( AnyHeapSpill ) {
+                return VTable->Size <= AnySize && VTable->Align <= AnyAlign;
+            }else{
+                (void)VTable;
+                return true;
+            }
+        }
 
         /// @brief Gets a usable pointer to the internal storage of this StaticAny.
         /// @return Returns a char pointer pointing to the internal storage of this StaticAny.
@@ -248,6 +380,85 @@ SUPPRESS_CLANG_WARNING("-Wpadded")
         /// @return Returns a char pointer pointing to the internal storage of this StaticAny.
         const void* GetStoragePtr() const
             { return reinterpret_cast<const void*>( &InternalStorage ); }
+        /// @brief Gets a usable pointer to the stored element, wherever it is.
+        /// @return Returns a pointer to the element, which will be the internal storage unless it is on the heap.
+        void* GetElementPtr()
+        {
+            if constexpr( AnyHeapSpill ) {
+                if( ElementVTable != nullptr && !IsInline(ElementVTable) ) {
+                    return *reinterpret_cast<void**>( GetStoragePtr() );
+                }
+            }
+            return GetStoragePtr();
+        }
+        /// @brief Gets a usable pointer to the stored element, wherever it is.
+        /// @return Returns a pointer to the element, which will be the internal storage unless it is on the heap.
+        const void* GetElementPtr() const
+        {
+            if constexpr( AnyHeapSpill ) {
+                if( ElementVTable != nullptr && !IsInline(ElementVTable) ) {
+                    return *reinterpret_cast<void* const*>( GetStoragePtr() );
+                }
+            }
+            return GetStoragePtr();
+        }
+
+        /// @brief Checks whether the element stored is a specific type.
+        /// @tparam ElementType The type to check for.
+        /// @return Returns true if an element of exactly ElementType is being stored.
+        template<class ElementType>
+        Boole IsStoring() const noexcept
+            { return StaticAnyHelpers::IsVTableFor< std::decay_t<ElementType> >(ElementVTable); }
+
+        /// @brief Calls a visitor with the stored element if it is a specific type.
+        /// @tparam ElementType The type to check for and visit as.
+        /// @tparam SelfRef The type of StaticAny being visited, which may be const.
+        /// @tparam VisitorType The type of callable to visit the element with.
+        /// @param Self The StaticAny being visited.
+        /// @param Visitor The callable to pass the stored element to.
+        /// @param CompareTypes If false only the table pointers are compared, if true type information is also
+        /// compared.  This allows a fast pass over a list of types before a thorough one.
+        /// @return Returns true if the visitor was called, false otherwise.
+        template<class ElementType, class SelfRef, class VisitorType>
+        static Boole VisitIf(SelfRef& Self, VisitorType& Visitor, const Boole CompareTypes)
+        {
+            using DecayedElementType = std::decay_t<ElementType>;
+            using PointerType = std::conditional_t< std::is_const_v<SelfRef>,
+                                                    const DecayedElementType*,
+                                                    DecayedElementType* >;
+            const Boole Matches = ( CompareTypes ?
+                                    StaticAnyHelpers::IsVTableFor<DecayedElementType>(Self.ElementVTable) :
+                                    Self.ElementVTable == &StaticAnyHelpers::VTableFor<DecayedElementType> );
+            if( Matches ) {
+                Visitor( *reinterpret_cast<PointerType>( Self.GetElementPtr() ) );
+            }
+            return Matches;
+        }
+
+        /// @brief Makes room for an element and constructs it.
+        /// @details If the element doesn't fit in the internal buffer heap storage is allocated for it.  If
+        /// construction throws that storage is freed and this StaticAny is left empty.
+        /// @tparam ConstructorType The type of callable that will construct the element.
+        /// @param VTable The table of operations for the element type.
+        /// @param Constructor A callable that constructs the element in the void pointer it is given.
+        template<class ConstructorType>
+        void ConstructElement(const VTableType* VTable, ConstructorType&& Constructor)
+        {
+            assert(ElementVTable == nullptr);
+            if( IsInline(VTable) ) {
+                Constructor( GetStoragePtr() );
+            }else{
+                void* Element = VTable->Allocate();
+                try {
+                    Constructor( Element );
+                }catch(...){
+                    VTable->Deallocate(Element);
+                    throw;
+                }
+                ::new( GetStoragePtr() ) void*(Element);
+            }
+            ElementVTable = VTable;
+        }
 
         /// @brief Copies an Element into this StaticAny.
         /// @tparam ElementType The type that will be stored.
@@ -256,12 +467,11 @@ SUPPRESS_CLANG_WARNING("-Wpadded")
         void CopyValue(const ElementType& Val)
         {
             using DecayedElementType = std::decay_t<ElementType>;
-            static_assert(AnySize >= sizeof(DecayedElementType),"Element size exceeds allocated space.");
-            static_assert(AnyAlign >= alignof(DecayedElementType),"Element alignment exceeds allowed alignment.");
-            assert(ElementOp == nullptr);
+            static_assert(AnyHeapSpill || AnySize >= sizeof(DecayedElementType),"Element size exceeds allocated space.");
+            static_assert(AnyHeapSpill || AnyAlign >= alignof(DecayedElementType),"Element alignment exceeds allowed alignment.");
 
-            ::new( GetStoragePtr() ) DecayedElementType(Val);
-            ElementOp = &StaticAnyHelpers::Operation<DecayedElementType>;
+            ConstructElement( &StaticAnyHelpers::VTableFor<DecayedElementType>,
+                              [&Val](void* Dest) { ::new( Dest ) DecayedElementType(Val); } );
         }
         /// @brief Moves an Element into this StaticAny.
         /// @tparam ElementType The type that will be stored.
@@ -270,12 +480,11 @@ SUPPRESS_CLANG_WARNING("-Wpadded")
         void MoveValue(ElementType&& Val)
         {
             using DecayedElementType = std::decay_t<ElementType>;
-            static_assert(AnySize >= sizeof(DecayedElementType),"Element size exceeds allocated space.");
-            static_assert(AnyAlign >= alignof(DecayedElementType),"Element alignment exceeds allowed alignment.");
-            assert(ElementOp == nullptr);
+            static_assert(AnyHeapSpill || AnySize >= sizeof(DecayedElementType),"Element size exceeds allocated space.");
+            static_assert(AnyHeapSpill || AnyAlign >= alignof(DecayedElementType),"Element alignment exceeds allowed alignment.");
 
-            ::new( GetStoragePtr() ) DecayedElementType(Val);
-            ElementOp = &StaticAnyHelpers::Operation<DecayedElementType>;
+            ConstructElement( &StaticAnyHelpers::VTableFor<DecayedElementType>,
+                              [&Val](void* Dest) { ::new( Dest ) DecayedElementType( std::move(Val) ); } );
         }
         /// @brief A method that attempts to deduce whether the element needs to be copied or moved.
         /// @tparam ElementType The type that will be stored.
@@ -283,7 +492,7 @@ SUPPRESS_CLANG_WARNING("-Wpadded")
         template<class ElementType>
         void CopyOrMoveValue(ElementType&& Val)
         {
-            if( std::is_rvalue_reference<ElementType>::value ) {
+            if constexpr( std::is_rvalue_reference<ElementType&&>::value ) {
                 MoveValue( std::forward<ElementType>(Val) );
             }else{
                 CopyValue( std::forward<ElementType>(Val) );
@@ -292,43 +501,78 @@ SUPPRESS_CLANG_WARNING("-Wpadded")
         /// @brief Copies a StaticAny the same size or smaller into this StaticAny.
         /// @tparam OtherSize The storage size of the other StaticAny to be copied into this.
         /// @tparam OtherAlign The storage alignment of the other StaticAny to be copied into this.
+        /// @tparam OtherHeapSpill Whether the other StaticAny can store elements on the heap.
         /// @param Other The other StaticAny to be copied.
-        template<size_t OtherSize, size_t OtherAlign>
-        void CopyAny(const StaticAny<OtherSize,OtherAlign>& Other)
+        template<size_t OtherSize, size_t OtherAlign, Boole OtherHeapSpill>
+        void CopyAny(const StaticAny<OtherSize,OtherAlign,OtherHeapSpill>& Other)
         {
-            static_assert(AnySize >= OtherSize,"Other StaticAny size exceeds allocated space.");
-            static_assert(AnyAlign >= OtherAlign,"Other StaticAny alignment exceeds allowed alignment.");
-            assert(ElementOp == nullptr);
+            static_assert(AnyHeapSpill || AnySize >= OtherSize,"Other StaticAny size exceeds allocated space.");
+            static_assert(AnyHeapSpill || AnyAlign >= OtherAlign,"Other StaticAny alignment exceeds allowed alignment.");
+            static_assert(AnyHeapSpill || !OtherHeapSpill,"Other StaticAny may store elements that don't fit.");
 
-            void* ThisData = GetStoragePtr();
-            void* OtherData = const_cast<void*>(Other.GetStoragePtr());
-            Other.ElementOp(StaticAnyOperations::Copy,ThisData,OtherData);
-            ElementOp = Other.ElementOp;
+            const VTableType* OtherVTable = Other.ElementVTable;
+            if( OtherVTable == nullptr ) {
+                return;
+            }
+            const void* Source = Other.GetElementPtr();
+            ConstructElement( OtherVTable, [OtherVTable,Source](void* Dest) {
+                if( OtherVTable->TriviallyCopyable ) {
+                    std::memcpy(Dest,Source,OtherVTable->Size);
+                }else{
+                    OtherVTable->Copy(Dest,Source);
+                }
+            } );
         }
         /// @brief Moves a StaticAny the same size or smaller into this StaticAny.
+        /// @details If the element is on the heap in the other StaticAny and would be on the heap in this as
+        /// well, ownership of the heap storage is transferred without moving the element.
         /// @tparam OtherSize The storage size of the other StaticAny to be copied into this.
         /// @tparam OtherAlign The storage alignment of the other StaticAny to be copied into this.
-        /// @param Other The other StaticAny to be moved.
-        template<size_t OtherSize, size_t OtherAlign>
-        void MoveAny(StaticAny<OtherSize,OtherAlign>&& Other)
+        /// @tparam OtherHeapSpill Whether the other StaticAny can store elements on the heap.
+        /// @param Other The other StaticAny to be moved.  It will be left empty.
+        template<size_t OtherSize, size_t OtherAlign, Boole OtherHeapSpill>
+        void MoveAny(StaticAny<OtherSize,OtherAlign,OtherHeapSpill>&& Other)
         {
-            static_assert(AnySize >= OtherSize,"Other StaticAny size exceeds allocated space.");
-            static_assert(AnyAlign >= OtherAlign,"Other StaticAny alignment exceeds allowed alignment.");
-            assert(ElementOp == nullptr);
-
-            void* ThisData = GetStoragePtr();
-            void* OtherData = Other.GetStoragePtr();
-            Other.ElementOp(StaticAnyOperations::Move,ThisData,OtherData);
-            ElementOp = Other.ElementOp;
-            Other.ElementOp = nullptr;
+            static_assert(AnyHeapSpill || AnySize >= OtherSize,"Other StaticAny size exceeds allocated space.");
+            static_assert(AnyHeapSpill || AnyAlign >= OtherAlign,"Other StaticAny alignment exceeds allowed alignment.");
+            static_assert(AnyHeapSpill || !OtherHeapSpill,"Other StaticAny may store elements that don't fit.");
+            assert(ElementVTable == nullptr);
+
+            const VTableType* OtherVTable = Other.ElementVTable;
+            if( OtherVTable == nullptr ) {
+                return;
+            }
+            void* Source = Other.GetElementPtr();
+            if constexpr( AnyHeapSpill && OtherHeapSpill ) {
+                if( !Other.IsInline(OtherVTable) && !IsInline(OtherVTable) ) {
+                    ::new( GetStoragePtr() ) void*(Source);
+                    ElementVTable = OtherVTable;
+                    Other.ElementVTable = nullptr;
+                    return;
+                }
+            }
+            ConstructElement( OtherVTable, [OtherVTable,Source](void* Dest) {
+                if( OtherVTable->TriviallyCopyable ) {
+                    std::memcpy(Dest,Source,OtherVTable->Size);
+                }else{
+                    OtherVTable->Move(Dest,Source);
+                }
+            } );
+            Other.Destroy();
         }
 
         /// @brief Destructs the element being stored and prepares the StaticAny for the storing another element.
         void Destroy()
         {
-            if( ElementOp != nullptr ) {
-                ElementOp(StaticAnyOperations::Destroy,GetStoragePtr(),nullptr);
-                ElementOp = nullptr;
+            if( ElementVTable != nullptr ) {
+                void* Element = GetElementPtr();
+                if( !ElementVTable->TriviallyDestructible ) {
+                    ElementVTable->Destroy(Element);
+                }
+                if( !IsInline(ElementVTable) ) {
+                    ElementVTable->Deallocate(Element);
+                }
+                ElementVTable = nullptr;
             }
         }
     public:
@@ -348,16 +592,20 @@ SUPPRESS_CLANG_WARNING("-Wpadded")
         /// @brief Copy from different size StaticAny constructor.
         /// @tparam Size The size of the internal buffer in the StaticAny to copy.
         /// @tparam Align The alignment of the internal buffer in the StaticAny to copy.
+        /// @tparam HeapSpill Whether the StaticAny to copy can store elements on the heap.
         /// @param Other The other StaticAny to copy.
-        template<size_t Size, size_t Align, class = std::enable_if_t< (Size <= AnySize) && (Align <= AnyAlign) > >
-        StaticAny(const StaticAny<Size,Align>& Other)
+        template<size_t Size, size_t Align, Boole HeapSpill,
+                 class = std::enable_if_t< CanStoreFrom<Size,Align,HeapSpill>() > >
+        StaticAny(const StaticAny<Size,Align,HeapSpill>& Other)
             { CopyAny(Other); }
         /// @brief Move from different size StaticAny constructor.
         /// @tparam Size The size of the internal buffer in the StaticAny to move.
         /// @tparam Align The alignment of the internal buffer in the StaticAny to copy.
+        /// @tparam HeapSpill Whether the StaticAny to move can store elements on the heap.
         /// @param Other The other StaticAny to move.
-        template<size_t Size, size_t Align, class = std::enable_if_t< (Size <= AnySize) && (Align <= AnyAlign) > >
-        StaticAny(StaticAny<Size,Align>&& Other)
+        template<size_t Size, size_t Align, Boole HeapSpill,
+                 class = std::enable_if_t< CanStoreFrom<Size,Align,HeapSpill>() > >
+        StaticAny(StaticAny<Size,Align,HeapSpill>&& Other)
             { MoveAny( std::move(Other) ); }
         /// @brief Move value constructor.
         /// @tparam ElementType The type of element that will be stored inside the StaticAny.
@@ -390,10 +638,12 @@ SUPPRESS_CLANG_WARNING("-Wpadded")
         /// @brief Differently sized StaticAny copy assignment operator.
         /// @tparam Size The size of the other StaticAny to be copied.
         /// @tparam Align The alignment of the other StaticAny to be copied.
+        /// @tparam HeapSpill Whether the other StaticAny can store elements on the heap.
         /// @param Other The other StaticAny of the same size or smaller to be copied.
         /// @return Returns a reference to this.
-        template<size_t Size, size_t Align, class = std::enable_if_t< (Size <= AnySize) && (Align <= AnyAlign) > >
-        SelfType& operator=(const StaticAny<Size,Align>& Other)
+        template<size_t Size, size_t Align, Boole HeapSpill,
+                 class = std::enable_if_t< CanStoreFrom<Size,Align,HeapSpill>() > >
+        SelfType& operator=(const StaticAny<Size,Align,HeapSpill>& Other)
         {
             Destroy();
             CopyAny(Other);
@@ -402,10 +652,12 @@ SUPPRESS_CLANG_WARNING("-Wpadded")
         /// @brief Differently sized StaticAny move assignment operator.
         /// @tparam Size The size of the other StaticAny to be moved.
         /// @tparam Align The alignment of the other StaticAny to be moved.
+        /// @tparam HeapSpill Whether the other StaticAny can store elements on the heap.
         /// @param Other The other StaticAny of the same size or smaller to be moved.
         /// @return Returns a reference to this.
-        template<size_t Size, size_t Align, class = std::enable_if_t< (Size <= AnySize) && (Align <= AnyAlign) > >
-        SelfType& operator=(StaticAny<Size,Align>&& Other)
+        template<size_t Size, size_t Align, Boole HeapSpill,
+                 class = std::enable_if_t< CanStoreFrom<Size,Align,HeapSpill>() > >
+        SelfType& operator=(StaticAny<Size,Align,HeapSpill>&& Other)
         {
             Destroy();
             MoveAny( std::move(Other) );
@@ -427,6 +679,7 @@ SUPPRESS_CLANG_WARNING("-Wpadded")
         // Utility
 
         /// @brief Gets the maximum size this StaticAny can store.
+        /// @remarks If this StaticAny can store elements on the heap this is the largest size stored inline.
         /// @return Returns the "AnySize" template parameter of this StaticAny.
         static constexpr size_t capacity() noexcept
             { return AnySize; }
@@ -434,6 +687,10 @@ SUPPRESS_CLANG_WARNING("-Wpadded")
         /// @return Returns the "AnyAlign" template parameter of this StaticAny.
         static constexpr size_t align() noexcept
             { return AnyAlign; }
+        /// @brief Gets whether this StaticAny can store elements too large for its internal buffer.
+        /// @return Returns the "AnyHeapSpill" template parameter of this StaticAny.
+        static constexpr Boole can_spill() noexcept
+            { return AnyHeapSpill; }
 
         /// @brief Constructs an element inside the StaticAny storage.
         /// @tparam ElementType The type of element to be constructed.
@@ -443,9 +700,12 @@ SUPPRESS_CLANG_WARNING("-Wpadded")
         void emplace(ArgTypes&&... Args)
         {
             using DecayedElementType = std::decay_t<ElementType>;
+            static_assert(AnyHeapSpill || AnySize >= sizeof(DecayedElementType),"Element size exceeds allocated space.");
+            static_assert(AnyHeapSpill || AnyAlign >= alignof(DecayedElementType),"Element alignment exceeds allowed alignment.");
             Destroy();
-            ::new ( GetStoragePtr() ) DecayedElementType(std::forward<ArgTypes>(Args)...);
-            ElementOp = &StaticAnyHelpers::Operation<DecayedElementType>;
+            ConstructElement( &StaticAnyHelpers::VTableFor<DecayedElementType>, [&Args...](void* Dest) {
+                ::new ( Dest ) DecayedElementType(std::forward<ArgTypes>(Args)...);
+            } );
         }
 
         /// @brief Gets the type of element being stored in this StaticAny.
@@ -455,35 +715,73 @@ SUPPRESS_CLANG_WARNING("-Wpadded")
             if( empty() ) {
                 return typeid(void);
             }else{
-                const std::type_info* Info = nullptr;
-                ElementOp(StaticAnyOperations::QueryType,nullptr,reinterpret_cast<void*>(&Info));
-                return (*Info);
+                return ElementVTable->GetType();
             }
         }
 
         /// @brief Gets the size of the stored element.
         /// @return Returns the size of the element stored in this StaticAny in bytes, or 0 if empty.
         size_t size() const
-        {
-            size_t Ret = 0;
-            if( ElementOp != nullptr ) {
-                ElementOp(StaticAnyOperations::QuerySize,nullptr,reinterpret_cast<void*>(&Ret));
-            }
-            return Ret;
-        }
+            { return ( ElementVTable != nullptr ? ElementVTable->Size : 0 ); }
 
         /// @brief Checks to see if the StaticAny is currently empty.
         /// @return Returns true if the StaticAny isn't storing an element, false otherwise.
         bool empty() const noexcept
-            { return ElementOp == nullptr; }
+            { return ElementVTable == nullptr; }
+
+        /// @brief Checks to see if the stored element is in the internal buffer.
+        /// @return Returns false if an element is stored on the heap, true otherwise.
+        Boole is_inline() const noexcept
+            { return ( ElementVTable == nullptr || IsInline(ElementVTable) ); }
 
         /// @brief Destroys the current object being stored by the StaticAny.
         void clear()
             { Destroy(); }
+
+        /// @brief Calls a visitor with the stored element if it is one of a list of types.
+        /// @details This checks each type in the list in order and calls the visitor with a reference to the
+        /// stored element as the first type that matches.  The visitor must be callable with a reference to
+        /// every type in the list, a generic lambda is the simplest way to do this.
+        /// @tparam ElementTypes The closed list of types the visitor can handle.
+        /// @tparam VisitorType The type of callable to visit the element with.  This is a deduced parameter.
+        /// @param Visitor The callable to pass the stored element to.
+        /// @return Returns true if the visitor was called, false if this is empty or stores a type not in the list.
+        template<class... ElementTypes, class VisitorType>
+        Boole visit(VisitorType&& Visitor)
+        {
+            return ( VisitIf<ElementTypes>(*this,Visitor,false) || ... ) ||
+                   ( VisitIf<ElementTypes>(*this,Visitor,true) || ... );
+        }
+        /// @brief Calls a visitor with the stored element if it is one of a list of types.
+        /// @tparam ElementTypes The closed list of types the visitor can handle.
+        /// @tparam VisitorType The type of callable to visit the element with.  This is a deduced parameter.
+        /// @param Visitor The callable to pass the stored element to as a const reference.
+        /// @return Returns true if the visitor was called, false if this is empty or stores a type not in the list.
+        template<class... ElementTypes, class VisitorType>
+        Boole visit(VisitorType&& Visitor) const
+        {
+            return ( VisitIf<ElementTypes>(*this,Visitor,false) || ... ) ||
+                   ( VisitIf<ElementTypes>(*this,Visitor,true) || ... );
+        }
     };//StaticAny
 
 RESTORE_WARNING_STATE
 
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A StaticAny that stores small elements inline and larger ones in a pooled heap allocation.
+    /// @details Sizing a StaticAny for the largest type it might ever hold wastes that space in every instance.
+    /// A SmallAny is sized for the common case instead.  Elements that fit in the buffer are stored exactly as a
+    /// StaticAny would store them, and anything larger or more aligned is allocated from a SizeClassPool (or
+    /// operator new for very large types) with only a pointer kept in the buffer.
+    /// @n @n
+    /// Any StaticAny can be converted to a SmallAny of any size, but a SmallAny can only be converted to another
+    /// StaticAny that can also spill to the heap.
+    /// @tparam AnySize The largest size of element to store inline.  Raised to the size of a pointer if smaller.
+    /// @tparam AnyAlign The alignment of the inline storage.
+    ///////////////////////////////////////
+    template<size_t AnySize, size_t AnyAlign = StaticAnyHelpers::GetBestAlign( StaticAnyHelpers::GetSpillBufferSize(AnySize) )>
+    using SmallAny = StaticAny< StaticAnyHelpers::GetSpillBufferSize(AnySize), std::max( AnyAlign, alignof(void*) ), true >;
+
     /// @brief Casts a StaticAny into its appropriate type.
     /// @warning You can only cast a StaticAny into the exact type that that was stored in it.  You cannot
     /// cast a StaticAny into a covariant or any other type.  Attempting to do so will cause a
@@ -493,15 +791,16 @@ RESTORE_WARNING_STATE
     /// @tparam ElementType The type to cast the type-erased element in the StaticAny to.
     /// @tparam AnyCastSize The (deduced) size of the internal storage of the StaticAny.
     /// @tparam AnyCastAlign The (deduced) alignment of the internal storage of the StaticAny.
+    /// @tparam AnyCastHeapSpill Whether the StaticAny can store elements on the heap.  This is a deduced parameter.
     /// @param Any The StaticAny to cast.
     /// @return Returns a reference to the internal buffer of the type specified by ElementType.
-    template<class ElementType, size_t AnyCastSize, size_t AnyCastAlign>
-    inline ElementType& StaticAnyCast(StaticAny<AnyCastSize,AnyCastAlign>& Any)
+    template<class ElementType, size_t AnyCastSize, size_t AnyCastAlign, Boole AnyCastHeapSpill>
+    inline ElementType& StaticAnyCast(StaticAny<AnyCastSize,AnyCastAlign,AnyCastHeapSpill>& Any)
     {
-        if( std::type_index( typeid(ElementType) ) != std::type_index( Any.get_type() ) ) {
+        if( !Any.template IsStoring<ElementType>() ) {
             MEZZ_EXCEPTION(BadCastCode, "Invalid StaticAnyCast (&).")
         }
-        return *reinterpret_cast<ElementType*>( Any.GetStoragePtr() );
+        return *reinterpret_cast<ElementType*>( Any.GetElementPtr() );
     }
     /// @brief Casts a StaticAny into its appropriate type.
     /// @warning You can only cast a StaticAny into the exact type that that was stored in it.  You cannot
@@ -512,15 +811,16 @@ RESTORE_WARNING_STATE
     /// @tparam ElementType The type to cast the type-erased element in the StaticAny to.
     /// @tparam AnyCastSize The (deduced) size of the internal storage of the StaticAny.
     /// @tparam AnyCastAlign The (deduced) alignment of the internal storage of the StaticAny.
+    /// @tparam AnyCastHeapSpill Whether the StaticAny can store elements on the heap.  This is a deduced parameter.
     /// @param Any The StaticAny to cast.
     /// @return Returns a const reference to the internal buffer of the type specified by ElementType.
-    template<class ElementType, size_t AnyCastSize, size_t AnyCastAlign>
-    inline const ElementType& StaticAnyCast(const StaticAny<AnyCastSize,AnyCastAlign>& Any)
+    template<class ElementType, size_t AnyCastSize, size_t AnyCastAlign, Boole AnyCastHeapSpill>
+    inline const ElementType& StaticAnyCast(const StaticAny<AnyCastSize,AnyCastAlign,AnyCastHeapSpill>& Any)
     {
-        if( std::type_index( typeid(ElementType) ) != std::type_index( Any.get_type() ) ) {
+        if( !Any.template IsStoring<ElementType>() ) {
             MEZZ_EXCEPTION(BadCastCode, "Invalid StaticAnyCast (const&).")
         }
-        return *reinterpret_cast<const ElementType*>( Any.GetStoragePtr() );
+        return *reinterpret_cast<const ElementType*>( Any.GetElementPtr() );
     }
     /// @brief Casts a StaticAny into its appropriate type.
     /// @warning You can only cast a StaticAny into the exact type that that was stored in it.  You cannot
@@ -531,15 +831,16 @@ RESTORE_WARNING_STATE
     /// @tparam ElementType The type to cast the type-erased element in the StaticAny to.
     /// @tparam AnyCastSize The (deduced) size of the internal storage of the StaticAny.
     /// @tparam AnyCastAlign The (deduced) alignment of the internal storage of the StaticAny.
+    /// @tparam AnyCastHeapSpill Whether the StaticAny can store elements on the heap.  This is a deduced parameter.
     /// @param Any The StaticAny to cast.
     /// @return Returns a pointer to the internal buffer of the type specified by ElementType.
-    template<class ElementType, size_t AnyCastSize, size_t AnyCastAlign>
-    inline ElementType* StaticAnyCast(StaticAny<AnyCastSize,AnyCastAlign>* Any)
+    template<class ElementType, size_t AnyCastSize, size_t AnyCastAlign, Boole AnyCastHeapSpill>
+    inline ElementType* StaticAnyCast(StaticAny<AnyCastSize,AnyCastAlign,AnyCastHeapSpill>* Any)
     {
-        if( std::type_index( typeid(ElementType) ) != std::type_index( Any->get_type() ) ) {
+        if( !Any->template IsStoring<ElementType>() ) {
             MEZZ_EXCEPTION(BadCastCode, "Invalid StaticAnyCast (*).")
         }
-        return reinterpret_cast<ElementType*>( Any->GetStoragePtr() );
+        return reinterpret_cast<ElementType*>( Any->GetElementPtr() );
     }
     /// @brief Casts a StaticAny into its appropriate type.
     /// @warning You can only cast a StaticAny into the exact type that that was stored in it.  You cannot
@@ -550,15 +851,16 @@ RESTORE_WARNING_STATE
     /// @tparam ElementType The type to cast the type-erased element in the StaticAny to.
     /// @tparam AnyCastSize The (deduced) size of the internal storage of the StaticAny.
     /// @tparam AnyCastAlign The (deduced) alignment of the internal storage of the StaticAny.
+    /// @tparam AnyCastHeapSpill Whether the StaticAny can store elements on the heap.  This is a deduced parameter.
     /// @param Any The StaticAny to cast.
     /// @return Returns a const pointer to the internal buffer of the type specified by ElementType.
-    template<class ElementType, size_t AnyCastSize, size_t AnyCastAlign>
-    inline const ElementType* StaticAnyCast(const StaticAny<AnyCastSize,AnyCastAlign>* Any)
+    template<class ElementType, size_t AnyCastSize, size_t AnyCastAlign, Boole AnyCastHeapSpill>
+    inline const ElementType* StaticAnyCast(const StaticAny<AnyCastSize,AnyCastAlign,AnyCastHeapSpill>* Any)
     {
-        if( std::type_index( typeid(ElementType) ) != std::type_index( Any->get_type() ) ) {
+        if( !Any->template IsStoring<ElementType>() ) {
             MEZZ_EXCEPTION(BadCastCode, "Invalid StaticAnyCast (const*).")
         }
-        return reinterpret_cast<const ElementType*>( Any->GetStoragePtr() );
+        return reinterpret_cast<const ElementType*>( Any->GetElementPtr() );
     }
 }//Mezzanine
 
@@ -0,0 +1,531 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_StaticVariant_h
+#define Mezz_Foundation_StaticVariant_h
+
+/// @file
+/// @brief This file includes the declaration and definition for the StaticVariant class.
+
+#ifndef SWIG
+    #include "StaticAny.h"
+
+    #include <algorithm>
+    #include <functional>
+    #include <limits>
+    #include <memory>
+    #include <tuple>
+#endif
+
+namespace Mezzanine
+{
+    // Forward Declares
+    template<class... Types>
+    class StaticVariant;
+
+    /// @brief A simple type trait to help identify StaticVariant types.
+    /// @tparam ElementType Can be anything.  Doesn't matter.
+    /// @details This is a catch-most dummy trait to indicate a type isn't a StaticVariant.
+    template<typename ElementType>
+    struct is_static_variant : public std::false_type
+    {  };
+
+    /// @brief A simple type trait to help identify StaticVariant types.
+    /// @tparam Types The types the StaticVariant can store.  This is a deduced parameter.
+    template<class... Types>
+    struct is_static_variant< StaticVariant<Types...> > : public std::true_type
+    {  };
+
+    /// @brief Convenience value for is_static_variant.
+    /// @details This is a shorthand way to retrieve the value behind a is_static_variant that can
+    /// be used by SFINAE.
+    template<typename ElementType>
+    constexpr Boole is_static_variant_v = is_static_variant<ElementType>::value;
+
+    /// @brief A namespace for utilities that facilitate the operation of the StaticVariant.
+    namespace StaticVariantHelpers
+    {
+        /// @brief Gets the position of a type in a list of types.
+        /// @tparam ElementType The type to search for.
+        /// @tparam Types The list of types to search.
+        /// @return Returns the index of the first occurrence of ElementType in Types, or the number of
+        /// types in the list if it isn't present.
+        template<class ElementType, class... Types>
+        constexpr size_t IndexOf() noexcept
+        {
+            constexpr Boole Matches[] = { std::is_same_v<ElementType,Types>..., false };
+            for( size_t Idx = 0 ; Idx < sizeof...(Types) ; ++Idx )
+            {
+                if( Matches[Idx] ) {
+                    return Idx;
+                }
+            }
+            return sizeof...(Types);
+        }
+
+        /// @brief Counts the number of times a type appears in a list of types.
+        /// @tparam ElementType The type to count.
+        /// @tparam Types The list of types to search.
+        /// @return Returns the number of occurrences of ElementType in Types.
+        template<class ElementType, class... Types>
+        constexpr size_t CountOf() noexcept
+            { return ( size_t(0) + ... + size_t( std::is_same_v<ElementType,Types> ) ); }
+
+        /// @brief The smallest unsigned integer type that can index every type in a list plus an empty state.
+        /// @tparam TypeCount The number of types in the list.
+        template<size_t TypeCount>
+        using IndexTypeFor = std::conditional_t< ( TypeCount < std::numeric_limits<UInt8>::max() ), UInt8, UInt16 >;
+    }//StaticVariantHelpers
+
+SAVE_WARNING_STATE
+SUPPRESS_CLANG_WARNING("-Wpadded")
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A container that stores a single instance of one type from a closed list of types.
+    /// @tparam Types The list of types that can be stored.  Each type may only appear once.
+    /// @details This is the closed-set counterpart of the StaticAny.  The storage is sized and aligned for the
+    /// largest type in the list and the type currently stored is tracked with a small integer index rather
+    /// than type information.  This allows type checks without RTTI, visitation through a table indexed by
+    /// the stored type, and switch statements on index() using the compile time values from index_of().
+    /// @n @n
+    /// Elements are retrieved the same way they are from a StaticAny, with StaticAnyCast.
+    ///////////////////////////////////////
+    template<class... Types>
+    class StaticVariant
+    {
+    public:
+        /// @brief Convenience type for the type of "this".
+        using SelfType = StaticVariant<Types...>;
+        /// @brief The type used to track which element type is being stored.
+        using IndexType = StaticVariantHelpers::IndexTypeFor<sizeof...(Types)>;
+        /// @brief The table of type-specific operations used for each element type.
+        using VTableType = StaticAnyHelpers::VTable;
+
+        /// @brief The index value used to indicate nothing is being stored.
+        static constexpr IndexType npos = std::numeric_limits<IndexType>::max();
+        /// @brief The size of the internal buffer, which is the size of the largest type.
+        static constexpr size_t StorageSize = std::max({ sizeof(Types)... });
+        /// @brief The alignment of the internal buffer, which is the alignment of the most aligned type.
+        /// @remarks This may exceed alignof(std::max_align_t) for over-aligned types.  StaticVariants holding such
+        /// types are themselves over-aligned and need C++17 aligned new when allocated on the heap.
+        static constexpr size_t StorageAlign = std::max({ alignof(Types)... });
+
+        /// @brief The type of internal buffer where our object will be stored.
+        /// @remarks std::aligned_storage isn't required to support extended alignments, so this is spelled out.
+        struct alignas(StorageAlign) BufferType
+            { UInt8 Bytes[StorageSize]; };
+    protected:
+        static_assert(sizeof...(Types) > 0,"StaticVariant must be able to store at least one type.");
+        static_assert(sizeof...(Types) < std::numeric_limits<UInt16>::max(),"Too many types for a StaticVariant.");
+        static_assert(( ( StaticVariantHelpers::CountOf<Types,Types...>() == 1 ) && ... ),
+                      "Each type may only appear once in a StaticVariant.");
+        static_assert(( std::is_same_v< Types, std::decay_t<Types> > && ... ),
+                      "StaticVariant types must not be references, arrays, or cv-qualified.");
+        static_assert(StaticAnyHelpers::IsValidAlignment(StorageAlign),"Invalid alignment for StaticVariant storage.");
+        static_assert(alignof(BufferType) == StorageAlign,"StaticVariant storage is not aligned for every type.");
+
+        // Friend declarations for the various implementations of StaticAnyCast.
+        template<class ElementType, class... CastTypes>
+        friend ElementType& StaticAnyCast(StaticVariant<CastTypes...>& Variant);
+        template<class ElementType, class... CastTypes>
+        friend const ElementType& StaticAnyCast(const StaticVariant<CastTypes...>& Variant);
+        template<class ElementType, class... CastTypes>
+        friend ElementType* StaticAnyCast(StaticVariant<CastTypes...>* Variant);
+        template<class ElementType, class... CastTypes>
+        friend const ElementType* StaticAnyCast(const StaticVariant<CastTypes...>* Variant);
+
+        /// @brief The table of operations for each type, in the order the types are listed.
+        static constexpr const VTableType* ElementVTables[] = { &StaticAnyHelpers::VTableFor<Types>... };
+        /// @brief Whether or not every type can be copied and moved with memcpy.
+        static constexpr Boole AllTriviallyCopyable = ( std::is_trivially_copyable_v<Types> && ... );
+        /// @brief Whether or not destroying any type can be skipped.
+        static constexpr Boole AllTriviallyDestructible = ( std::is_trivially_destructible_v<Types> && ... );
+
+        /// @brief Internal buffer storing our Element.
+        BufferType InternalStorage;
+        /// @brief The position in the type list of the type being stored, or npos if empty.
+        IndexType ElementIndex = npos;
+
+        /// @brief Gets a usable pointer to the internal storage of this StaticVariant.
+        /// @return Returns a void pointer pointing to the internal storage of this StaticVariant.
+        void* GetStoragePtr()
+            { return reinterpret_cast<void*>( &InternalStorage ); }
+        /// @brief Gets a usable pointer to the internal storage of this StaticVariant.
+        /// @return Returns a void pointer pointing to the internal storage of this StaticVariant.
+        const void* GetStoragePtr() const
+            { return reinterpret_cast<const void*>( &InternalStorage ); }
+
+        /// @brief Calls a visitor with an element of a specific type.
+        /// @tparam ElementType The type to convert the storage to.
+        /// @tparam ResultType The type returned by the visitor for every element type.
+        /// @tparam VisitorType The type of callable to visit the element with.
+        /// @param Visitor The callable to pass the element to.
+        /// @param Storage The storage holding the element.
+        /// @return Returns whatever the visitor returns.
+        template<class ElementType, class ResultType, class VisitorType>
+        static ResultType VisitElement(VisitorType& Visitor, void* Storage)
+            { return static_cast<ResultType>( Visitor( *reinterpret_cast<ElementType*>(Storage) ) ); }
+        /// @brief Calls a visitor with a const element of a specific type.
+        /// @tparam ElementType The type to convert the storage to.
+        /// @tparam ResultType The type returned by the visitor for every element type.
+        /// @tparam VisitorType The type of callable to visit the element with.
+        /// @param Visitor The callable to pass the element to.
+        /// @param Storage The storage holding the element.
+        /// @return Returns whatever the visitor returns.
+        template<class ElementType, class ResultType, class VisitorType>
+        static ResultType VisitConstElement(VisitorType& Visitor, const void* Storage)
+            { return static_cast<ResultType>( Visitor( *reinterpret_cast<const ElementType*>(Storage) ) ); }
+
+        /// @brief Copies the element of another StaticVariant into this.
+        /// @param Other The StaticVariant to be copied.
+        void CopyVariant(const SelfType& Other)
+        {
+            assert(ElementIndex == npos);
+            if( Other.ElementIndex == npos ) {
+                return;
+            }
+            if constexpr( AllTriviallyCopyable ) {
+                std::memcpy(GetStoragePtr(),Other.GetStoragePtr(),StorageSize);
+            }else{
+                ElementVTables[Other.ElementIndex]->Copy(GetStoragePtr(),Other.GetStoragePtr());
+            }
+            ElementIndex = Other.ElementIndex;
+        }
+        /// @brief Moves the element of another StaticVariant into this.
+        /// @param Other The StaticVariant to be moved.  It will be left empty.
+        void MoveVariant(SelfType&& Other)
+        {
+            assert(ElementIndex == npos);
+            if( Other.ElementIndex == npos ) {
+                return;
+            }
+            if constexpr( AllTriviallyCopyable ) {
+                std::memcpy(GetStoragePtr(),Other.GetStoragePtr(),StorageSize);
+            }else{
+                ElementVTables[Other.ElementIndex]->Move(GetStoragePtr(),Other.GetStoragePtr());
+            }
+            ElementIndex = Other.ElementIndex;
+            Other.Destroy();
+        }
+
+        /// @brief Checks whether an object lives inside the internal storage of this StaticVariant.
+        /// @param Object A pointer to the object to check.
+        /// @return Returns true if Object points into the internal storage, false otherwise.
+        Boole IsInStorage(const void* Object) const
+        {
+            const std::less<const void*> Less;
+            const UInt8* Begin = InternalStorage.Bytes;
+            return !Less(Object,Begin) && Less(Object,Begin + StorageSize);
+        }
+
+        /// @brief Destructs the element being stored and prepares the StaticVariant for storing another element.
+        void Destroy()
+        {
+            if( ElementIndex != npos ) {
+                if constexpr( !AllTriviallyDestructible ) {
+                    ElementVTables[ElementIndex]->Destroy(GetStoragePtr());
+                }
+                ElementIndex = npos;
+            }
+        }
+    public:
+        ///////////////////////////////////////////////////////////////////////////////
+        // Construction, Destruction, and Assignment
+
+        /// @brief No init/empty constructor.
+        StaticVariant() = default;
+        /// @brief Copy constructor.
+        /// @param Other The other StaticVariant to copy.
+        StaticVariant(const SelfType& Other)
+            { CopyVariant(Other); }
+        /// @brief Move constructor.
+        /// @param Other The other StaticVariant to move.  It will be left empty.
+        StaticVariant(SelfType&& Other)
+            { MoveVariant( std::move(Other) ); }
+        /// @brief Element constructor.
+        /// @tparam ElementType The type of element that will be stored.  Must be exactly one of the listed types.
+        /// @param Val The value to be copied or moved.
+        template<typename ElementType,
+                 typename = std::enable_if_t< ( StaticVariantHelpers::IndexOf<std::decay_t<ElementType>,Types...>() < sizeof...(Types) ) > >
+        StaticVariant(ElementType&& Val)
+            { emplace< std::decay_t<ElementType> >( std::forward<ElementType>(Val) ); }
+        /// @brief Class destructor.
+        ~StaticVariant()
+            { Destroy(); }
+
+        /// @brief Copy assignment operator.
+        /// @param Other The other StaticVariant to copy.
+        /// @return Returns a reference to this.
+        SelfType& operator=(const SelfType& Other)
+        {
+            if( this != &Other ) {
+                Destroy();
+                CopyVariant(Other);
+            }
+            return *this;
+        }
+        /// @brief Move assignment operator.
+        /// @param Other The other StaticVariant to move.  It will be left empty.
+        /// @return Returns a reference to this.
+        SelfType& operator=(SelfType&& Other)
+        {
+            if( this != &Other ) {
+                Destroy();
+                MoveVariant( std::move(Other) );
+            }
+            return *this;
+        }
+        /// @brief Element assignment operator.
+        /// @remarks Val may be the element stored in this, or part of it.  In that case it is copied out before the
+        /// stored element is destroyed.
+        /// @tparam ElementType The type of element to be stored.  Must be exactly one of the listed types.
+        /// @param Val The value to be copied or moved.
+        /// @return Returns a reference to this.
+        template<typename ElementType,
+                 typename = std::enable_if_t< ( StaticVariantHelpers::IndexOf<std::decay_t<ElementType>,Types...>() < sizeof...(Types) ) > >
+        SelfType& operator=(ElementType&& Val)
+        {
+            using DecayedType = std::decay_t<ElementType>;
+            if( IsInStorage( std::addressof(Val) ) ) {
+                DecayedType Temp( std::forward<ElementType>(Val) );
+                emplace<DecayedType>( std::move(Temp) );
+            }else{
+                emplace<DecayedType>( std::forward<ElementType>(Val) );
+            }
+            return *this;
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Type Queries
+
+        /// @brief Gets the number of types this StaticVariant can store.
+        /// @return Returns the number of types in the type list.
+        static constexpr size_t type_count() noexcept
+            { return sizeof...(Types); }
+        /// @brief Checks whether a type can be stored in this StaticVariant.
+        /// @tparam ElementType The type to check.
+        /// @return Returns true if ElementType is one of the listed types, false otherwise.
+        template<class ElementType>
+        static constexpr Boole is_alternative() noexcept
+            { return StaticVariantHelpers::IndexOf<ElementType,Types...>() < sizeof...(Types); }
+        /// @brief Gets the index that will be reported when a specific type is stored.
+        /// @remarks This is constexpr so it can be used as a case label when switching on index().
+        /// @tparam ElementType The type to get the index of.  Must be one of the listed types.
+        /// @return Returns the position of ElementType in the type list.
+        template<class ElementType>
+        static constexpr IndexType index_of() noexcept
+        {
+            static_assert(is_alternative<ElementType>(),"Type is not storable in this StaticVariant.");
+            return static_cast<IndexType>( StaticVariantHelpers::IndexOf<ElementType,Types...>() );
+        }
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Utility
+
+        /// @brief Gets the size of the internal buffer.
+        /// @return Returns the size of the largest type in the type list.
+        static constexpr size_t capacity() noexcept
+            { return StorageSize; }
+        /// @brief Gets the alignment being used by this StaticVariant's storage.
+        /// @return Returns the alignment of the most aligned type in the type list.
+        static constexpr size_t align() noexcept
+            { return StorageAlign; }
+
+        /// @brief Constructs an element inside the StaticVariant storage.
+        /// @tparam ElementType The type of element to be constructed.  Must be one of the listed types.
+        /// @tparam ArgTypes A variadic template of the arguments to the constructor that will be called.
+        /// @param Args The values of the variadic template being passed into the element constructor.
+        template<class ElementType, class... ArgTypes>
+        void emplace(ArgTypes&&... Args)
+        {
+            constexpr IndexType NewIndex = index_of<ElementType>();
+            Destroy();
+            ::new ( GetStoragePtr() ) ElementType(std::forward<ArgTypes>(Args)...);
+            ElementIndex = NewIndex;
+        }
+
+        /// @brief Gets the position in the type list of the type being stored.
+        /// @return Returns the index of the stored type, or npos if empty.
+        IndexType index() const noexcept
+            { return ElementIndex; }
+        /// @brief Checks whether a specific type is being stored.
+        /// @tparam ElementType The type to check for.
+        /// @return Returns true if an element of ElementType is being stored, false otherwise.
+        template<class ElementType>
+        Boole holds_alternative() const noexcept
+        {
+            if constexpr( is_alternative<ElementType>() ) {
+                return ElementIndex == index_of<ElementType>();
+            }else{
+                return false;
+            }
+        }
+
+        /// @brief Gets the type of element being stored in this StaticVariant.
+        /// @return Returns a const reference to an std::type_info of the object being stored.
+        const std::type_info& get_type() const
+        {
+            if( empty() ) {
+                return typeid(void);
+            }else{
+                return ElementVTables[ElementIndex]->GetType();
+            }
+        }
+
+        /// @brief Gets the size of the stored element.
+        /// @return Returns the size of the element stored in this StaticVariant in bytes, or 0 if empty.
+        size_t size() const noexcept
+            { return ( ElementIndex != npos ? ElementVTables[ElementIndex]->Size : 0 ); }
+
+        /// @brief Checks to see if the StaticVariant is currently empty.
+        /// @return Returns true if the StaticVariant isn't storing an element, false otherwise.
+        Boole empty() const noexcept
+            { return ElementIndex == npos; }
+
+        /// @brief Destroys the current object being stored by the StaticVariant.
+        void clear()
+            { Destroy(); }
+
+        /// @brief Calls a visitor with the stored element.
+        /// @details The visitor is called through a table of functions indexed by the stored type, so only one
+        /// indirect call is made no matter how many types are listed.  The visitor must be callable with a
+        /// reference to every listed type and return the same type for each, a generic lambda is the simplest
+        /// way to do this.
+        /// @exception If this is empty a Mezzanine::Exception::BadCast exception will be thrown.
+        /// @tparam VisitorType The type of callable to visit the element with.  This is a deduced parameter.
+        /// @param Visitor The callable to pass the stored element to.
+        /// @return Returns whatever the visitor returns.
+        template<class VisitorType>
+        decltype(auto) visit(VisitorType&& Visitor)
+        {
+            using FirstType = std::tuple_element_t< 0, std::tuple<Types...> >;
+            using ResultType = std::invoke_result_t<VisitorType&,FirstType&>;
+            using VisitFunct = ResultType(*)(VisitorType&,void*);
+            static constexpr VisitFunct VisitTable[] = { &VisitElement<Types,ResultType,VisitorType>... };
+
+            if( empty() ) {
+                MEZZ_EXCEPTION(BadCastCode, "Cannot visit an empty StaticVariant.")
+            }
+            return VisitTable[ElementIndex](Visitor,GetStoragePtr());
+        }
+        /// @brief Calls a visitor with the stored element.
+        /// @exception If this is empty a Mezzanine::Exception::BadCast exception will be thrown.
+        /// @tparam VisitorType The type of callable to visit the element with.  This is a deduced parameter.
+        /// @param Visitor The callable to pass the stored element to as a const reference.
+        /// @return Returns whatever the visitor returns.
+        template<class VisitorType>
+        decltype(auto) visit(VisitorType&& Visitor) const
+        {
+            using FirstType = std::tuple_element_t< 0, std::tuple<Types...> >;
+            using ResultType = std::invoke_result_t<VisitorType&,const FirstType&>;
+            using VisitFunct = ResultType(*)(VisitorType&,const void*);
+            static constexpr VisitFunct VisitTable[] = { &VisitConstElement<Types,ResultType,VisitorType>... };
+
+            if( empty() ) {
+                MEZZ_EXCEPTION(BadCastCode, "Cannot visit an empty StaticVariant.")
+            }
+            return VisitTable[ElementIndex](Visitor,GetStoragePtr());
+        }
+    };//StaticVariant
+
+RESTORE_WARNING_STATE
+
+    /// @brief Casts a StaticVariant into its appropriate type.
+    /// @exception If the type being stored by the StaticVariant doesn't match the type being casted to a
+    /// Mezzanine::Exception::BadCast exception will be thrown.
+    /// @tparam ElementType The type to cast the element in the StaticVariant to.
+    /// @tparam CastTypes The (deduced) list of types the StaticVariant can store.
+    /// @param Variant The StaticVariant to cast.
+    /// @return Returns a reference to the internal buffer of the type specified by ElementType.
+    template<class ElementType, class... CastTypes>
+    inline ElementType& StaticAnyCast(StaticVariant<CastTypes...>& Variant)
+    {
+        if( !Variant.template holds_alternative<ElementType>() ) {
+            MEZZ_EXCEPTION(BadCastCode, "Invalid StaticAnyCast on StaticVariant (&).")
+        }
+        return *reinterpret_cast<ElementType*>( Variant.GetStoragePtr() );
+    }
+    /// @brief Casts a StaticVariant into its appropriate type.
+    /// @exception If the type being stored by the StaticVariant doesn't match the type being casted to a
+    /// Mezzanine::Exception::BadCast exception will be thrown.
+    /// @tparam ElementType The type to cast the element in the StaticVariant to.
+    /// @tparam CastTypes The (deduced) list of types the StaticVariant can store.
+    /// @param Variant The StaticVariant to cast.
+    /// @return Returns a const reference to the internal buffer of the type specified by ElementType.
+    template<class ElementType, class... CastTypes>
+    inline const ElementType& StaticAnyCast(const StaticVariant<CastTypes...>& Variant)
+    {
+        if( !Variant.template holds_alternative<ElementType>() ) {
+            MEZZ_EXCEPTION(BadCastCode, "Invalid StaticAnyCast on StaticVariant (const&).")
+        }
+        return *reinterpret_cast<const ElementType*>( Variant.GetStoragePtr() );
+    }
+    /// @brief Casts a StaticVariant into its appropriate type.
+    /// @exception If the type being stored by the StaticVariant doesn't match the type being casted to a
+    /// Mezzanine::Exception::BadCast exception will be thrown.
+    /// @tparam ElementType The type to cast the element in the StaticVariant to.
+    /// @tparam CastTypes The (deduced) list of types the StaticVariant can store.
+    /// @param Variant The StaticVariant to cast.
+    /// @return Returns a pointer to the internal buffer of the type specified by ElementType.
+    template<class ElementType, class... CastTypes>
+    inline ElementType* StaticAnyCast(StaticVariant<CastTypes...>* Variant)
+    {
+        if( !Variant->template holds_alternative<ElementType>() ) {
+            MEZZ_EXCEPTION(BadCastCode, "Invalid StaticAnyCast on StaticVariant (*).")
+        }
+        return reinterpret_cast<ElementType*>( Variant->GetStoragePtr() );
+    }
+    /// @brief Casts a StaticVariant into its appropriate type.
+    /// @exception If the type being stored by the StaticVariant doesn't match the type being casted to a
+    /// Mezzanine::Exception::BadCast exception will be thrown.
+    /// @tparam ElementType The type to cast the element in the StaticVariant to.
+    /// @tparam CastTypes The (deduced) list of types the StaticVariant can store.
+    /// @param Variant The StaticVariant to cast.
+    /// @return Returns a const pointer to the internal buffer of the type specified by ElementType.
+    template<class ElementType, class... CastTypes>
+    inline const ElementType* StaticAnyCast(const StaticVariant<CastTypes...>* Variant)
+    {
+        if( !Variant->template holds_alternative<ElementType>() ) {
+            MEZZ_EXCEPTION(BadCastCode, "Invalid StaticAnyCast on StaticVariant (const*).")
+        }
+        return reinterpret_cast<const ElementType*>( Variant->GetStoragePtr() );
+    }
+}//Mezzanine
+
+#endif // Mezz_Foundation_StaticVariant_h
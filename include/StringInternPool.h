@@ -0,0 +1,164 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_StringInternPool_h
+#define Mezz_Foundation_StringInternPool_h
+
+/// @file
+/// @brief A thread-safe pool that stores one canonical copy of each distinct string.
+
+#ifndef SWIG
+    #include "DataTypes.h"
+
+    #include <atomic>
+    #include <deque>
+    #include <memory>
+    #include <mutex>
+    #include <vector>
+#endif
+
+namespace Mezzanine
+{
+SAVE_WARNING_STATE
+SUPPRESS_CLANG_WARNING("-Wpadded")
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A table mapping hashes to a single canonical copy of every string that has been interned.
+    /// @details Identifiers tend to be repeated across huge numbers of objects.  Interning them means each distinct
+    /// identifier is stored once and every user holds a pointer to the canonical copy, so copying an identifier
+    /// is a pointer copy and two interned strings are equal exactly when their pointers are equal.
+    /// @n @n
+    /// Strings are stored in an append-only arena and are never removed or moved, so the references handed out
+    /// stay valid for the life of the pool.  The caller supplies the hash of each string, which lets a pool
+    /// serve any hash function.  Different strings with the same hash are stored separately.
+    /// @n @n
+    /// Lookups of strings that are already interned never take a lock.  Adding a string takes a lock, and when
+    /// the table has to grow the old table is kept alive rather than freed so that readers still probing it
+    /// are never left with a dangling pointer.  The retained tables together are smaller than the current one.
+    ///////////////////////////////////////
+    class MEZZ_LIB StringInternPool
+    {
+    public:
+        /// @brief The arena record for one interned string.
+        struct Entry
+        {
+            /// @brief The canonical copy of the string.
+            const String Text;
+            /// @brief The hash of the string supplied when it was interned.
+            const UInt32 Hash;
+        };//Entry
+    protected:
+        /// @brief An open-addressed hash table of pointers into the arena.
+        struct Table
+        {
+            /// @brief The slots of the table, null when empty.  The slot count is a power of two.
+            std::unique_ptr< std::atomic<const Entry*>[] > Slots;
+            /// @brief One less than the slot count, used to wrap probes.
+            SizeType Mask;
+
+            /// @brief Class constructor.
+            /// @param SlotCount The number of slots to create, which must be a power of two.
+            explicit Table(const SizeType SlotCount);
+        };//Table
+
+        /// @brief Every string interned so far, in the order they were added.
+        std::deque<Entry> Arena;
+        /// @brief Every table that has been created.  Only the last one is used for new strings.
+        std::vector< std::unique_ptr<Table> > Tables;
+        /// @brief The table lookups should probe.
+        std::atomic<Table*> CurrentTable;
+        /// @brief Serializes additions to the arena and table.
+        mutable std::mutex WriteLock;
+
+        /// @brief Finds a string in a specific table.
+        /// @param Probed The table to search.
+        /// @param Text The string to find.
+        /// @param Hash The hash of the string.
+        /// @return Returns the arena record of the string, or nullptr if it isn't in the table.
+        static const Entry* Probe(const Table& Probed, const StringView Text, const UInt32 Hash) noexcept;
+        /// @brief Places a record into a free slot of a table.
+        /// @param Dest The table to insert into.
+        /// @param ToInsert The record to insert.
+        static void Insert(Table& Dest, const Entry* ToInsert) noexcept;
+    public:
+        /// @brief Class constructor.
+        /// @param InitialCapacity The number of distinct strings the pool can hold before its table grows.
+        explicit StringInternPool(const SizeType InitialCapacity = 256);
+        /// @brief Deleted copy constructor.
+        StringInternPool(const StringInternPool&) = delete;
+        /// @brief Deleted move constructor.
+        StringInternPool(StringInternPool&&) = delete;
+        /// @brief Class destructor.
+        ~StringInternPool() = default;
+
+        /// @brief Deleted copy assignment operator.
+        StringInternPool& operator=(const StringInternPool&) = delete;
+        /// @brief Deleted move assignment operator.
+        StringInternPool& operator=(StringInternPool&&) = delete;
+
+        /// @brief Gets the pool shared by the whole application.
+        /// @remarks Strings interned in the global pool live until the application exits.
+        /// @return Returns a reference to the global StringInternPool.
+        static StringInternPool& GetGlobal();
+
+        /// @brief Gets the canonical copy of a string, adding it to the pool if needed.
+        /// @remarks If the string is already in the pool this doesn't take a lock.
+        /// @param Text The string to intern.
+        /// @param Hash The hash of the string.  The same string must always be given the same hash.
+        /// @return Returns the arena record of the string, valid for the life of the pool.
+        const Entry& Intern(const StringView Text, const UInt32 Hash);
+        /// @brief Finds the canonical copy of a string without adding it.
+        /// @remarks This never takes a lock.
+        /// @param Text The string to find.
+        /// @param Hash The hash of the string.
+        /// @return Returns the arena record of the string, or nullptr if it hasn't been interned.
+        const Entry* Find(const StringView Text, const UInt32 Hash) const noexcept;
+
+        /// @brief Gets the number of distinct strings in the pool.
+        /// @return Returns the number of strings that have been interned.
+        SizeType GetCount() const;
+        /// @brief Gets the number of strings the pool can hold before its table grows.
+        /// @return Returns the current capacity of the pool.
+        SizeType GetCapacity() const noexcept;
+    };//StringInternPool
+
+RESTORE_WARNING_STATE
+}//Mezzanine
+
+#endif
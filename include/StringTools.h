@@ -42,6 +42,10 @@
 
 #ifndef SWIG
     #include "DataTypes.h"
+
+    #include <charconv>
+    #include <limits>
+    #include <locale>
 #endif
 
 /// @file
@@ -371,6 +375,47 @@ namespace StringTools {
     template<>
     UInt8 ConvertFromString<UInt8>(const StringView ToConvert);
 
+    /// @brief Converts a String to an arithmetic value, rejecting anything that isn't entirely a number.
+    /// @remarks Integers are parsed in place with std::from_chars.  Floating point values are as well when the
+    /// standard library implements std::from_chars for them, older libstdc++ and libc++ don't, otherwise they are
+    /// read from a stream using the classic locale.
+    /// @tparam NumberType The deduced arithmetic type the String will be converted to.  Boole isn't supported.
+    /// @param ToConvert The String that will be converted.
+    /// @param Converted The value to assign the result to.  This is left untouched if the conversion fails.
+    /// @return Returns true if all of ToConvert was converted, false otherwise.
+    template<typename NumberType>
+    Boole ConvertFromChars(const StringView ToConvert, NumberType& Converted)
+    {
+        static_assert( std::is_arithmetic_v<NumberType> && !std::is_same_v<NumberType,Boole>,
+                       "ConvertFromChars only converts numbers." );
+    #ifdef __cpp_lib_to_chars
+        constexpr Boole UseCharConv = true;
+    #else
+        constexpr Boole UseCharConv = std::is_integral_v<NumberType>;
+    #endif
+        NumberType Parsed{};
+        if constexpr( UseCharConv ) {
+            const char* End = ToConvert.data() + ToConvert.size();
+            const std::from_chars_result Result = std::from_chars(ToConvert.data(),End,Parsed);
+            if( Result.ec != std::errc() || Result.ptr != End ) {
+                return false;
+            }
+        }else{
+            // Streams accept leading whitespace and plus signs, from_chars doesn't.
+            if( ToConvert.empty() || IsWhitespace(ToConvert.front()) || ToConvert.front() == '+' ) {
+                return false;
+            }
+            StringStream Converter( String( ToConvert.data(), ToConvert.size() ) );
+            Converter.imbue( std::locale::classic() );
+            Converter >> Parsed;
+            if( Converter.fail() || Converter.peek() != StringStream::traits_type::eof() ) {
+                return false;
+            }
+        }
+        Converted = Parsed;
+        return true;
+    }
+
     ///////////////////////////////////////////////////////////////////////////////
     // Convert-To-String Functions
 
@@ -407,6 +452,53 @@ namespace StringTools {
     /// @return Returns the converted UInt8 as a String.
     template<>
     String MEZZ_LIB ConvertToString<UInt8>(const UInt8& ToConvert);
+
+    /// @brief Converts an arithmetic value to text in a caller provided buffer.
+    /// @remarks Integers are formatted in place with std::to_chars.  Floating point values are as well when the
+    /// standard library implements std::to_chars for them, producing the shortest text that reads back to the same
+    /// value.  Otherwise they are written to a stream using the classic locale, with max_digits10 digits if
+    /// digits10 digits wouldn't read back to the same value.
+    /// @tparam NumberType The deduced arithmetic type that will be converted.  Boole isn't supported.
+    /// @param ToConvert The value to be converted.
+    /// @param Dest The buffer to write the text to.  No null terminator is written.
+    /// @param DestSize The number of chars available in Dest.  64 is enough for any arithmetic type.
+    /// @return Returns the number of chars written, or 0 if Dest was too small.
+    template<typename NumberType>
+    SizeType ConvertToChars(const NumberType ToConvert, char* Dest, const SizeType DestSize)
+    {
+        static_assert( std::is_arithmetic_v<NumberType> && !std::is_same_v<NumberType,Boole>,
+                       "ConvertToChars only converts numbers." );
+    #ifdef __cpp_lib_to_chars
+        constexpr Boole UseCharConv = true;
+    #else
+        constexpr Boole UseCharConv = std::is_integral_v<NumberType>;
+    #endif
+        if constexpr( UseCharConv ) {
+            const std::to_chars_result Result = std::to_chars(Dest,Dest + DestSize,ToConvert);
+            if( Result.ec != std::errc() ) {
+                return 0;
+            }
+            return static_cast<SizeType>(Result.ptr - Dest);
+        }else{
+            StringStream Converter;
+            Converter.imbue( std::locale::classic() );
+            Converter.precision( std::numeric_limits<NumberType>::digits10 );
+            Converter << ToConvert;
+            String Text = Converter.str();
+            NumberType ReadBack{};
+            if( !ConvertFromChars(Text,ReadBack) || ReadBack != ToConvert ) {
+                Converter.str( String() );
+                Converter.precision( std::numeric_limits<NumberType>::max_digits10 );
+                Converter << ToConvert;
+                Text = Converter.str();
+            }
+            if( Text.size() > DestSize ) {
+                return 0;
+            }
+            Text.copy(Dest,Text.size());
+            return Text.size();
+        }
+    }
 }//StringTools
 }//Mezzanine
 
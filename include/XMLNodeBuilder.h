@@ -0,0 +1,152 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_XMLNodeBuilder_h
+#define Mezz_Foundation_XMLNodeBuilder_h
+
+/// @file
+/// @brief Builds XML nodes directly from the registered members of a class.
+
+#ifndef SWIG
+    #include "DataTypes.h"
+    #include "Introspection.h"
+    #include "StringTools.h"
+    #include "XMLSerializationTools.h"
+#endif
+
+namespace Mezzanine
+{
+    namespace XMLNodeBuilderHelpers
+    {
+        using BinarySerializationHelpers::AlwaysFalse;
+        using XMLSerializationHelpers::IsAttributeMember;
+        using XMLSerializationHelpers::IsElementMember;
+        using XMLSerializationHelpers::IsSkippedMember;
+
+        /// @brief Formats a value as attribute text.
+        /// @remarks Arithmetic values are formatted in place with StringTools::ConvertToChars().  Floating point
+        /// values use text that reads back to the same value.
+        /// @tparam ValueType The deduced type of value to format.
+        /// @param Value The value to format.
+        /// @param Dest The String to replace with the formatted text.  Its capacity is reused.
+        template<typename ValueType>
+        void FormatValue(const ValueType& Value, String& Dest)
+        {
+            if constexpr( std::is_same_v<ValueType,String> ) {
+                Dest.assign(Value);
+            }else if constexpr( std::is_same_v<ValueType,Boole> ) {
+                Dest.assign( Value ? "true" : "false" );
+            }else if constexpr( std::is_arithmetic_v<ValueType> || std::is_enum_v<ValueType> ) {
+                using FormatType = typename std::conditional_t< std::is_enum_v<ValueType>,
+                                                                std::underlying_type<ValueType>,
+                                                                std::common_type<ValueType> >::type;
+                // Large enough for the round trip text of any arithmetic type.
+                char Buffer[64];
+                const SizeType Length = StringTools::ConvertToChars( static_cast<FormatType>(Value), Buffer, sizeof(Buffer) );
+                Dest.assign( Buffer, Length );
+            }else{
+                Dest = StringTools::ConvertToString(Value);
+            }
+        }
+
+        /// @brief Appends a child node for a registered object.
+        /// @tparam NodeType The deduced type of XML node being appended to.
+        /// @tparam Class The deduced registered class being written.
+        /// @param Parent The node to append the child to.
+        /// @param Object The object to write.
+        /// @param Name The null terminated name of the child node.
+        /// @param Scratch A String reused for every name and value written.
+        /// @return Returns the appended child node.
+        template<typename NodeType, typename Class>
+        NodeType AppendObject(NodeType& Parent, const Class& Object, const char* Name, String& Scratch)
+        {
+            NodeType Child = Parent.AppendChild(Name);
+            DoForAllMembers<Class>([&](const auto& Member) {
+                using AccessorType = std::decay_t<decltype(Member)>;
+                using MemberType = typename AccessorType::MemberType;
+                if constexpr( !IsSkippedMember<AccessorType>() && IsAttributeMember<MemberType>() ) {
+                    Scratch.assign( Member.GetName() );
+                    auto Attrib = Child.AppendAttribute( Scratch.c_str() );
+                    FormatValue( Member.GetValue(Object), Scratch );
+                    Attrib.SetValue( Scratch.c_str() );
+                }else if constexpr( !IsSkippedMember<AccessorType>() && !IsElementMember<MemberType>() ) {
+                    static_assert( AlwaysFalse<MemberType>(), "Container members cannot be built into XML nodes." );
+                }
+            });
+            DoForAllMembers<Class>([&](const auto& Member) {
+                using AccessorType = std::decay_t<decltype(Member)>;
+                using MemberType = typename AccessorType::MemberType;
+                if constexpr( !IsSkippedMember<AccessorType>() && IsElementMember<MemberType>() ) {
+                    Scratch.assign( Member.GetName() );
+                    AppendObject( Child, Member.GetValue(Object), Scratch.c_str(), Scratch );
+                }
+            });
+            return Child;
+        }
+    }//XMLNodeBuilderHelpers
+
+    /// @brief Appends a registered object to an XML tree as a child node.
+    /// @details The child node is named after the registered name of the class.  Each registered member that
+    /// isn't tagged Local or Generated is written to it.  Strings and other single values become attributes named
+    /// after the member, and registered members become child nodes named after the member, recursively.
+    /// Container members aren't supported and fail to compile rather than being dropped.  This is the layout
+    /// PullDeSerialize reads.
+    /// @n @n
+    /// This is a standalone builder; the legacy SloppyProtoSerialize path is unchanged and doesn't use it.
+    /// @n @n
+    /// Values are formatted straight into the attributes, no text is parsed and no staging document is built.
+    /// NodeType needs an AppendChild(const char*) method returning another NodeType and an
+    /// AppendAttribute(const char*) method returning an attribute with a SetValue(const char*) method, which is
+    /// how XML::Node works.
+    /// @tparam NodeType The deduced type of XML node being appended to.
+    /// @tparam Class The deduced registered class being written.
+    /// @param Parent The node to append the object to.
+    /// @param Object The object to write.
+    /// @return Returns the appended node.
+    template<typename NodeType, typename Class>
+    NodeType BuildNode(NodeType& Parent, const Class& Object)
+    {
+        static_assert( IsRegistered<Class>(), "Only registered classes can be built into XML nodes." );
+        const String Name( GetRegisteredName<Class>() );
+        String Scratch;
+        return XMLNodeBuilderHelpers::AppendObject( Parent, Object, Name.c_str(), Scratch );
+    }
+}//Mezzanine
+
+#endif
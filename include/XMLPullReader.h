@@ -0,0 +1,351 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_XMLPullReader_h
+#define Mezz_Foundation_XMLPullReader_h
+
+/// @file
+/// @brief A streaming pull parser for XML and the deserialization of registered classes built on it.
+
+#ifndef SWIG
+    #include "DataTypes.h"
+    #include "ContainerTools.h"
+    #include "Introspection.h"
+    #include "MezzException.h"
+    #include "StringTools.h"
+    #include "XMLSerializationTools.h"
+
+    #include <istream>
+    #include <vector>
+#endif
+
+namespace Mezzanine
+{
+SAVE_WARNING_STATE
+SUPPRESS_CLANG_WARNING("-Wpadded")
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief A forward-only XML reader that reports one element, end tag or run of text at a time.
+    /// @details Characters are pulled straight from the stream buffer as they are needed, so no DOM is built and
+    /// nothing is read past the end of the root element.  The element name, attributes and text of the current
+    /// event are kept in buffers that are reused for every event, so once those buffers have grown to fit the
+    /// largest node in a document, reading allocates nothing.
+    /// @n @n
+    /// The XML declaration, processing instructions, comments and DOCTYPE declarations are skipped.  Text that
+    /// is only whitespace is skipped.  The five predefined entities and numeric character references are
+    /// decoded in both text and attribute values.  Anything malformed will throw an Encoding exception.
+    ///////////////////////////////////////
+    class MEZZ_LIB XMLPullReader
+    {
+    public:
+        /// @brief The kinds of events the reader can stop at.
+        enum class EventType : UInt8
+        {
+            None,          ///< Nothing has been read yet.
+            StartElement,  ///< An opening tag, or the opening half of an empty element tag.
+            EndElement,    ///< A closing tag, or the closing half of an empty element tag.
+            Text,          ///< A run of text or a CDATA section between tags.
+            EndOfDocument  ///< The root element has been closed, or the stream ran out before it started.
+        };
+    protected:
+        /// @brief The location of an attribute name and value in the attribute buffer.
+        struct AttributeSpan
+        {
+            /// @brief The offset of the attribute name.
+            SizeType NameStart;
+            /// @brief The length of the attribute name.
+            SizeType NameLength;
+            /// @brief The offset of the attribute value.
+            SizeType ValueStart;
+            /// @brief The length of the attribute value.
+            SizeType ValueLength;
+        };//AttributeSpan
+
+        /// @brief The stream being read from.
+        std::istream& Stream;
+        /// @brief The buffer of the stream being read from.
+        std::streambuf* Source;
+        /// @brief The name of the element of the current event.
+        String ElementName;
+        /// @brief The decoded text of the current event.
+        String TextData;
+        /// @brief The names and decoded values of every attribute on the current element, back to back.
+        String AttributeData;
+        /// @brief The location of every attribute on the current element.
+        std::vector<AttributeSpan> Attributes;
+        /// @brief The names of every open element, back to back.
+        String NameStack;
+        /// @brief The offset of each open element name in the name stack.
+        std::vector<SizeType> NameOffsets;
+        /// @brief The depth of the element of the current event, with the root element at 1.
+        SizeType CurrentDepth = 0;
+        /// @brief The current event.
+        EventType CurrentEvent = EventType::None;
+        /// @brief Whether or not the current element is an empty element tag, which will end on the next read.
+        Boole PendingEnd = false;
+        /// @brief Whether or not the root element has been closed.
+        Boole Finished = false;
+
+        /// @brief Gets the next character without consuming it.
+        /// @return Returns the next character, or EOF if the stream is exhausted.
+        int Peek()
+            { return this->Source->sgetc(); }
+        /// @brief Consumes the next character.
+        /// @return Returns the character consumed, or EOF if the stream is exhausted.
+        int Bump()
+            { return this->Source->sbumpc(); }
+        /// @brief Consumes the next character and throws if it isn't the expected one.
+        /// @exception If the next character isn't Expected, an Encoding exception is thrown.
+        /// @param Expected The character that must come next.
+        void Expect(const char Expected);
+        /// @brief Consumes characters until something that isn't whitespace is next.
+        void SkipWhitespace();
+        /// @brief Consumes characters up to and including a terminating sequence.
+        /// @exception If the stream ends first, an Encoding exception is thrown.
+        /// @param Terminator The sequence that ends the skipped section.
+        /// @param Dest If not null, the skipped characters (without the terminator) are appended here.
+        void SkipPast(const StringView Terminator, String* Dest);
+        /// @brief Consumes an element or attribute name.
+        /// @exception If the name is empty, an Encoding exception is thrown.
+        /// @param Dest The String the name will be appended to.
+        void ReadName(String& Dest);
+        /// @brief Consumes and decodes an entity or character reference, after the ampersand.
+        /// @exception If the reference is unknown or malformed, an Encoding exception is thrown.
+        /// @param Dest The String the decoded character will be appended to.
+        void ReadReference(String& Dest);
+        /// @brief Consumes the attributes and end of an opening tag.
+        /// @return Returns true if the tag was an empty element tag, false otherwise.
+        Boole ReadAttributes();
+        /// @brief Consumes a run of text up to the next tag.
+        /// @return Returns true if the text contains anything other than whitespace.
+        Boole ReadText();
+        /// @brief Closes the innermost open element.
+        void PopElement();
+        /// @brief Gets the name of the innermost open element.
+        /// @return Returns a StringView of the innermost open element name.
+        StringView GetOpenName() const;
+        /// @brief Throws an Encoding exception for malformed input.
+        /// @param Message A description of what was wrong.
+        [[noreturn]] void ThrowMalformed(const char* Message) const;
+    public:
+        /// @brief Class constructor.
+        /// @param Input The stream to read XML from.  It must outlive the reader.
+        explicit XMLPullReader(std::istream& Input);
+        /// @brief Copy constructor.
+        XMLPullReader(const XMLPullReader&) = delete;
+        /// @brief Class destructor.
+        ~XMLPullReader() = default;
+
+        /// @brief Copy assignment operator.
+        XMLPullReader& operator=(const XMLPullReader&) = delete;
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Reading
+
+        /// @brief Reads the next event from the stream.
+        /// @exception If the XML is malformed, an Encoding exception is thrown.
+        /// @return Returns the type of event that was read.
+        EventType Next();
+        /// @brief Reads until the next child of an element starts or the element ends.
+        /// @param ParentDepth The depth of the parent element whose children are being visited.
+        /// @return Returns true if positioned at the StartElement of a child, false if the parent has ended.
+        Boole NextChildElement(const SizeType ParentDepth);
+        /// @brief Reads until the end of the current element, skipping all of its content.
+        /// @pre The current event must be a StartElement.
+        void SkipElement();
+
+        ///////////////////////////////////////////////////////////////////////////////
+        // Current Event Query
+
+        /// @brief Gets the current event.
+        /// @return Returns the type of event last read.
+        EventType GetEvent() const
+            { return this->CurrentEvent; }
+        /// @brief Gets the name of the element of the current StartElement or EndElement event.
+        /// @return Returns a StringView of the element name, valid until the next read.
+        StringView GetName() const
+            { return this->ElementName; }
+        /// @brief Gets the decoded text of the current Text event.
+        /// @return Returns a StringView of the text, valid until the next read.
+        StringView GetText() const
+            { return this->TextData; }
+        /// @brief Gets the depth of the element of the current event.
+        /// @return Returns the depth of the element, with the root element at 1.
+        SizeType GetDepth() const
+            { return this->CurrentDepth; }
+        /// @brief Gets whether or not the current element was written as an empty element tag.
+        /// @return Returns true if the current StartElement will be followed directly by its EndElement.
+        Boole IsEmptyElement() const
+            { return this->PendingEnd; }
+
+        /// @brief Gets the number of attributes on the current element.
+        /// @return Returns the number of attributes on the current StartElement.
+        SizeType GetAttributeCount() const
+            { return this->Attributes.size(); }
+        /// @brief Gets the name of an attribute on the current element.
+        /// @param Index The index of the attribute, in the order written.
+        /// @return Returns a StringView of the attribute name, valid until the next read.
+        StringView GetAttributeName(const SizeType Index) const;
+        /// @brief Gets the decoded value of an attribute on the current element.
+        /// @param Index The index of the attribute, in the order written.
+        /// @return Returns a StringView of the attribute value, valid until the next read.
+        StringView GetAttributeValue(const SizeType Index) const;
+        /// @brief Finds an attribute on the current element by name.
+        /// @param Name The name of the attribute to find.
+        /// @param Value Set to the decoded attribute value if found, left untouched otherwise.
+        /// @return Returns true if the attribute was found, false otherwise.
+        Boole FindAttribute(const StringView Name, StringView& Value) const;
+    };//XMLPullReader
+
+RESTORE_WARNING_STATE
+
+    namespace XMLPullHelpers
+    {
+        using XMLSerializationHelpers::IsAttributeMember;
+        using XMLSerializationHelpers::IsElementMember;
+        using XMLSerializationHelpers::IsSkippedMember;
+
+        /// @brief Converts the text of an attribute into a value.
+        /// @remarks Arithmetic values are parsed with StringTools::ConvertFromChars, in place where the standard
+        /// library allows.
+        /// @exception If an arithmetic value can't be parsed, an Encoding exception is thrown.
+        /// @tparam ValueType The deduced type of value to convert to.
+        /// @param Text The decoded text of the attribute.
+        /// @param Value The value to assign.
+        template<typename ValueType>
+        void ConvertValue(const StringView Text, ValueType& Value)
+        {
+            if constexpr( std::is_same_v<ValueType,String> ) {
+                Value.assign(Text.data(),Text.size());
+            }else if constexpr( std::is_same_v<ValueType,Boole> ) {
+                Value = StringTools::ConvertToBool(Text);
+            }else if constexpr( std::is_arithmetic_v<ValueType> || std::is_enum_v<ValueType> ) {
+                using ParseType = typename std::conditional_t< std::is_enum_v<ValueType>,
+                                                               std::underlying_type<ValueType>,
+                                                               std::common_type<ValueType> >::type;
+                ParseType Parsed{};
+                if( !StringTools::ConvertFromChars(Text,Parsed) ) {
+                    MEZZ_EXCEPTION(EncodingCode, "Attribute value could not be converted to a number.")
+                }
+                Value = static_cast<ValueType>(Parsed);
+            }else{
+                Value = StringTools::ConvertFromString<ValueType>(Text);
+            }
+        }
+    }//XMLPullHelpers
+
+    /// @brief Reads the members of a registered class from the element the reader is on.
+    /// @details Each registered member that isn't tagged Local or Generated is read from the element.  Strings
+    /// and other single values are read from the attribute of the same name.  Registered members are read from
+    /// the child element of the same name, recursively.  Container members aren't supported and are left
+    /// untouched, as are members with no matching attribute or child.  Unknown attributes and children are
+    /// ignored.  When this returns the reader is positioned at the EndElement of the element.
+    /// @pre The current event of the reader must be a StartElement.
+    /// @exception If the XML is malformed or a value can't be converted, an Encoding exception is thrown.
+    /// @tparam Class The deduced registered class to read.
+    /// @param Reader The reader positioned at the element to read.
+    /// @param Object The object to assign member values to.
+    template<typename Class>
+    void PullDeSerialize(XMLPullReader& Reader, Class& Object)
+    {
+        using namespace XMLPullHelpers;
+        static_assert( IsRegistered<Class>(), "Only registered classes can be deserialized from a pull reader." );
+
+        DoForAllMembers<Class>([&](const auto& Member) {
+            using AccessorType = std::decay_t<decltype(Member)>;
+            using MemberType = typename AccessorType::MemberType;
+            if constexpr( !IsSkippedMember<AccessorType>() && IsAttributeMember<MemberType>() ) {
+                StringView Text;
+                if( Reader.FindAttribute(Member.GetName(),Text) ) {
+                    MemberType Value{};
+                    ConvertValue(Text,Value);
+                    Member.SetValue(Object,std::move(Value));
+                }
+            }
+        });
+
+        const SizeType Depth = Reader.GetDepth();
+        while( Reader.NextChildElement(Depth) )
+        {
+            Boole Consumed = false;
+            DoForAllMembers<Class>([&](const auto& Member) {
+                using AccessorType = std::decay_t<decltype(Member)>;
+                using MemberType = typename AccessorType::MemberType;
+                if constexpr( !IsSkippedMember<AccessorType>() && IsElementMember<MemberType>() ) {
+                    if( !Consumed && Reader.GetName() == Member.GetName() ) {
+                        MemberType Value{};
+                        PullDeSerialize(Reader,Value);
+                        Member.SetValue(Object,std::move(Value));
+                        Consumed = true;
+                    }
+                }
+            });
+            if( !Consumed ) {
+                Reader.SkipElement();
+            }
+        }
+    }
+
+    /// @brief Reads a registered class from the next root element in a stream.
+    /// @details This reads only as far as the end of the root element, so several objects can be read from the
+    /// same stream one after another.  See PullDeSerialize for how members are matched to the XML.
+    /// @exception If the stream has no element, the root element isn't named after the registered name of the
+    /// class, or the XML is malformed, an Encoding exception is thrown.
+    /// @tparam Class The deduced registered class to read.
+    /// @param Stream The stream to read XML from.
+    /// @param Object The object to assign member values to.
+    /// @return Returns the stream that was read from.
+    template<typename Class>
+    std::istream& StreamDeSerialize(std::istream& Stream, Class& Object)
+    {
+        XMLPullReader Reader(Stream);
+        XMLPullReader::EventType Event = Reader.Next();
+        if( Event != XMLPullReader::EventType::StartElement ) {
+            MEZZ_EXCEPTION(EncodingCode, "No element found to deserialize.")
+        }
+        const StringView ClassName = GetRegisteredName<Class>();
+        if( !ClassName.empty() && Reader.GetName() != ClassName ) {
+            MEZZ_EXCEPTION(EncodingCode, "Root element does not match the registered name of the class.")
+        }
+        PullDeSerialize(Reader,Object);
+        return Stream;
+    }
+}//Mezzanine
+
+#endif
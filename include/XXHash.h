@@ -0,0 +1,175 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+//-----------------------------------------------------------------------------
+// xxHash was written by Yann Collet and is distributed under the BSD 2-Clause
+// license.  See XXHash.cpp for the full notice.
+
+#ifndef Mezz_Foundation_XXHash_h
+#define Mezz_Foundation_XXHash_h
+
+/// @file
+/// @brief The XXH3 family of fast non-cryptographic hash functions.
+
+#ifndef SWIG
+    #include "DataTypes.h"
+#endif
+
+namespace Mezzanine {
+namespace Hashing {
+    /// @page xxhash
+    /// The XXH3 implementation used by the Mezzanine follows the reference implementation
+    /// found <a href="https://github.com/Cyan4973/xxHash">here</a>, version 0.8, with the
+    /// default secret.  The hashes are identical to XXH3_64bits_withSeed and
+    /// XXH3_128bits_withSeed from that library.
+    /// @n@n
+    /// XXH3 reads many times faster than Murmur on large inputs and is at least as fast on
+    /// small ones, which makes it the better choice for checksums and content addressed
+    /// caches.  Murmur remains the hash behind HashedString and anything else whose hashes
+    /// are persisted.
+    /// @n@n
+    /// On x86 processors with AVX2 the long input loop uses 256-bit vectors, picked at
+    /// runtime.  Every other platform uses portable scalar code that produces the same hashes.
+    /// @n@n
+    /// The different hashing fuctions are:
+    ///   - @ref XXHash3_64
+    ///   - @ref XXHash3_128
+    ///   - @ref XXHash3Stream
+
+    /// @brief A convenience type for the return value of a 128-bit XXH3 Hashing function.
+    struct XXHashResult_128
+    {
+        /// @brief The low 64 bits of the hash followed by the high 64 bits.
+        UInt64 Hash[2] = {};
+    };//XXHashResult_128
+
+    /// @brief An XXH3 hash function that produces a 64-bit hash.
+    /// @param Key A pointer to the data that will be hashed.
+    /// @param Length The byte length of the Key.
+    /// @param Seed The base number to salt the hash with.
+    /// @return Returns a 64-bit Hash of the Key.
+    [[nodiscard]]
+    UInt64 XXHash3_64(const void* Key, const SizeType Length, const UInt64 Seed) noexcept;
+    /// @brief An XXH3 hash function that produces a 128-bit hash.
+    /// @param Key A pointer to the data that will be hashed.
+    /// @param Length The byte length of the Key.
+    /// @param Seed The base number to salt the hash with.
+    /// @return Returns a 128-bit Hash of the Key.
+    [[nodiscard]]
+    XXHashResult_128 XXHash3_128(const void* Key, const SizeType Length, const UInt64 Seed) noexcept;
+
+SAVE_WARNING_STATE
+SUPPRESS_CLANG_WARNING("-Wpadded")
+
+    ///////////////////////////////////////////////////////////////////////////////
+    /// @brief Computes the same hashes as @ref XXHash3_64 and @ref XXHash3_128 from data that arrives in pieces.
+    /// @details The 64-bit and 128-bit hashes share all of their per-byte work, so one stream can produce either
+    /// or both.  Input is gathered into a small buffer and consumed a block at a time, so splitting the data at
+    /// any points produces the same hashes as hashing all of it at once.
+    /// @n @n
+    /// A stream holds a few hundred bytes of state and doesn't allocate, so it is cheap to keep one around and
+    /// reset it between uses.
+    ///////////////////////////////////////
+    class MEZZ_LIB XXHash3Stream
+    {
+    public:
+        /// @brief The byte size of the secret the accumulators are mixed with.
+        static constexpr SizeType SecretSize = 192;
+        /// @brief The byte size of the buffer input is gathered into.
+        static constexpr SizeType BufferSize = 256;
+    protected:
+        /// @brief The eight lanes the input is accumulated into.
+        alignas(64) UInt64 Accumulators[8];
+        /// @brief The secret the input is mixed with, derived from the seed.
+        alignas(64) UInt8 Secret[SecretSize];
+        /// @brief Input that hasn't been consumed yet.
+        UInt8 Buffer[BufferSize];
+        /// @brief The base number the hash is salted with.
+        UInt64 Seed;
+        /// @brief The number of bytes hashed so far.
+        SizeType TotalLength;
+        /// @brief The number of bytes in the Buffer.
+        SizeType BufferedLength;
+        /// @brief The number of 64 byte stripes consumed since the accumulators were last scrambled.
+        SizeType StripesSoFar;
+
+        /// @brief Accumulates stripes, scrambling the accumulators each time a block is completed.
+        /// @param Accs The accumulators to update.
+        /// @param Stripes A pointer to the first stripe to accumulate.
+        /// @param StripeCount The number of stripes to accumulate.
+        /// @param SoFar The number of stripes consumed since the last scramble, updated in place.
+        /// @return Returns a pointer to the byte after the last stripe consumed.
+        const UInt8* ConsumeStripes(UInt64* Accs, const UInt8* Stripes, SizeType StripeCount,
+                                    SizeType& SoFar) const noexcept;
+        /// @brief Finishes the accumulators for a hash of more than 240 bytes.
+        /// @param Accs An array of eight accumulators to write the finished state to.
+        void DigestLong(UInt64* Accs) const noexcept;
+    public:
+        /// @brief Class constructor.
+        /// @param NewSeed The base number to salt the hash with.
+        explicit XXHash3Stream(const UInt64 NewSeed = 0) noexcept;
+
+        /// @brief Discards everything hashed so far and starts a new hash.
+        /// @param NewSeed The base number to salt the new hash with.
+        void Reset(const UInt64 NewSeed) noexcept;
+        /// @brief Adds the next piece of data to the hash.
+        /// @param Data A pointer to the data that will be hashed.
+        /// @param Length The byte length of the Data.
+        void Update(const void* Data, const SizeType Length) noexcept;
+        /// @brief Gets the 64-bit hash of everything added so far.
+        /// @remarks This doesn't change the stream, more data can still be added afterwards.
+        /// @return Returns the same hash as @ref XXHash3_64 on all of the data added since the last reset.
+        [[nodiscard]]
+        UInt64 Finalize64() const noexcept;
+        /// @brief Gets the 128-bit hash of everything added so far.
+        /// @remarks This doesn't change the stream, more data can still be added afterwards.
+        /// @return Returns the same hash as @ref XXHash3_128 on all of the data added since the last reset.
+        [[nodiscard]]
+        XXHashResult_128 Finalize128() const noexcept;
+        /// @brief Gets the number of bytes added so far.
+        /// @return Returns the combined byte length of every piece of data added.
+        [[nodiscard]]
+        SizeType GetLength() const noexcept;
+    };//XXHash3Stream
+
+RESTORE_WARNING_STATE
+}//Hashing
+}//Mezzanine
+
+#endif // Mezz_Foundation_XXHash_h
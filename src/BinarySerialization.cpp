@@ -0,0 +1,107 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+
+/// @file
+/// @brief The implementation of the reader and writer used for binary archives.
+
+#include "BinarySerialization.h"
+#include "MezzException.h"
+
+namespace Mezzanine
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // BinaryArchiveWriter
+
+    BinaryArchiveWriter::BinaryArchiveWriter(const SizeType InitialCapacity) :
+        Buffer(InitialCapacity > 0 ? new Byte[InitialCapacity] : nullptr),
+        Capacity(InitialCapacity)
+        {  }
+
+    BinaryArchiveWriter::~BinaryArchiveWriter()
+        { delete[] this->Buffer; }
+
+    void BinaryArchiveWriter::Grow(const SizeType Extra)
+    {
+        SizeType NewCapacity = std::max<SizeType>(this->Capacity * 2,64);
+        while( NewCapacity < this->Cursor + Extra )
+            { NewCapacity *= 2; }
+
+        Byte* NewBuffer = new Byte[NewCapacity];
+        if( this->Cursor > 0 ) {
+            std::memcpy(NewBuffer,this->Buffer,this->Cursor);
+        }
+        delete[] this->Buffer;
+        this->Buffer = NewBuffer;
+        this->Capacity = NewCapacity;
+    }
+
+    BinaryBuffer BinaryArchiveWriter::Finish()
+    {
+        if( this->Cursor == 0 ) {
+            return BinaryBuffer();
+        }
+        if( this->Cursor == this->Capacity ) {
+            BinaryBuffer Ret(this->Buffer,this->Cursor);
+            this->Buffer = nullptr;
+            this->Capacity = 0;
+            this->Cursor = 0;
+            return Ret;
+        }
+        BinaryBuffer Ret(this->Cursor);
+        std::memcpy(Ret.Binary,this->Buffer,this->Cursor);
+        this->Cursor = 0;
+        return Ret;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // BinaryArchiveReader
+
+    BinaryArchiveReader::BinaryArchiveReader(const Byte* Source, const SizeType SourceSize) :
+        Data(Source),
+        Size(Source != nullptr ? SourceSize : 0)
+        {  }
+
+    BinaryArchiveReader::BinaryArchiveReader(const BinaryBuffer& Source) :
+        BinaryArchiveReader(Source.Binary,Source.Size)
+        {  }
+
+    void BinaryArchiveReader::ThrowOverrun() const
+        { MEZZ_EXCEPTION(OutOfRangeCode, "Attempted to read beyond the end of a binary archive.") }
+}//Mezzanine
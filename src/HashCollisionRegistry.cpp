@@ -0,0 +1,110 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+
+/// @file
+/// @brief The implementation of the hash collision registry.
+
+#include "HashCollisionRegistry.h"
+#include "MezzException.h"
+
+namespace Mezzanine
+{
+    HashCollisionRegistry::HashCollisionRegistry() :
+        Handler(&HashCollisionRegistry::ThrowOnCollision)
+        {  }
+
+    HashCollisionRegistry& HashCollisionRegistry::GetGlobal()
+    {
+        static HashCollisionRegistry Global;
+        return Global;
+    }
+
+    void HashCollisionRegistry::ThrowOnCollision(const HashCollision& Collision)
+    {
+        MEZZ_EXCEPTION(EncodingCode, "Hash collision: \"" + Collision.Existing + "\" and \"" + Collision.Incoming +
+                                     "\" both hash to " + std::to_string(Collision.Hash) + ".")
+    }
+
+    Boole HashCollisionRegistry::Register(const UInt64 Hash, const StringView Text)
+    {
+        HandlerType ToCall;
+        HashCollision Detected;
+        {
+            std::lock_guard<std::mutex> Guard(this->Lock);
+            auto Result = this->Registered.try_emplace(Hash,Text);
+            if( Result.second || Result.first->second == Text ) {
+                return true;
+            }
+            Detected = HashCollision{ Hash, Result.first->second, String(Text) };
+            this->Collisions.push_back(Detected);
+            ToCall = this->Handler;
+        }
+        // Call the handler without holding the lock so it can use the registry.
+        if( ToCall ) {
+            ToCall(Detected);
+        }
+        return false;
+    }
+
+    void HashCollisionRegistry::SetHandler(HandlerType NewHandler)
+    {
+        std::lock_guard<std::mutex> Guard(this->Lock);
+        this->Handler = std::move(NewHandler);
+    }
+
+    std::vector<HashCollision> HashCollisionRegistry::GetCollisions() const
+    {
+        std::lock_guard<std::mutex> Guard(this->Lock);
+        return this->Collisions;
+    }
+
+    SizeType HashCollisionRegistry::GetCount() const
+    {
+        std::lock_guard<std::mutex> Guard(this->Lock);
+        return this->Registered.size();
+    }
+
+    void HashCollisionRegistry::Clear()
+    {
+        std::lock_guard<std::mutex> Guard(this->Lock);
+        this->Registered.clear();
+        this->Collisions.clear();
+    }
+}//Mezzanine
@@ -37,13 +37,11 @@
    Joseph Toppi - toppij@gmail.com
    John Blackwood - makoenergy02@gmail.com
 */
-#ifndef _HashedString_cpp
-#define _HashedString_cpp
 
-#include "hashedstring.h"
-#include "Internal/murmurhash3.h.cpp"
-#include "serialization.h"
-#include "exception.h"
+/// @file
+/// @brief The implementation of the hashed string identifiers.
+
+#include "HashedString.h"
 
 #include <cstring>
 
@@ -51,35 +49,40 @@ namespace Mezzanine
 {
     HashedString32::HashType HashedString32::Murmur32bit(const String& ToBeHashed)
     {
-        HashType Results = 0;
-        Internal::MurmurHash3_x86_32(ToBeHashed.data(), ToBeHashed.size(), HASHED_STRING_32_SEED, &Results );
-        return Results;
+        return static_cast<HashType>(
+            Hashing::MurmurHash3_x86_32(ToBeHashed.data(), ToBeHashed.size(), HASHED_STRING_32_SEED) );
     }
 
     HashedString32::HashType HashedString32::Murmur32bit(const char* ToBeHashed)
     {
-        HashType Results = 0;
-        Internal::MurmurHash3_x86_32(ToBeHashed, strlen(ToBeHashed), HASHED_STRING_32_SEED, &Results );
-        return Results;
+        return static_cast<HashType>(
+            Hashing::MurmurHash3_x86_32(ToBeHashed, strlen(ToBeHashed), HASHED_STRING_32_SEED) );
     }
 
+    const StringInternPool::Entry* HashedString32::Intern(const StringView ToIntern, const HashType StringHash)
+        { return &StringInternPool::GetGlobal().Intern( ToIntern, static_cast<UInt32>(StringHash) ); }
+
     ///////////////////////////////////////////////////////////////////////////////
     // HashedString32 Methods
 
     HashedString32::HashedString32() :
-        Hash(HashedString32::EmptyHash)
+        Interned(Intern(StringView(),HashedString32::EmptyHash)), Hash(HashedString32::EmptyHash)
         {  }
 
     HashedString32::HashedString32(const String& StartingString) :
-        TheString(StartingString), Hash(Murmur32bit(StartingString))
+        HashedString32(StartingString,Murmur32bit(StartingString))
         {  }
 
     HashedString32::HashedString32(const char* StartingString) :
-        TheString(StartingString), Hash(Murmur32bit(StartingString))
+        HashedString32(StringView(StartingString),Murmur32bit(StartingString))
         {  }
 
-    HashedString32::HashedString32(const String& StartingString, HashType PrecomputedHash) :
-        TheString(StartingString), Hash(PrecomputedHash)
+    HashedString32::HashedString32(const StringView StartingString, const HashType PrecomputedHash) :
+        Interned(Intern(StartingString,PrecomputedHash)), Hash(PrecomputedHash)
+        {  }
+
+    HashedString32::HashedString32(const Literal& StartingLiteral) :
+        HashedString32(StartingLiteral.Text,StartingLiteral.Hash)
         {  }
 
     ///////////////////////////////////////////////////////////////////////////////
@@ -87,46 +90,37 @@ namespace Mezzanine
 
     HashedString32& HashedString32::operator=(const String& Other)
     {
-        this->TheString = Other;
-        this->Hash = Murmur32bit(Other);
+        this->SetString(Other);
+        return *this;
     }
 
     HashedString32& HashedString32::operator=(const char* Other)
     {
-        this->TheString = Other;
         this->Hash = Murmur32bit(Other);
+        this->Interned = Intern(Other,this->Hash);
+        return *this;
     }
 
     ///////////////////////////////////////////////////////////////////////////////
     // Comparisons
 
     Boole HashedString32::operator==(const HashedString32& Other) const
-    {
-        //if(Hash==Other.Hash)
-        //    { return TheString == Other.TheString; }
-        //return false;
-        return Hash==Other.Hash;
-    }
+        { return Interned == Other.Interned; }
 
     Boole HashedString32::operator!=(const HashedString32& Other) const
-    {
-        //if(Hash!=Other.Hash)
-        //    { return TheString != Other.TheString; }
-        //return false;
-        return Hash!=Other.Hash;
-    }
+        { return Interned != Other.Interned; }
 
     Boole HashedString32::operator<(const HashedString32& Other) const
     {
-        //if(Hash==Other.Hash)
-        //    { return TheString < Other.TheString; }
+        if(Hash==Other.Hash)
+            { return Interned->Text < Other.Interned->Text; }
         return Hash < Other.Hash;
     }
 
     Boole HashedString32::operator>(const HashedString32& Other) const
     {
-        //if(Hash==Other.Hash)
-        //    { return TheString > Other.TheString; }
+        if(Hash==Other.Hash)
+            { return Interned->Text > Other.Interned->Text; }
         return Hash > Other.Hash;
     }
 
@@ -138,59 +132,14 @@ namespace Mezzanine
         { return Hash; }
 
     const String& HashedString32::GetString() const
-        { return TheString; }
+        { return Interned->Text; }
 
     void HashedString32::SetString(const String& NewString)
     {
-        TheString = NewString;
-        Hash=Murmur32bit(TheString);
+        Hash=Murmur32bit(NewString);
+        Interned=Intern(NewString,Hash);
     }
 
-    void HashedString32::ProtoSerialize(XML::Node& CurrentRoot) const
-    {
-        Mezzanine::XML::Node Hash32Node = CurrentRoot.AppendChild(GetSerializableName());
-
-        if(Hash32Node)
-        {
-            Mezzanine::XML::Attribute VersionAttr = Hash32Node.AppendAttribute("Version");
-            Mezzanine::XML::Attribute HashAttr = Hash32Node.AppendAttribute("Hash");
-            Mezzanine::XML::Attribute StringAttr = Hash32Node.AppendAttribute("String");
-
-            if( VersionAttr && HashAttr && StringAttr )
-            {
-                if( VersionAttr.SetValue("1") && HashAttr.SetValue(ToString(Hash)) && StringAttr.SetValue(TheString))
-                {
-                    return;
-                }else{
-                    SerializeError("Create XML Attribute Values", GetSerializableName(),true);
-                }
-            }else{
-                SerializeError("Create XML Attributes", GetSerializableName(),true);
-            }
-        }else{
-            SerializeError("Create XML Serialization Node", GetSerializableName(),true);
-        }
-    }
-
-    void HashedString32::ProtoDeSerialize(const XML::Node& OneNode)
-    {
-        if ( Mezzanine::String(OneNode.Name())==Mezzanine::String(GetSerializableName()) )
-        {
-            if(OneNode.GetAttribute("Version").AsInt() == 1)
-            {
-                Hash=OneNode.GetAttribute("Hash").AsInteger();
-                TheString=OneNode.GetAttribute("String").AsString();
-            }else{
-                MEZZ_EXCEPTION(ExceptionBase::INVALID_VERSION_EXCEPTION,"Incompatible XML Version for " + GetSerializableName() + ": Not Version 1.");
-            }
-        }else{
-            MEZZ_EXCEPTION(ExceptionBase::II_IDENTITY_INVALID_EXCEPTION,"Attempting to deserialize a " + GetSerializableName() + ", found a " + String(OneNode.Name()) + ".");
-        }
-    }
-
-    String HashedString32::GetSerializableName()
-        { return String("HashedString32"); }
-
     ///////////////////////////////////////////////////////////////////////////////
     // Class External Operators
 
@@ -201,12 +150,54 @@ namespace Mezzanine
         { return Literal + Hashed.GetString(); }
 
     std::ostream& operator << (std::ostream& stream, const Mezzanine::HashedString32& x)
+        { return stream << x.GetString(); }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // HashedString64 Methods
+
+    HashedString64::HashType HashedString64::Murmur64bit(const StringView ToBeHashed)
     {
-        Serialize(stream,x);
-        return stream;
+        return Hashing::MurmurHash3_x64_128(ToBeHashed.data(), ToBeHashed.size(), HASHED_STRING_64_SEED).Hash[0];
     }
-}//Mezzanine
 
+    void HashedString64::Assign(const StringView NewString, const HashType NewHash)
+    {
+        // The pool only needs a well mixed 32-bit hash to place the string.
+        const UInt32 PoolHash = static_cast<UInt32>( NewHash ^ ( NewHash >> 32 ) );
+        Interned = &StringInternPool::GetGlobal().Intern(NewString,PoolHash);
+        Hash = NewHash;
+#if HASHED_STRING_COLLISION_CHECKS
+        HashCollisionRegistry::GetGlobal().Register(NewHash,NewString);
+#endif
+    }
 
+    HashedString64::HashedString64()
+        { Assign(StringView(),HashedString64::EmptyHash); }
 
-#endif
+    HashedString64::HashedString64(const String& StartingString)
+        { Assign(StartingString,Murmur64bit(StartingString)); }
+
+    HashedString64::HashedString64(const char* StartingString)
+        { Assign(StartingString,Murmur64bit(StartingString)); }
+
+    HashedString64::HashedString64(const StringView StartingString, const HashType PrecomputedHash)
+        { Assign(StartingString,PrecomputedHash); }
+
+    HashedString64& HashedString64::operator=(const String& Other)
+    {
+        Assign(Other,Murmur64bit(Other));
+        return *this;
+    }
+
+    HashedString64& HashedString64::operator=(const char* Other)
+    {
+        Assign(Other,Murmur64bit(Other));
+        return *this;
+    }
+
+    void HashedString64::SetString(const String& NewString)
+        { Assign(NewString,Murmur64bit(NewString)); }
+
+    std::ostream& operator << (std::ostream& stream, const Mezzanine::HashedString64& x)
+        { return stream << x.GetString(); }
+}//Mezzanine
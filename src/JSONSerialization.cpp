@@ -0,0 +1,169 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+
+/// @file
+/// @brief The implementation of the non-template parts of the JSON reader.
+
+#include "JSONSerialization.h"
+
+namespace
+{
+    using namespace Mezzanine;
+
+    /// @brief Appends a code point to a String as UTF-8.
+    /// @param CodePoint The code point to append, which must be below 0x110000.
+    /// @param Dest The String to append to.
+    void AppendUTF8(const UInt32 CodePoint, String& Dest)
+    {
+        if( CodePoint < 0x80 ) {
+            Dest.push_back( static_cast<char>(CodePoint) );
+        }else if( CodePoint < 0x800 ) {
+            Dest.push_back( static_cast<char>( 0xC0 | ( CodePoint >> 6 ) ) );
+            Dest.push_back( static_cast<char>( 0x80 | ( CodePoint & 0x3F ) ) );
+        }else if( CodePoint < 0x10000 ) {
+            Dest.push_back( static_cast<char>( 0xE0 | ( CodePoint >> 12 ) ) );
+            Dest.push_back( static_cast<char>( 0x80 | ( ( CodePoint >> 6 ) & 0x3F ) ) );
+            Dest.push_back( static_cast<char>( 0x80 | ( CodePoint & 0x3F ) ) );
+        }else{
+            Dest.push_back( static_cast<char>( 0xF0 | ( CodePoint >> 18 ) ) );
+            Dest.push_back( static_cast<char>( 0x80 | ( ( CodePoint >> 12 ) & 0x3F ) ) );
+            Dest.push_back( static_cast<char>( 0x80 | ( ( CodePoint >> 6 ) & 0x3F ) ) );
+            Dest.push_back( static_cast<char>( 0x80 | ( CodePoint & 0x3F ) ) );
+        }
+    }
+    /// @brief Reads the four hex digits of a \\u escape.
+    /// @param Reader The archive to read from, positioned just after the "\u".
+    /// @return Returns the UTF-16 code unit the escape represents.
+    UInt32 ReadHexEscape(BinaryArchiveReader& Reader)
+    {
+        char Digits[4];
+        Reader.ReadBytes(Digits,sizeof(Digits));
+        UInt32 CodeUnit = 0;
+        const std::from_chars_result Result = std::from_chars(Digits,Digits + sizeof(Digits),CodeUnit,16);
+        if( Result.ec != std::errc() || Result.ptr != Digits + sizeof(Digits) ) {
+            JSONSerializationHelpers::ThrowMalformed("Invalid \\u escape in JSON string.");
+        }
+        return CodeUnit;
+    }
+}
+
+namespace Mezzanine {
+namespace JSONSerializationHelpers {
+    void ReadJSONString(BinaryArchiveReader& Reader, String& Dest)
+    {
+        ExpectToken(Reader,'"');
+        Dest.clear();
+        while( true )
+        {
+            // Copy everything up to the next quote or escape in one go.
+            const char* Start = reinterpret_cast<const char*>( Reader.GetCurrent() );
+            const SizeType Remaining = Reader.GetRemaining();
+            SizeType Length = 0;
+            while( Length < Remaining && Start[Length] != '"' && Start[Length] != '\\' )
+                { ++Length; }
+            Dest.append(Start,Length);
+            Reader.Skip(Length);
+
+            const char Special = static_cast<char>( Reader.ReadRaw<UInt8>() );
+            if( Special == '"' ) {
+                return;
+            }
+            const char Escaped = static_cast<char>( Reader.ReadRaw<UInt8>() );
+            switch( Escaped )
+            {
+                case '"':   Dest.push_back('"');   break;
+                case '\\':  Dest.push_back('\\');  break;
+                case '/':   Dest.push_back('/');   break;
+                case 'n':   Dest.push_back('\n');  break;
+                case 'r':   Dest.push_back('\r');  break;
+                case 't':   Dest.push_back('\t');  break;
+                case 'b':   Dest.push_back('\b');  break;
+                case 'f':   Dest.push_back('\f');  break;
+                case 'u':
+                {
+                    UInt32 CodePoint = ReadHexEscape(Reader);
+                    if( CodePoint >= 0xD800 && CodePoint < 0xDC00 ) {
+                        // A high surrogate must be followed by an escaped low surrogate.
+                        if( Reader.ReadRaw<UInt8>() != '\\' || Reader.ReadRaw<UInt8>() != 'u' ) {
+                            ThrowMalformed("Unpaired surrogate in JSON string.");
+                        }
+                        const UInt32 LowSurrogate = ReadHexEscape(Reader);
+                        if( LowSurrogate < 0xDC00 || LowSurrogate >= 0xE000 ) {
+                            ThrowMalformed("Unpaired surrogate in JSON string.");
+                        }
+                        CodePoint = 0x10000 + ( ( CodePoint - 0xD800 ) << 10 ) + ( LowSurrogate - 0xDC00 );
+                    }else if( CodePoint >= 0xDC00 && CodePoint < 0xE000 ) {
+                        ThrowMalformed("Unpaired surrogate in JSON string.");
+                    }
+                    AppendUTF8(CodePoint,Dest);
+                    break;
+                }
+                default:
+                    ThrowMalformed("Unknown escape in JSON string.");
+            }
+        }
+    }
+
+    void SkipValue(BinaryArchiveReader& Reader, const SizeType Depth)
+    {
+        if( Depth > MaxSkipDepth ) {
+            ThrowMalformed("JSON is nested too deeply to skip.");
+        }
+        const char Next = PeekToken(Reader);
+        if( Next == '"' ) {
+            String Discarded;
+            ReadJSONString(Reader,Discarded);
+        }else if( Next == '[' ) {
+            ReadItems(Reader,'[',']',[&]() {
+                SkipValue(Reader,Depth + 1);
+            });
+        }else if( Next == '{' ) {
+            String Discarded;
+            ReadItems(Reader,'{','}',[&]() {
+                ReadJSONString(Reader,Discarded);
+                ExpectToken(Reader,':');
+                SkipValue(Reader,Depth + 1);
+            });
+        }else if( !TryLiteral(Reader,"true") && !TryLiteral(Reader,"false") && !TryLiteral(Reader,"null") ) {
+            ReadNumberText(Reader);
+        }
+    }
+}//JSONSerializationHelpers
+}//Mezzanine
@@ -0,0 +1,218 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+
+/// @file
+/// @brief The implementation of the non-template parts of the MessagePack reader.
+
+#include "MessagePackSerialization.h"
+
+namespace
+{
+    using namespace Mezzanine;
+    using MessagePackHelpers::Format;
+    using MessagePackHelpers::ReadBigEndian;
+
+    /// @brief Checks to see if a format byte is in the range of a fixed size format.
+    /// @param Leading The format byte to check.
+    /// @param Fixed The first byte of the fixed size format.
+    /// @param Mask The bits of the format byte that hold the count or value.
+    /// @return Returns true if the format byte belongs to the fixed size format.
+    Boole IsFixed(const UInt8 Leading, const Format Fixed, const UInt8 Mask)
+        { return ( Leading & static_cast<UInt8>(~Mask) ) == static_cast<UInt8>(Fixed); }
+
+    /// @brief Reads the header of a str, array or map.
+    /// @param Reader The archive to read from.
+    /// @param Fixed The first byte of the fixed size variant.
+    /// @param Mask The bits of the fixed size format byte that hold the count.
+    /// @param Sized8 The format with an 8 bit count, or Format::Nil if there isn't one.
+    /// @param Sized16 The format with a 16 bit count.
+    /// @param Sized32 The format with a 32 bit count.
+    /// @param Message The message to throw with if the next value has some other format.
+    /// @return Returns the count that follows the header.
+    SizeType ReadHeader(BinaryArchiveReader& Reader, const Format Fixed, const UInt8 Mask, const Format Sized8,
+                        const Format Sized16, const Format Sized32, const char* Message)
+    {
+        const UInt8 Leading = Reader.ReadRaw<UInt8>();
+        if( IsFixed(Leading,Fixed,Mask) ) {
+            return Leading & Mask;
+        }else if( Sized8 != Format::Nil && Leading == static_cast<UInt8>(Sized8) ) {
+            return ReadBigEndian<UInt8>(Reader);
+        }else if( Leading == static_cast<UInt8>(Sized16) ) {
+            return ReadBigEndian<UInt16>(Reader);
+        }else if( Leading == static_cast<UInt8>(Sized32) ) {
+            return ReadBigEndian<UInt32>(Reader);
+        }
+        MessagePackHelpers::ThrowMismatch(Message);
+    }
+}
+
+namespace Mezzanine {
+namespace MessagePackHelpers {
+    UInt64 ReadInteger(BinaryArchiveReader& Reader, Boole& Negative)
+    {
+        const UInt8 Leading = Reader.ReadRaw<UInt8>();
+        Int64 Signed = 0;
+        if( IsFixed(Leading,Format::PositiveFixInt,0x7F) ) {
+            Negative = false;
+            return Leading;
+        }else if( IsFixed(Leading,Format::NegativeFixInt,0x1F) ) {
+            Signed = static_cast<Int8>(Leading);
+        }else{
+            switch( static_cast<Format>(Leading) )
+            {
+                case Format::UInt8:   Negative = false;  return ReadBigEndian<UInt8>(Reader);
+                case Format::UInt16:  Negative = false;  return ReadBigEndian<UInt16>(Reader);
+                case Format::UInt32:  Negative = false;  return ReadBigEndian<UInt32>(Reader);
+                case Format::UInt64:  Negative = false;  return ReadBigEndian<UInt64>(Reader);
+                case Format::Int8:    Signed = static_cast<Int8>( ReadBigEndian<UInt8>(Reader) );    break;
+                case Format::Int16:   Signed = static_cast<Int16>( ReadBigEndian<UInt16>(Reader) );  break;
+                case Format::Int32:   Signed = static_cast<Int32>( ReadBigEndian<UInt32>(Reader) );  break;
+                case Format::Int64:   Signed = static_cast<Int64>( ReadBigEndian<UInt64>(Reader) );  break;
+                default:              ThrowMismatch("Expected a MessagePack int.");
+            }
+        }
+        Negative = ( Signed < 0 );
+        return static_cast<UInt64>(Signed);
+    }
+
+    double ReadDouble(BinaryArchiveReader& Reader)
+    {
+        const UInt8 Leading = PeekFormat(Reader);
+        if( Leading == static_cast<UInt8>(Format::Float32) ) {
+            Reader.Skip(1);
+            const UInt32 Bits = ReadBigEndian<UInt32>(Reader);
+            float Value = 0.0f;
+            std::memcpy(&Value,&Bits,sizeof(Value));
+            return static_cast<double>(Value);
+        }else if( Leading == static_cast<UInt8>(Format::Float64) ) {
+            Reader.Skip(1);
+            const UInt64 Bits = ReadBigEndian<UInt64>(Reader);
+            double Value = 0.0;
+            std::memcpy(&Value,&Bits,sizeof(Value));
+            return Value;
+        }
+        Boole Negative = false;
+        const UInt64 Bits = ReadInteger(Reader,Negative);
+        return Negative ? static_cast<double>( static_cast<Int64>(Bits) ) : static_cast<double>(Bits);
+    }
+
+    StringView ReadStringView(BinaryArchiveReader& Reader)
+    {
+        const SizeType Length = ReadHeader(Reader,Format::FixStr,0x1F,Format::Str8,Format::Str16,Format::Str32,
+                                           "Expected a MessagePack str.");
+        if( Length > Reader.GetRemaining() ) {
+            Reader.ThrowOverrun();
+        }
+        const StringView Text( reinterpret_cast<const char*>( Reader.GetCurrent() ), Length );
+        Reader.Skip(Length);
+        return Text;
+    }
+
+    SizeType ReadArrayHeader(BinaryArchiveReader& Reader)
+    {
+        return ReadHeader(Reader,Format::FixArray,0x0F,Format::Nil,Format::Array16,Format::Array32,
+                          "Expected a MessagePack array.");
+    }
+
+    SizeType ReadMapHeader(BinaryArchiveReader& Reader)
+    {
+        return ReadHeader(Reader,Format::FixMap,0x0F,Format::Nil,Format::Map16,Format::Map32,
+                          "Expected a MessagePack map.");
+    }
+
+    void SkipValue(BinaryArchiveReader& Reader, const SizeType Depth)
+    {
+        if( Depth > MaxSkipDepth ) {
+            ThrowMismatch("MessagePack is nested too deeply to skip.");
+        }
+        const UInt8 Leading = PeekFormat(Reader);
+        const Format Kind = static_cast<Format>(Leading);
+        if( IsFixed(Leading,Format::FixArray,0x0F) || Kind == Format::Array16 || Kind == Format::Array32 ) {
+            const SizeType Count = ReadArrayHeader(Reader);
+            for( SizeType Idx = 0 ; Idx < Count ; ++Idx )
+                { SkipValue(Reader,Depth + 1); }
+        }else if( IsFixed(Leading,Format::FixMap,0x0F) || Kind == Format::Map16 || Kind == Format::Map32 ) {
+            const SizeType Count = ReadMapHeader(Reader);
+            for( SizeType Idx = 0 ; Idx < Count ; ++Idx )
+            {
+                SkipValue(Reader,Depth + 1);
+                SkipValue(Reader,Depth + 1);
+            }
+        }else if( IsFixed(Leading,Format::FixStr,0x1F) ||
+                  Kind == Format::Str8 || Kind == Format::Str16 || Kind == Format::Str32 )
+        {
+            ReadStringView(Reader);
+        }else if( IsFixed(Leading,Format::PositiveFixInt,0x7F) || IsFixed(Leading,Format::NegativeFixInt,0x1F) ) {
+            Reader.Skip(1);
+        }else{
+            Reader.Skip(1);
+            switch( Kind )
+            {
+                case Format::Nil:
+                case Format::False:
+                case Format::True:      break;
+                case Format::UInt8:
+                case Format::Int8:      Reader.Skip(1);   break;
+                case Format::UInt16:
+                case Format::Int16:     Reader.Skip(2);   break;
+                case Format::Float32:
+                case Format::UInt32:
+                case Format::Int32:     Reader.Skip(4);   break;
+                case Format::Float64:
+                case Format::UInt64:
+                case Format::Int64:     Reader.Skip(8);   break;
+                // Extension types are followed by a one byte type code before their data.
+                case Format::FixExt1:   Reader.Skip(2);   break;
+                case Format::FixExt2:   Reader.Skip(3);   break;
+                case Format::FixExt4:   Reader.Skip(5);   break;
+                case Format::FixExt8:   Reader.Skip(9);   break;
+                case Format::FixExt16:  Reader.Skip(17);  break;
+                case Format::Bin8:      Reader.Skip( ReadBigEndian<UInt8>(Reader) );        break;
+                case Format::Bin16:     Reader.Skip( ReadBigEndian<UInt16>(Reader) );       break;
+                case Format::Bin32:     Reader.Skip( ReadBigEndian<UInt32>(Reader) );       break;
+                case Format::Ext8:      Reader.Skip( ReadBigEndian<UInt8>(Reader) + 1u );   break;
+                case Format::Ext16:     Reader.Skip( ReadBigEndian<UInt16>(Reader) + 1u );  break;
+                case Format::Ext32:     Reader.Skip( ReadBigEndian<UInt32>(Reader) + SizeType(1) );  break;
+                default:                ThrowMismatch("Unknown MessagePack format.");
+            }
+        }
+    }
+}//MessagePackHelpers
+}//Mezzanine
@@ -48,6 +48,18 @@
 
 #include "MurmurHash.h"
 
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+#if ( defined(__GNUC__) || defined(__clang__) ) && ( defined(__x86_64__) || defined(__i386__) )
+    // GCC warns about the deliberately undefined vectors its own AVX-512 wrappers start from.
+    SAVE_WARNING_STATE
+    SUPPRESS_GCC_WARNING("-Wmaybe-uninitialized")
+    #include <immintrin.h>
+    RESTORE_WARNING_STATE
+#endif
+
 namespace {
     using namespace Mezzanine;
     //-----------------------------------------------------------------------------
@@ -83,12 +95,17 @@ namespace {
 
     FORCE_INLINE UInt32 GetBlock32(const UInt32* Blocks, const SizeType Index) noexcept
     {
-        return Blocks[Index];
+        // Keys handed to the batch function are often packed text with no alignment at all.
+        UInt32 Block;
+        std::memcpy(&Block,Blocks + Index,sizeof(Block));
+        return Block;
     }
 
     FORCE_INLINE UInt64 GetBlock64(const UInt64* Blocks, const SizeType Index) noexcept
     {
-        return Blocks[Index];
+        UInt64 Block;
+        std::memcpy(&Block,Blocks + Index,sizeof(Block));
+        return Block;
     }
 
     //-----------------------------------------------------------------------------
@@ -120,22 +137,21 @@ namespace {
 
         return ToMix;
     }
-}
-
-namespace Mezzanine {
-namespace Hashing {
-    UInt32 MurmurHash3_x86_32(const void* Key, const SizeType Length, const UInt32 Seed) noexcept
-    {
-        const SizeType NumBlocks = Length / 4;
-        UInt32 OutputHash = Seed;
 
-        static const UInt32 x86_32_Constant_One = 0xcc9e2d51;
-        static const UInt32 x86_32_Constant_Two = 0x1b873593;
+    //-----------------------------------------------------------------------------
+    // x86_32 body, shared by the single key, batch and stream functions
 
-        //----------
-        // Body
+    const UInt32 x86_32_Constant_One = 0xcc9e2d51;
+    const UInt32 x86_32_Constant_Two = 0x1b873593;
 
-        const UInt32* Blocks = static_cast<const UInt32*>(Key);
+    /// @brief Mixes whole 4 byte blocks into a x86_32 hash.
+    /// @param Data A pointer to the first block to mix.
+    /// @param NumBlocks The number of blocks to mix.
+    /// @param OutputHash The hash state before the blocks, or the seed.
+    /// @return Returns the hash state after the blocks.
+    UInt32 MixBlocks_x86_32(const UInt8* Data, const SizeType NumBlocks, UInt32 OutputHash) noexcept
+    {
+        const UInt32* Blocks = reinterpret_cast<const UInt32*>(Data);
         for( SizeType BlockIdx = 0 ; BlockIdx < NumBlocks ; BlockIdx++ )
         {
             UInt32 KeyBlock = GetBlock32(Blocks,BlockIdx);
@@ -148,11 +164,19 @@ namespace Hashing {
             OutputHash = ROTL32(OutputHash,13);
             OutputHash = ( OutputHash * 5 ) + 0xe6546b64;
         }
+        return OutputHash;
+    }
 
+    /// @brief Mixes the tail of a key into a x86_32 hash and finalizes it.
+    /// @param Tail A pointer to the bytes after the last whole block.
+    /// @param Length The byte length of the whole key.  The tail is the last Length % 4 bytes.
+    /// @param OutputHash The hash state after every whole block.
+    /// @return Returns the finished 32-bit hash.
+    UInt32 Finish_x86_32(const UInt8* Tail, const SizeType Length, UInt32 OutputHash) noexcept
+    {
         //----------
         // Tail
 
-        const UInt8* Tail = ( static_cast<const UInt8*>(Key) + ( NumBlocks * 4 ) );
         UInt32 TailBlock = 0;
         switch( Length & 3 )
         {
@@ -173,24 +197,229 @@ namespace Hashing {
         return OutputHash;
     }
 
-    MurmurHashResult_x86_128 MurmurHash3_x86_128(const void* Key, const SizeType Length, const UInt32 Seed) noexcept
-    {
-        const SizeType NumBlocks = Length / 16;
+    //-----------------------------------------------------------------------------
+    // x86_32 batch lanes - each hashes a group of keys at once, one key per lane.
+    // The lanes mix 16 bytes of every key per step for as many steps as the
+    // shortest key in the group allows, then each key is finished by the scalar
+    // code, so the results are identical to hashing each key alone.
+
+    #if ( defined(__GNUC__) || defined(__clang__) ) && ( defined(__x86_64__) || defined(__i386__) )
+        #define MEZZ_MURMUR_X86_SIMD
+
+        /// @brief Gets the number of 4 byte blocks every key in a group has, rounded down to whole 16 byte steps.
+        /// @param Lengths The byte lengths of the keys in the group.
+        /// @param LaneCount The number of keys in the group.
+        /// @return Returns the number of blocks the lanes can mix together.
+        SizeType GetSharedBlocks(const SizeType* Lengths, const SizeType LaneCount) noexcept
+        {
+            SizeType Shortest = Lengths[0];
+            for( SizeType LaneIdx = 1 ; LaneIdx < LaneCount ; ++LaneIdx )
+                { Shortest = std::min(Shortest,Lengths[LaneIdx]); }
+            return ( Shortest / 16 ) * 4;
+        }
+        /// @brief Finishes every key of a group with the scalar code.
+        /// @param Keys The keys in the group.
+        /// @param Lengths The byte lengths of the keys in the group.
+        /// @param LaneCount The number of keys in the group.
+        /// @param SharedBlocks The number of blocks the lanes already mixed.
+        /// @param States The hash state of each lane.
+        /// @param Out The array to write the finished hashes to.
+        void FinishLanes(const void* const* Keys, const SizeType* Lengths, const SizeType LaneCount,
+                         const SizeType SharedBlocks, const UInt32* States, UInt32* Out) noexcept
+        {
+            for( SizeType LaneIdx = 0 ; LaneIdx < LaneCount ; ++LaneIdx )
+            {
+                const UInt8* Key = static_cast<const UInt8*>(Keys[LaneIdx]);
+                const SizeType NumBlocks = Lengths[LaneIdx] / 4;
+                const UInt32 Mixed = MixBlocks_x86_32(Key + ( SharedBlocks * 4 ),NumBlocks - SharedBlocks,
+                                                      States[LaneIdx]);
+                Out[LaneIdx] = Finish_x86_32(Key + ( NumBlocks * 4 ),Lengths[LaneIdx],Mixed);
+            }
+        }
+        /// @brief Loads 16 bytes of a key.
+        /// @param Key The key to load from.
+        /// @param Offset The byte offset to load from.
+        /// @return Returns the next four blocks of the key.
+        __attribute__((target("sse4.1")))
+        inline __m128i LoadStep(const void* Key, const SizeType Offset) noexcept
+            { return _mm_loadu_si128( reinterpret_cast<const __m128i*>( static_cast<const UInt8*>(Key) + Offset ) ); }
+
+        /// @brief Hashes 4 keys using SSE4.1.
+        /// @param Keys The 4 keys to hash.
+        /// @param Lengths The byte lengths of the 4 keys.
+        /// @param Seed The base number to salt the hashes with.
+        /// @param Out The array to write the 4 hashes to.
+        __attribute__((target("sse4.1")))
+        void MurmurHash3_x86_32_SSE41(const void* const* Keys, const SizeType* Lengths, const UInt32 Seed,
+                                      UInt32* Out) noexcept
+        {
+            const SizeType SharedBlocks = GetSharedBlocks(Lengths,4);
+            const __m128i ConstantOne = _mm_set1_epi32( static_cast<int>(x86_32_Constant_One) );
+            const __m128i ConstantTwo = _mm_set1_epi32( static_cast<int>(x86_32_Constant_Two) );
+            const __m128i ConstantAdd = _mm_set1_epi32( static_cast<int>(0xe6546b64) );
+            __m128i Hashes = _mm_set1_epi32( static_cast<int>(Seed) );
+            for( SizeType Offset = 0 ; Offset < SharedBlocks * 4 ; Offset += 16 )
+            {
+                // Transpose so each register holds the same block of every key.
+                const __m128i Low01 = _mm_unpacklo_epi32( LoadStep(Keys[0],Offset), LoadStep(Keys[1],Offset) );
+                const __m128i Low23 = _mm_unpacklo_epi32( LoadStep(Keys[2],Offset), LoadStep(Keys[3],Offset) );
+                const __m128i High01 = _mm_unpackhi_epi32( LoadStep(Keys[0],Offset), LoadStep(Keys[1],Offset) );
+                const __m128i High23 = _mm_unpackhi_epi32( LoadStep(Keys[2],Offset), LoadStep(Keys[3],Offset) );
+                const __m128i Blocks[4] = { _mm_unpacklo_epi64(Low01,Low23), _mm_unpackhi_epi64(Low01,Low23),
+                                            _mm_unpacklo_epi64(High01,High23), _mm_unpackhi_epi64(High01,High23) };
+                for( const __m128i& Block : Blocks )
+                {
+                    __m128i KeyBlock = _mm_mullo_epi32(Block,ConstantOne);
+                    KeyBlock = _mm_or_si128( _mm_slli_epi32(KeyBlock,15), _mm_srli_epi32(KeyBlock,17) );
+                    KeyBlock = _mm_mullo_epi32(KeyBlock,ConstantTwo);
+
+                    Hashes = _mm_xor_si128(Hashes,KeyBlock);
+                    Hashes = _mm_or_si128( _mm_slli_epi32(Hashes,13), _mm_srli_epi32(Hashes,19) );
+                    Hashes = _mm_add_epi32( _mm_add_epi32( _mm_slli_epi32(Hashes,2), Hashes ), ConstantAdd );
+                }
+            }
+            alignas(16) UInt32 States[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(States),Hashes);
+            FinishLanes(Keys,Lengths,4,SharedBlocks,States,Out);
+        }
 
-        static const UInt32 x86_128_Constant_One = 0x239b961b;
-        static const UInt32 x86_128_Constant_Two = 0xab0e9789;
-        static const UInt32 x86_128_Constant_Three = 0x38b34ae5;
-        static const UInt32 x86_128_Constant_Four = 0xa1e38b93;
+        /// @brief Loads 16 bytes of two keys into the low and high halves of a register.
+        /// @param LowKey The key to load into the low half.
+        /// @param HighKey The key to load into the high half.
+        /// @param Offset The byte offset to load from.
+        /// @return Returns the next four blocks of both keys.
+        __attribute__((target("avx2")))
+        inline __m256i LoadStepPair(const void* LowKey, const void* HighKey, const SizeType Offset) noexcept
+        {
+            const __m256i Low = _mm256_castsi128_si256( LoadStep(LowKey,Offset) );
+            return _mm256_inserti128_si256(Low,LoadStep(HighKey,Offset),1);
+        }
 
-        UInt32 HashPart1 = Seed;
-        UInt32 HashPart2 = Seed;
-        UInt32 HashPart3 = Seed;
-        UInt32 HashPart4 = Seed;
+        /// @brief Hashes 8 keys using AVX2.
+        /// @param Keys The 8 keys to hash.
+        /// @param Lengths The byte lengths of the 8 keys.
+        /// @param Seed The base number to salt the hashes with.
+        /// @param Out The array to write the 8 hashes to.
+        __attribute__((target("avx2")))
+        void MurmurHash3_x86_32_AVX2(const void* const* Keys, const SizeType* Lengths, const UInt32 Seed,
+                                     UInt32* Out) noexcept
+        {
+            const SizeType SharedBlocks = GetSharedBlocks(Lengths,8);
+            const __m256i ConstantOne = _mm256_set1_epi32( static_cast<int>(x86_32_Constant_One) );
+            const __m256i ConstantTwo = _mm256_set1_epi32( static_cast<int>(x86_32_Constant_Two) );
+            const __m256i ConstantAdd = _mm256_set1_epi32( static_cast<int>(0xe6546b64) );
+            __m256i Hashes = _mm256_set1_epi32( static_cast<int>(Seed) );
+            for( SizeType Offset = 0 ; Offset < SharedBlocks * 4 ; Offset += 16 )
+            {
+                // Keys 0-3 go in the low halves and 4-7 in the high halves, and the unpacks work on each half
+                // separately, so this is two 4x4 transposes side by side.
+                const __m256i Row0 = LoadStepPair(Keys[0],Keys[4],Offset);
+                const __m256i Row1 = LoadStepPair(Keys[1],Keys[5],Offset);
+                const __m256i Row2 = LoadStepPair(Keys[2],Keys[6],Offset);
+                const __m256i Row3 = LoadStepPair(Keys[3],Keys[7],Offset);
+                const __m256i Low01 = _mm256_unpacklo_epi32(Row0,Row1);
+                const __m256i Low23 = _mm256_unpacklo_epi32(Row2,Row3);
+                const __m256i High01 = _mm256_unpackhi_epi32(Row0,Row1);
+                const __m256i High23 = _mm256_unpackhi_epi32(Row2,Row3);
+                const __m256i Blocks[4] = { _mm256_unpacklo_epi64(Low01,Low23),
+                                            _mm256_unpackhi_epi64(Low01,Low23),
+                                            _mm256_unpacklo_epi64(High01,High23),
+                                            _mm256_unpackhi_epi64(High01,High23) };
+                for( const __m256i& Block : Blocks )
+                {
+                    __m256i KeyBlock = _mm256_mullo_epi32(Block,ConstantOne);
+                    KeyBlock = _mm256_or_si256( _mm256_slli_epi32(KeyBlock,15), _mm256_srli_epi32(KeyBlock,17) );
+                    KeyBlock = _mm256_mullo_epi32(KeyBlock,ConstantTwo);
+
+                    Hashes = _mm256_xor_si256(Hashes,KeyBlock);
+                    Hashes = _mm256_or_si256( _mm256_slli_epi32(Hashes,13), _mm256_srli_epi32(Hashes,19) );
+                    Hashes = _mm256_add_epi32( _mm256_add_epi32( _mm256_slli_epi32(Hashes,2), Hashes ), ConstantAdd );
+                }
+            }
+            alignas(32) UInt32 States[8];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(States),Hashes);
+            FinishLanes(Keys,Lengths,8,SharedBlocks,States,Out);
+        }
 
-        //----------
-        // Body
+        /// @brief Loads 16 bytes of four keys into the four quarters of a register.
+        /// @param Keys The first of the keys to load, the rest are every fourth key after it.
+        /// @param Offset The byte offset to load from.
+        /// @return Returns the next four blocks of all four keys.
+        __attribute__((target("avx512f")))
+        inline __m512i LoadStepQuad(const void* const* Keys, const SizeType Offset) noexcept
+        {
+            __m512i Result = _mm512_castsi128_si512( LoadStep(Keys[0],Offset) );
+            Result = _mm512_inserti32x4(Result,LoadStep(Keys[4],Offset),1);
+            Result = _mm512_inserti32x4(Result,LoadStep(Keys[8],Offset),2);
+            return _mm512_inserti32x4(Result,LoadStep(Keys[12],Offset),3);
+        }
+
+        /// @brief Hashes 16 keys using AVX-512.
+        /// @param Keys The 16 keys to hash.
+        /// @param Lengths The byte lengths of the 16 keys.
+        /// @param Seed The base number to salt the hashes with.
+        /// @param Out The array to write the 16 hashes to.
+        __attribute__((target("avx512f")))
+        void MurmurHash3_x86_32_AVX512(const void* const* Keys, const SizeType* Lengths, const UInt32 Seed,
+                                       UInt32* Out) noexcept
+        {
+            const SizeType SharedBlocks = GetSharedBlocks(Lengths,16);
+            const __m512i ConstantOne = _mm512_set1_epi32( static_cast<int>(x86_32_Constant_One) );
+            const __m512i ConstantTwo = _mm512_set1_epi32( static_cast<int>(x86_32_Constant_Two) );
+            const __m512i ConstantAdd = _mm512_set1_epi32( static_cast<int>(0xe6546b64) );
+            __m512i Hashes = _mm512_set1_epi32( static_cast<int>(Seed) );
+            for( SizeType Offset = 0 ; Offset < SharedBlocks * 4 ; Offset += 16 )
+            {
+                // Quarter Q of row R holds key ( Q * 4 ) + R, so this is four 4x4 transposes side by side.
+                const __m512i Row0 = LoadStepQuad(Keys + 0,Offset);
+                const __m512i Row1 = LoadStepQuad(Keys + 1,Offset);
+                const __m512i Row2 = LoadStepQuad(Keys + 2,Offset);
+                const __m512i Row3 = LoadStepQuad(Keys + 3,Offset);
+                const __m512i Low01 = _mm512_unpacklo_epi32(Row0,Row1);
+                const __m512i Low23 = _mm512_unpacklo_epi32(Row2,Row3);
+                const __m512i High01 = _mm512_unpackhi_epi32(Row0,Row1);
+                const __m512i High23 = _mm512_unpackhi_epi32(Row2,Row3);
+                const __m512i Blocks[4] = { _mm512_unpacklo_epi64(Low01,Low23),
+                                            _mm512_unpackhi_epi64(Low01,Low23),
+                                            _mm512_unpacklo_epi64(High01,High23),
+                                            _mm512_unpackhi_epi64(High01,High23) };
+                for( const __m512i& Block : Blocks )
+                {
+                    __m512i KeyBlock = _mm512_mullo_epi32(Block,ConstantOne);
+                    KeyBlock = _mm512_rol_epi32(KeyBlock,15);
+                    KeyBlock = _mm512_mullo_epi32(KeyBlock,ConstantTwo);
+
+                    Hashes = _mm512_xor_si512(Hashes,KeyBlock);
+                    Hashes = _mm512_rol_epi32(Hashes,13);
+                    Hashes = _mm512_add_epi32( _mm512_add_epi32( _mm512_slli_epi32(Hashes,2), Hashes ), ConstantAdd );
+                }
+            }
+            alignas(64) UInt32 States[16];
+            _mm512_store_si512(States,Hashes);
+            FinishLanes(Keys,Lengths,16,SharedBlocks,States,Out);
+        }
+    #endif // GCC or Clang on x86
 
-        const UInt32* Blocks = static_cast<const UInt32*>(Key);
+    //-----------------------------------------------------------------------------
+    // x86_128 body, shared by the single key and stream functions
+
+    const UInt32 x86_128_Constant_One = 0x239b961b;
+    const UInt32 x86_128_Constant_Two = 0xab0e9789;
+    const UInt32 x86_128_Constant_Three = 0x38b34ae5;
+    const UInt32 x86_128_Constant_Four = 0xa1e38b93;
+
+    /// @brief Mixes whole 16 byte blocks into a x86_128 hash.
+    /// @param Data A pointer to the first block to mix.
+    /// @param NumBlocks The number of blocks to mix.
+    /// @param State The four parts of the hash state, updated in place.
+    void MixBlocks_x86_128(const UInt8* Data, const SizeType NumBlocks, UInt32 (&State)[4]) noexcept
+    {
+        UInt32 HashPart1 = State[0];
+        UInt32 HashPart2 = State[1];
+        UInt32 HashPart3 = State[2];
+        UInt32 HashPart4 = State[3];
+
+        const UInt32* Blocks = reinterpret_cast<const UInt32*>(Data);
 
         for( SizeType BlockIdx = 0 ; BlockIdx != NumBlocks ; BlockIdx++ )
         {
@@ -236,11 +465,28 @@ namespace Hashing {
             HashPart4 = ( HashPart4 * 5 ) + 0x32ac3b17;
         }
 
+        State[0] = HashPart1;
+        State[1] = HashPart2;
+        State[2] = HashPart3;
+        State[3] = HashPart4;
+    }
+
+    /// @brief Mixes the tail of a key into a x86_128 hash and finalizes it.
+    /// @param Tail A pointer to the bytes after the last whole block.
+    /// @param Length The byte length of the whole key.  The tail is the last Length % 16 bytes.
+    /// @param State The four parts of the hash state after every whole block.
+    /// @return Returns the finished 128-bit hash.
+    Hashing::MurmurHashResult_x86_128 Finish_x86_128(const UInt8* Tail, const SizeType Length,
+                                                     const UInt32 (&State)[4]) noexcept
+    {
+        UInt32 HashPart1 = State[0];
+        UInt32 HashPart2 = State[1];
+        UInt32 HashPart3 = State[2];
+        UInt32 HashPart4 = State[3];
+
         //----------
         // Tail
 
-        const UInt8* Tail = ( static_cast<const UInt8*>(Key) + ( NumBlocks * 16 ) );
-
         UInt32 TailBlockPart1 = 0;
         UInt32 TailBlockPart2 = 0;
         UInt32 TailBlockPart3 = 0;
@@ -311,7 +557,7 @@ namespace Hashing {
         HashPart3 += HashPart1;
         HashPart4 += HashPart1;
 
-        MurmurHashResult_x86_128 Result;
+        Hashing::MurmurHashResult_x86_128 Result;
         Result.Hash[0] = HashPart1;
         Result.Hash[1] = HashPart2;
         Result.Hash[2] = HashPart3;
@@ -319,23 +565,25 @@ namespace Hashing {
         return Result;
     }
 
-    MurmurHashResult_x64_128 MurmurHash3_x64_128(const void* Key, const SizeType Length, const UInt32 Seed) noexcept
+    //-----------------------------------------------------------------------------
+    // x64_128 body, shared by the single key and stream functions
+
+    SAVE_WARNING_STATE
+    SUPPRESS_CLANG_WARNING("-Wc++98-compat-pedantic")
+    const UInt64 x64_128_Constant_One = 0x87c37b91114253d5llu;
+    const UInt64 x64_128_Constant_Two = 0x4cf5ad432745937fllu;
+    RESTORE_WARNING_STATE
+
+    /// @brief Mixes whole 16 byte blocks into a x64_128 hash.
+    /// @param Data A pointer to the first block to mix.
+    /// @param NumBlocks The number of blocks to mix.
+    /// @param State The two parts of the hash state, updated in place.
+    void MixBlocks_x64_128(const UInt8* Data, const SizeType NumBlocks, UInt64 (&State)[2]) noexcept
     {
-        const SizeType NumBlocks = Length / 16;
+        UInt64 HashPart1 = State[0];
+        UInt64 HashPart2 = State[1];
 
-        SAVE_WARNING_STATE
-        SUPPRESS_CLANG_WARNING("-Wc++98-compat-pedantic")
-        static const UInt64 x64_128_Constant_One = 0x87c37b91114253d5llu;
-        static const UInt64 x64_128_Constant_Two = 0x4cf5ad432745937fllu;
-        RESTORE_WARNING_STATE
-
-        UInt64 HashPart1 = Seed;
-        UInt64 HashPart2 = Seed;
-
-        //----------
-        // Body
-
-        const UInt64* Blocks = static_cast<const UInt64*>(Key);
+        const UInt64* Blocks = reinterpret_cast<const UInt64*>(Data);
 
         for( SizeType BlockIdx = 0 ; BlockIdx < NumBlocks ; BlockIdx++ )
         {
@@ -361,11 +609,24 @@ namespace Hashing {
             HashPart2 = ( HashPart2 * 5 ) + 0x38495ab5;
         }
 
+        State[0] = HashPart1;
+        State[1] = HashPart2;
+    }
+
+    /// @brief Mixes the tail of a key into a x64_128 hash and finalizes it.
+    /// @param Tail A pointer to the bytes after the last whole block.
+    /// @param Length The byte length of the whole key.  The tail is the last Length % 16 bytes.
+    /// @param State The two parts of the hash state after every whole block.
+    /// @return Returns the finished 128-bit hash.
+    Hashing::MurmurHashResult_x64_128 Finish_x64_128(const UInt8* Tail, const SizeType Length,
+                                                     const UInt64 (&State)[2]) noexcept
+    {
+        UInt64 HashPart1 = State[0];
+        UInt64 HashPart2 = State[1];
+
         //----------
         // Tail
 
-        const UInt8* Tail = ( static_cast<const UInt8*>(Key) + ( NumBlocks * 16 ) );
-
         UInt64 TailBlockPart1 = 0;
         UInt64 TailBlockPart2 = 0;
 
@@ -412,10 +673,179 @@ namespace Hashing {
         HashPart1 += HashPart2;
         HashPart2 += HashPart1;
 
-        MurmurHashResult_x64_128 Result;
+        Hashing::MurmurHashResult_x64_128 Result;
         Result.Hash[0] = HashPart1;
         Result.Hash[1] = HashPart2;
         return Result;
     }
+
+    //-----------------------------------------------------------------------------
+    // Streaming
+
+    /// @brief Feeds more data to a stream, mixing every block that is completed.
+    /// @tparam BlockSize The byte size of the blocks the hash mixes.
+    /// @tparam MixFunct The type of the block mixing callable.
+    /// @param Pending The bytes of the incomplete block carried over from earlier updates.
+    /// @param TotalLength The number of bytes hashed so far, updated to include the new data.
+    /// @param Data A pointer to the data to add.
+    /// @param Length The byte length of the data to add.
+    /// @param Mix A callable accepting a pointer to whole blocks and the number of blocks to mix.
+    template<SizeType BlockSize, typename MixFunct>
+    void UpdateStream(UInt8 (&Pending)[BlockSize], SizeType& TotalLength, const UInt8* Data, SizeType Length,
+                      MixFunct&& Mix) noexcept
+    {
+        if( Length == 0 )
+            { return; }
+        SizeType PendingLength = TotalLength % BlockSize;
+        TotalLength += Length;
+        if( PendingLength > 0 )
+        {
+            const SizeType ToCopy = std::min(BlockSize - PendingLength,Length);
+            std::memcpy(Pending + PendingLength,Data,ToCopy);
+            PendingLength += ToCopy;
+            Data += ToCopy;
+            Length -= ToCopy;
+            if( PendingLength < BlockSize )
+                { return; }
+            Mix(Pending,1);
+        }
+        const SizeType NumBlocks = Length / BlockSize;
+        Mix(Data,NumBlocks);
+        std::memcpy(Pending,Data + ( NumBlocks * BlockSize ),Length - ( NumBlocks * BlockSize ));
+    }
+}
+
+namespace Mezzanine {
+namespace Hashing {
+    UInt32 MurmurHash3_x86_32(const void* Key, const SizeType Length, const UInt32 Seed) noexcept
+    {
+        const UInt8* Data = static_cast<const UInt8*>(Key);
+        const SizeType NumBlocks = Length / 4;
+        return Finish_x86_32(Data + ( NumBlocks * 4 ),Length,MixBlocks_x86_32(Data,NumBlocks,Seed));
+    }
+
+    void MurmurHash3_x86_32_Batch(const void* const* Keys, const SizeType* Lengths, const SizeType Count,
+                                  const UInt32 Seed, UInt32* Out) noexcept
+    {
+        SizeType KeyIdx = 0;
+    #ifdef MEZZ_MURMUR_X86_SIMD
+        static const Boole HasAVX512 = __builtin_cpu_supports("avx512f");
+        static const Boole HasAVX2 = __builtin_cpu_supports("avx2");
+        static const Boole HasSSE41 = __builtin_cpu_supports("sse4.1");
+        if( HasAVX512 )
+        {
+            for( ; KeyIdx + 16 <= Count ; KeyIdx += 16 )
+                { MurmurHash3_x86_32_AVX512(Keys + KeyIdx,Lengths + KeyIdx,Seed,Out + KeyIdx); }
+        }
+        if( HasAVX2 )
+        {
+            for( ; KeyIdx + 8 <= Count ; KeyIdx += 8 )
+                { MurmurHash3_x86_32_AVX2(Keys + KeyIdx,Lengths + KeyIdx,Seed,Out + KeyIdx); }
+        }
+        if( HasSSE41 )
+        {
+            for( ; KeyIdx + 4 <= Count ; KeyIdx += 4 )
+                { MurmurHash3_x86_32_SSE41(Keys + KeyIdx,Lengths + KeyIdx,Seed,Out + KeyIdx); }
+        }
+    #endif // MEZZ_MURMUR_X86_SIMD
+        for( ; KeyIdx < Count ; ++KeyIdx )
+            { Out[KeyIdx] = MurmurHash3_x86_32(Keys[KeyIdx],Lengths[KeyIdx],Seed); }
+    }
+
+    MurmurHashResult_x86_128 MurmurHash3_x86_128(const void* Key, const SizeType Length, const UInt32 Seed) noexcept
+    {
+        const UInt8* Data = static_cast<const UInt8*>(Key);
+        const SizeType NumBlocks = Length / 16;
+        UInt32 State[4] = { Seed, Seed, Seed, Seed };
+        MixBlocks_x86_128(Data,NumBlocks,State);
+        return Finish_x86_128(Data + ( NumBlocks * 16 ),Length,State);
+    }
+
+    MurmurHashResult_x64_128 MurmurHash3_x64_128(const void* Key, const SizeType Length, const UInt32 Seed) noexcept
+    {
+        const UInt8* Data = static_cast<const UInt8*>(Key);
+        const SizeType NumBlocks = Length / 16;
+        UInt64 State[2] = { Seed, Seed };
+        MixBlocks_x64_128(Data,NumBlocks,State);
+        return Finish_x64_128(Data + ( NumBlocks * 16 ),Length,State);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // MurmurHash3Stream_x86_32 Methods
+
+    MurmurHash3Stream_x86_32::MurmurHash3Stream_x86_32(const UInt32 Seed) noexcept
+        { this->Reset(Seed); }
+
+    void MurmurHash3Stream_x86_32::Reset(const UInt32 Seed) noexcept
+    {
+        this->Hash = Seed;
+        this->TotalLength = 0;
+    }
+
+    void MurmurHash3Stream_x86_32::Update(const void* Data, const SizeType Length) noexcept
+    {
+        UpdateStream(this->Pending,this->TotalLength,static_cast<const UInt8*>(Data),Length,
+                     [this](const UInt8* Blocks, const SizeType NumBlocks) {
+            this->Hash = MixBlocks_x86_32(Blocks,NumBlocks,this->Hash);
+        });
+    }
+
+    UInt32 MurmurHash3Stream_x86_32::Finalize() const noexcept
+        { return Finish_x86_32(this->Pending,this->TotalLength,this->Hash); }
+
+    SizeType MurmurHash3Stream_x86_32::GetLength() const noexcept
+        { return this->TotalLength; }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // MurmurHash3Stream_x86_128 Methods
+
+    MurmurHash3Stream_x86_128::MurmurHash3Stream_x86_128(const UInt32 Seed) noexcept
+        { this->Reset(Seed); }
+
+    void MurmurHash3Stream_x86_128::Reset(const UInt32 Seed) noexcept
+    {
+        std::fill(std::begin(this->State),std::end(this->State),Seed);
+        this->TotalLength = 0;
+    }
+
+    void MurmurHash3Stream_x86_128::Update(const void* Data, const SizeType Length) noexcept
+    {
+        UpdateStream(this->Pending,this->TotalLength,static_cast<const UInt8*>(Data),Length,
+                     [this](const UInt8* Blocks, const SizeType NumBlocks) {
+            MixBlocks_x86_128(Blocks,NumBlocks,this->State);
+        });
+    }
+
+    MurmurHashResult_x86_128 MurmurHash3Stream_x86_128::Finalize() const noexcept
+        { return Finish_x86_128(this->Pending,this->TotalLength,this->State); }
+
+    SizeType MurmurHash3Stream_x86_128::GetLength() const noexcept
+        { return this->TotalLength; }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // MurmurHash3Stream_x64_128 Methods
+
+    MurmurHash3Stream_x64_128::MurmurHash3Stream_x64_128(const UInt32 Seed) noexcept
+        { this->Reset(Seed); }
+
+    void MurmurHash3Stream_x64_128::Reset(const UInt32 Seed) noexcept
+    {
+        std::fill(std::begin(this->State),std::end(this->State),Seed);
+        this->TotalLength = 0;
+    }
+
+    void MurmurHash3Stream_x64_128::Update(const void* Data, const SizeType Length) noexcept
+    {
+        UpdateStream(this->Pending,this->TotalLength,static_cast<const UInt8*>(Data),Length,
+                     [this](const UInt8* Blocks, const SizeType NumBlocks) {
+            MixBlocks_x64_128(Blocks,NumBlocks,this->State);
+        });
+    }
+
+    MurmurHashResult_x64_128 MurmurHash3Stream_x64_128::Finalize() const noexcept
+        { return Finish_x64_128(this->Pending,this->TotalLength,this->State); }
+
+    SizeType MurmurHash3Stream_x64_128::GetLength() const noexcept
+        { return this->TotalLength; }
 }//Hashing
 }//Mezzanine
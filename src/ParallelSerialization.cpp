@@ -0,0 +1,166 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+
+/// @file
+/// @brief The implementation of chunked parallel serialization.
+
+#include "ParallelSerialization.h"
+#include "MezzException.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Mezzanine
+{
+    void ParallelSerializeChunks(std::ostream& Stream,
+                                 const SizeType ItemCount,
+                                 const ParallelChunkOptions& Options,
+                                 const ChunkSerializeFunct& SerializeChunk)
+    {
+        if( Options.ChunkSize == 0 ) {
+            MEZZ_EXCEPTION(InvalidLengthCode, "Chunks must contain at least one item.")
+        }
+        const SizeType ChunkCount = ( ItemCount + Options.ChunkSize - 1 ) / Options.ChunkSize;
+        SizeType ThreadCount = Options.ThreadCount;
+        if( ThreadCount == 0 ) {
+            ThreadCount = std::max<SizeType>(std::thread::hardware_concurrency(),1);
+        }
+        ThreadCount = std::min(ThreadCount,ChunkCount);
+
+        if( ThreadCount <= 1 ) {
+            String Buffer;
+            for( SizeType Chunk = 0 ; Chunk < ChunkCount ; ++Chunk )
+            {
+                const SizeType Begin = Chunk * Options.ChunkSize;
+                Buffer.clear();
+                SerializeChunk( Begin, std::min(Begin + Options.ChunkSize,ItemCount), Buffer );
+                Stream.write( Buffer.data(), static_cast<std::streamsize>( Buffer.size() ) );
+            }
+            return;
+        }
+
+        const SizeType SlotCount = std::max<SizeType>( ( Options.MaxChunksInFlight != 0 ? Options.MaxChunksInFlight : ThreadCount * 2 ), 1 );
+        // Chunk N is always serialized into slot N modulo SlotCount.  A slot is only handed to a worker after
+        // the chunk that last used it has been written, so each buffer has a single owner at any time.
+        std::vector<String> Slots(SlotCount);
+        std::vector<UInt8> Ready(SlotCount,0);
+        std::mutex Lock;
+        std::condition_variable Changed;
+        SizeType NextChunk = 0;
+        SizeType Written = 0;
+        std::exception_ptr Failure;
+
+        auto Work = [&]() {
+            while( true )
+            {
+                std::unique_lock<std::mutex> Guard(Lock);
+                Changed.wait(Guard,[&]() {
+                    return Failure || NextChunk >= ChunkCount || NextChunk < Written + SlotCount;
+                });
+                if( Failure || NextChunk >= ChunkCount ) {
+                    return;
+                }
+                const SizeType Chunk = NextChunk++;
+                Guard.unlock();
+
+                String& Buffer = Slots[ Chunk % SlotCount ];
+                const SizeType Begin = Chunk * Options.ChunkSize;
+                try {
+                    SerializeChunk( Begin, std::min(Begin + Options.ChunkSize,ItemCount), Buffer );
+                }catch(...){
+                    Guard.lock();
+                    if( !Failure ) {
+                        Failure = std::current_exception();
+                    }
+                    Changed.notify_all();
+                    return;
+                }
+
+                Guard.lock();
+                Ready[ Chunk % SlotCount ] = 1;
+                Changed.notify_all();
+            }
+        };
+
+        std::vector<std::thread> Workers;
+        Workers.reserve(ThreadCount);
+        // Anything thrown here has to stop and join the workers first, destroying a joinable thread terminates.
+        try {
+            for( SizeType Count = 0 ; Count < ThreadCount ; ++Count )
+                { Workers.emplace_back(Work); }
+
+            for( SizeType Chunk = 0 ; Chunk < ChunkCount ; ++Chunk )
+            {
+                const SizeType Slot = Chunk % SlotCount;
+                {
+                    std::unique_lock<std::mutex> Guard(Lock);
+                    Changed.wait(Guard,[&]() { return Failure || Ready[Slot] != 0; });
+                    if( Failure ) {
+                        break;
+                    }
+                }
+
+                Stream.write( Slots[Slot].data(), static_cast<std::streamsize>( Slots[Slot].size() ) );
+                Slots[Slot].clear();
+
+                std::lock_guard<std::mutex> Guard(Lock);
+                Ready[Slot] = 0;
+                Written = Chunk + 1;
+                Changed.notify_all();
+            }
+        }catch(...){
+            std::lock_guard<std::mutex> Guard(Lock);
+            if( !Failure ) {
+                Failure = std::current_exception();
+            }
+            Changed.notify_all();
+        }
+
+        for( std::thread& Worker : Workers )
+            { Worker.join(); }
+        if( Failure ) {
+            std::rethrow_exception(Failure);
+        }
+    }
+}//Mezzanine
@@ -0,0 +1,123 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+
+/// @file
+/// @brief The implementation of the runtime registry of registered classes.
+
+#include "RuntimeRegistry.h"
+#include "MezzException.h"
+
+namespace Mezzanine
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // RuntimeClassInfo
+
+    void RuntimeClassInfo::CheckType(const std::type_info& ObjectType) const
+    {
+        if( this->Type == nullptr || *(this->Type) != ObjectType ) {
+            MEZZ_EXCEPTION(BadCastCode, "Object is not an instance of the described class.")
+        }
+    }
+
+    const RuntimeMemberInfo& RuntimeClassInfo::GetMember(const SizeType Index) const
+    {
+        if( Index >= this->Members.size() ) {
+            MEZZ_EXCEPTION(OutOfRangeCode, "Member index is out of bounds.")
+        }
+        return this->Members[Index];
+    }
+
+    const RuntimeMemberInfo* RuntimeClassInfo::FindMember(const StringView MemberName) const
+    {
+        IndexContainer::const_iterator Found = this->MemberIndex.find(MemberName);
+        return ( Found != this->MemberIndex.end() ? &(this->Members[Found->second]) : nullptr );
+    }
+
+    const RuntimeMemberInfo& RuntimeClassInfo::GetMember(const StringView MemberName) const
+    {
+        const RuntimeMemberInfo* Found = this->FindMember(MemberName);
+        if( Found == nullptr ) {
+            MEZZ_EXCEPTION(OutOfRangeCode, "No member is registered with the requested name.")
+        }
+        return *Found;
+    }
+
+    RuntimeValue RuntimeClassInfo::GetValue(const void* Object, const StringView MemberName) const
+        { return this->GetMember(MemberName).Getter(Object); }
+
+    void RuntimeClassInfo::SetValue(void* Object, const StringView MemberName, const RuntimeValue& Value) const
+        { this->GetMember(MemberName).Setter(Object,Value); }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // RuntimeRegistry
+
+    const RuntimeClassInfo& RuntimeRegistry::Insert(RuntimeClassInfo&& Info)
+    {
+        std::pair<ClassContainer::iterator,Boole> Result = this->Classes.try_emplace( Info.GetName(), std::move(Info) );
+        if( !Result.second ) {
+            MEZZ_EXCEPTION(BadCastCode, "A different class is already registered with the same name.")
+        }
+        return Result.first->second;
+    }
+
+    RuntimeRegistry& RuntimeRegistry::GetGlobal()
+    {
+        static RuntimeRegistry Global;
+        return Global;
+    }
+
+    const RuntimeClassInfo* RuntimeRegistry::Find(const StringView Name) const
+    {
+        ClassContainer::const_iterator Found = this->Classes.find(Name);
+        return ( Found != this->Classes.end() ? &(Found->second) : nullptr );
+    }
+
+    const RuntimeClassInfo& RuntimeRegistry::Get(const StringView Name) const
+    {
+        const RuntimeClassInfo* Found = this->Find(Name);
+        if( Found == nullptr ) {
+            MEZZ_EXCEPTION(OutOfRangeCode, "No class is registered with the requested name.")
+        }
+        return *Found;
+    }
+
+    void RuntimeRegistry::Clear()
+        { this->Classes.clear(); }
+}//Mezzanine
@@ -0,0 +1,137 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+
+/// @file
+/// @brief The implementation of the string interning pool.
+
+#include "StringInternPool.h"
+
+namespace Mezzanine
+{
+    StringInternPool::Table::Table(const SizeType SlotCount) :
+        Slots( new std::atomic<const Entry*>[SlotCount] ),
+        Mask( SlotCount - 1 )
+    {
+        for( SizeType SlotIdx = 0 ; SlotIdx < SlotCount ; ++SlotIdx )
+            { this->Slots[SlotIdx].store(nullptr,std::memory_order_relaxed); }
+    }
+
+    StringInternPool::StringInternPool(const SizeType InitialCapacity)
+    {
+        // Keep the table at most half full so probe sequences stay short.
+        SizeType SlotCount = 16;
+        while( SlotCount < InitialCapacity * 2 )
+            { SlotCount *= 2; }
+        this->Tables.push_back( std::make_unique<Table>(SlotCount) );
+        this->CurrentTable.store(this->Tables.back().get(),std::memory_order_release);
+    }
+
+    const StringInternPool::Entry* StringInternPool::Probe(const Table& Probed, const StringView Text,
+                                                           const UInt32 Hash) noexcept
+    {
+        SizeType SlotIdx = Hash & Probed.Mask;
+        while( true )
+        {
+            const Entry* Current = Probed.Slots[SlotIdx].load(std::memory_order_acquire);
+            if( Current == nullptr ) {
+                return nullptr;
+            }else if( Current->Hash == Hash && Current->Text == Text ) {
+                return Current;
+            }
+            SlotIdx = ( SlotIdx + 1 ) & Probed.Mask;
+        }
+    }
+
+    void StringInternPool::Insert(Table& Dest, const Entry* ToInsert) noexcept
+    {
+        SizeType SlotIdx = ToInsert->Hash & Dest.Mask;
+        while( Dest.Slots[SlotIdx].load(std::memory_order_relaxed) != nullptr )
+            { SlotIdx = ( SlotIdx + 1 ) & Dest.Mask; }
+        Dest.Slots[SlotIdx].store(ToInsert,std::memory_order_release);
+    }
+
+    StringInternPool& StringInternPool::GetGlobal()
+    {
+        static StringInternPool Global;
+        return Global;
+    }
+
+    const StringInternPool::Entry& StringInternPool::Intern(const StringView Text, const UInt32 Hash)
+    {
+        if( const Entry* Existing = this->Find(Text,Hash) ) {
+            return *Existing;
+        }
+
+        std::lock_guard<std::mutex> Lock(this->WriteLock);
+        // Another thread may have added it between the lookup and taking the lock.
+        Table* Current = this->CurrentTable.load(std::memory_order_relaxed);
+        if( const Entry* Existing = Probe(*Current,Text,Hash) ) {
+            return *Existing;
+        }
+
+        this->Arena.push_back( Entry{ String(Text), Hash } );
+        const Entry* Added = &(this->Arena.back());
+        if( this->Arena.size() * 2 > Current->Mask + 1 ) {
+            // Build the larger table completely before publishing it, and keep the old one for any readers
+            // that are still probing it.
+            std::unique_ptr<Table> Grown = std::make_unique<Table>( ( Current->Mask + 1 ) * 2 );
+            for( const Entry& Existing : this->Arena )
+                { Insert(*Grown,&Existing); }
+            Current = Grown.get();
+            this->Tables.push_back( std::move(Grown) );
+            this->CurrentTable.store(Current,std::memory_order_release);
+        }else{
+            Insert(*Current,Added);
+        }
+        return *Added;
+    }
+
+    const StringInternPool::Entry* StringInternPool::Find(const StringView Text, const UInt32 Hash) const noexcept
+        { return Probe(*( this->CurrentTable.load(std::memory_order_acquire) ),Text,Hash); }
+
+    SizeType StringInternPool::GetCount() const
+    {
+        std::lock_guard<std::mutex> Lock(this->WriteLock);
+        return this->Arena.size();
+    }
+
+    SizeType StringInternPool::GetCapacity() const noexcept
+        { return ( this->CurrentTable.load(std::memory_order_acquire)->Mask + 1 ) / 2; }
+}//Mezzanine
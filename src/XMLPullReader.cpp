@@ -0,0 +1,431 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+
+/// @file
+/// @brief The implementation of the streaming XML pull parser.
+
+#include "XMLPullReader.h"
+
+#include <cstring>
+
+namespace
+{
+    using namespace Mezzanine;
+
+    /// @brief The value returned by a stream buffer when it is exhausted.
+    constexpr int EndOfStream = std::char_traits<char>::eof();
+
+    /// @brief Checks to see if a character read from a stream is XML whitespace.
+    /// @param ToCheck The character to check.
+    /// @return Returns true if the character is a space, tab, carriage return or line feed.
+    Boole IsXMLWhitespace(const int ToCheck)
+        { return ToCheck == ' ' || ToCheck == '\t' || ToCheck == '\r' || ToCheck == '\n'; }
+    /// @brief Checks to see if a character read from a stream ends a name.
+    /// @param ToCheck The character to check.
+    /// @return Returns true if the character can't be part of an element or attribute name.
+    Boole IsNameEnd(const int ToCheck)
+    {
+        return ToCheck == EndOfStream || IsXMLWhitespace(ToCheck) ||
+               ToCheck == '/' || ToCheck == '>' || ToCheck == '=' || ToCheck == '<';
+    }
+    /// @brief Appends a code point to a String as UTF-8.
+    /// @param CodePoint The code point to append.
+    /// @param Dest The String to append to.
+    /// @return Returns false if the code point is out of range, true otherwise.
+    Boole AppendUTF8(const UInt32 CodePoint, String& Dest)
+    {
+        if( CodePoint < 0x80 ) {
+            Dest.push_back( static_cast<char>(CodePoint) );
+        }else if( CodePoint < 0x800 ) {
+            Dest.push_back( static_cast<char>( 0xC0 | ( CodePoint >> 6 ) ) );
+            Dest.push_back( static_cast<char>( 0x80 | ( CodePoint & 0x3F ) ) );
+        }else if( CodePoint < 0x10000 ) {
+            Dest.push_back( static_cast<char>( 0xE0 | ( CodePoint >> 12 ) ) );
+            Dest.push_back( static_cast<char>( 0x80 | ( ( CodePoint >> 6 ) & 0x3F ) ) );
+            Dest.push_back( static_cast<char>( 0x80 | ( CodePoint & 0x3F ) ) );
+        }else if( CodePoint < 0x110000 ) {
+            Dest.push_back( static_cast<char>( 0xF0 | ( CodePoint >> 18 ) ) );
+            Dest.push_back( static_cast<char>( 0x80 | ( ( CodePoint >> 12 ) & 0x3F ) ) );
+            Dest.push_back( static_cast<char>( 0x80 | ( ( CodePoint >> 6 ) & 0x3F ) ) );
+            Dest.push_back( static_cast<char>( 0x80 | ( CodePoint & 0x3F ) ) );
+        }else{
+            return false;
+        }
+        return true;
+    }
+}
+
+namespace Mezzanine
+{
+    ///////////////////////////////////////////////////////////////////////////////
+    // XMLPullReader Utility
+
+    void XMLPullReader::Expect(const char Expected)
+    {
+        if( this->Bump() != static_cast<unsigned char>(Expected) ) {
+            this->ThrowMalformed("Unexpected character in tag.");
+        }
+    }
+
+    void XMLPullReader::SkipWhitespace()
+    {
+        while( IsXMLWhitespace( this->Peek() ) )
+            { this->Bump(); }
+    }
+
+    void XMLPullReader::SkipPast(const StringView Terminator, String* Dest)
+    {
+        // Matched counts how much of the terminator the most recent characters match.  On a mismatch the
+        // candidate is the matched prefix plus the new character, which is shifted until what remains is a
+        // prefix of the terminator again.  Terminators are only a few characters so this stays cheap.
+        SizeType Matched = 0;
+        while( Matched < Terminator.size() )
+        {
+            const int Current = this->Bump();
+            if( Current == EndOfStream ) {
+                this->ThrowMalformed("Unexpected end of stream.");
+            }
+            const char Next = static_cast<char>(Current);
+            if( Next == Terminator[Matched] ) {
+                ++Matched;
+                continue;
+            }
+
+            auto CandidateAt = [&](const SizeType Index) {
+                return ( Index < Matched ? Terminator[Index] : Next );
+            };
+            SizeType Shift = 1;
+            for( ; Shift <= Matched ; ++Shift )
+            {
+                Boole IsPrefix = true;
+                for( SizeType Index = Shift ; Index <= Matched && IsPrefix ; ++Index )
+                    { IsPrefix = ( CandidateAt(Index) == Terminator[Index - Shift] ); }
+                if( IsPrefix ) {
+                    break;
+                }
+            }
+            if( Dest != nullptr ) {
+                for( SizeType Index = 0 ; Index < Shift ; ++Index )
+                    { Dest->push_back( CandidateAt(Index) ); }
+            }
+            Matched = Matched + 1 - Shift;
+        }
+    }
+
+    void XMLPullReader::ReadName(String& Dest)
+    {
+        const SizeType Start = Dest.size();
+        while( !IsNameEnd( this->Peek() ) )
+            { Dest.push_back( static_cast<char>( this->Bump() ) ); }
+        if( Dest.size() == Start ) {
+            this->ThrowMalformed("Expected a name.");
+        }
+    }
+
+    void XMLPullReader::ReadReference(String& Dest)
+    {
+        char Reference[12];
+        SizeType Length = 0;
+        int Current = this->Bump();
+        while( Current != ';' )
+        {
+            if( Current == EndOfStream || Length == sizeof(Reference) ) {
+                this->ThrowMalformed("Unterminated character reference.");
+            }
+            Reference[Length++] = static_cast<char>(Current);
+            Current = this->Bump();
+        }
+
+        const StringView Name(Reference,Length);
+        if( Name == "lt" ) {
+            Dest.push_back('<');
+        }else if( Name == "gt" ) {
+            Dest.push_back('>');
+        }else if( Name == "amp" ) {
+            Dest.push_back('&');
+        }else if( Name == "quot" ) {
+            Dest.push_back('"');
+        }else if( Name == "apos" ) {
+            Dest.push_back('\'');
+        }else if( Length > 1 && Name[0] == '#' ) {
+            const Boole Hex = ( Name[1] == 'x' || Name[1] == 'X' );
+            const char* Start = Reference + ( Hex ? 2 : 1 );
+            const char* End = Reference + Length;
+            UInt32 CodePoint = 0;
+            std::from_chars_result Result = std::from_chars(Start,End,CodePoint,Hex ? 16 : 10);
+            if( Start == End || Result.ec != std::errc() || Result.ptr != End || !AppendUTF8(CodePoint,Dest) ) {
+                this->ThrowMalformed("Invalid numeric character reference.");
+            }
+        }else{
+            this->ThrowMalformed("Unknown entity reference.");
+        }
+    }
+
+    Boole XMLPullReader::ReadAttributes()
+    {
+        while( true )
+        {
+            this->SkipWhitespace();
+            int Current = this->Peek();
+            if( Current == '>' ) {
+                this->Bump();
+                return false;
+            }else if( Current == '/' ) {
+                this->Bump();
+                this->Expect('>');
+                return true;
+            }else if( Current == EndOfStream ) {
+                this->ThrowMalformed("Unexpected end of stream.");
+            }
+
+            AttributeSpan Span;
+            Span.NameStart = this->AttributeData.size();
+            this->ReadName(this->AttributeData);
+            Span.NameLength = this->AttributeData.size() - Span.NameStart;
+            this->SkipWhitespace();
+            this->Expect('=');
+            this->SkipWhitespace();
+            const int Quote = this->Bump();
+            if( Quote != '"' && Quote != '\'' ) {
+                this->ThrowMalformed("Attribute values must be quoted.");
+            }
+            Span.ValueStart = this->AttributeData.size();
+            Current = this->Bump();
+            while( Current != Quote )
+            {
+                if( Current == EndOfStream || Current == '<' ) {
+                    this->ThrowMalformed("Unterminated attribute value.");
+                }else if( Current == '&' ) {
+                    this->ReadReference(this->AttributeData);
+                }else{
+                    this->AttributeData.push_back( static_cast<char>(Current) );
+                }
+                Current = this->Bump();
+            }
+            Span.ValueLength = this->AttributeData.size() - Span.ValueStart;
+            this->Attributes.push_back(Span);
+        }
+    }
+
+    Boole XMLPullReader::ReadText()
+    {
+        Boole HasContent = false;
+        int Current = this->Peek();
+        while( Current != '<' && Current != EndOfStream )
+        {
+            this->Bump();
+            if( Current == '&' ) {
+                this->ReadReference(this->TextData);
+                HasContent = true;
+            }else{
+                HasContent = HasContent || !IsXMLWhitespace(Current);
+                this->TextData.push_back( static_cast<char>(Current) );
+            }
+            Current = this->Peek();
+        }
+        return HasContent;
+    }
+
+    void XMLPullReader::PopElement()
+    {
+        this->NameStack.resize( this->NameOffsets.back() );
+        this->NameOffsets.pop_back();
+        this->Finished = this->NameOffsets.empty();
+    }
+
+    StringView XMLPullReader::GetOpenName() const
+        { return StringView(this->NameStack).substr( this->NameOffsets.back() ); }
+
+    void XMLPullReader::ThrowMalformed(const char* Message) const
+        { MEZZ_EXCEPTION(EncodingCode, Message) }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // XMLPullReader Construction
+
+    XMLPullReader::XMLPullReader(std::istream& Input) :
+        Stream(Input),
+        Source(Input.rdbuf())
+        {  }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // XMLPullReader Reading
+
+    XMLPullReader::EventType XMLPullReader::Next()
+    {
+        this->Attributes.clear();
+        this->AttributeData.clear();
+        this->TextData.clear();
+
+        if( this->PendingEnd ) {
+            this->PendingEnd = false;
+            this->CurrentDepth = this->NameOffsets.size();
+            this->PopElement();
+            return ( this->CurrentEvent = EventType::EndElement );
+        }
+        if( this->Finished ) {
+            this->CurrentDepth = 0;
+            return ( this->CurrentEvent = EventType::EndOfDocument );
+        }
+
+        while( true )
+        {
+            if( this->NameOffsets.empty() ) {
+                this->SkipWhitespace();
+            }
+            int Current = this->Peek();
+            if( Current == EndOfStream ) {
+                if( !this->NameOffsets.empty() ) {
+                    this->ThrowMalformed("Unexpected end of stream.");
+                }
+                this->Stream.setstate(std::ios_base::eofbit);
+                this->Finished = true;
+                this->CurrentDepth = 0;
+                return ( this->CurrentEvent = EventType::EndOfDocument );
+            }
+
+            if( Current != '<' ) {
+                if( this->NameOffsets.empty() ) {
+                    this->ThrowMalformed("Text found outside of the root element.");
+                }
+                if( this->ReadText() ) {
+                    this->CurrentDepth = this->NameOffsets.size();
+                    return ( this->CurrentEvent = EventType::Text );
+                }
+                this->TextData.clear();
+                continue;
+            }
+
+            this->Bump();
+            Current = this->Peek();
+            if( Current == '?' ) {
+                this->SkipPast("?>",nullptr);
+            }else if( Current == '!' ) {
+                this->Bump();
+                if( this->Peek() == '-' ) {
+                    this->Bump();
+                    this->Expect('-');
+                    this->SkipPast("-->",nullptr);
+                }else if( this->Peek() == '[' ) {
+                    for( const char Expected : StringView("[CDATA[") )
+                        { this->Expect(Expected); }
+                    this->SkipPast("]]>",&(this->TextData));
+                    this->CurrentDepth = this->NameOffsets.size();
+                    return ( this->CurrentEvent = EventType::Text );
+                }else{
+                    this->SkipPast(">",nullptr);
+                }
+            }else if( Current == '/' ) {
+                this->Bump();
+                this->ElementName.clear();
+                this->ReadName(this->ElementName);
+                this->SkipWhitespace();
+                this->Expect('>');
+                if( this->NameOffsets.empty() || this->GetOpenName() != this->ElementName ) {
+                    this->ThrowMalformed("Closing tag does not match the open element.");
+                }
+                this->CurrentDepth = this->NameOffsets.size();
+                this->PopElement();
+                return ( this->CurrentEvent = EventType::EndElement );
+            }else{
+                this->ElementName.clear();
+                this->ReadName(this->ElementName);
+                this->PendingEnd = this->ReadAttributes();
+                this->NameOffsets.push_back( this->NameStack.size() );
+                this->NameStack.append(this->ElementName);
+                this->CurrentDepth = this->NameOffsets.size();
+                return ( this->CurrentEvent = EventType::StartElement );
+            }
+        }
+    }
+
+    Boole XMLPullReader::NextChildElement(const SizeType ParentDepth)
+    {
+        while( true )
+        {
+            EventType Event = this->Next();
+            if( Event == EventType::StartElement && this->CurrentDepth == ParentDepth + 1 ) {
+                return true;
+            }else if( Event == EventType::EndElement && this->CurrentDepth <= ParentDepth ) {
+                return false;
+            }else if( Event == EventType::EndOfDocument ) {
+                return false;
+            }
+        }
+    }
+
+    void XMLPullReader::SkipElement()
+    {
+        const SizeType Depth = this->CurrentDepth;
+        while( this->CurrentEvent != EventType::EndOfDocument )
+        {
+            if( this->Next() == EventType::EndElement && this->CurrentDepth == Depth ) {
+                return;
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // XMLPullReader Current Event Query
+
+    StringView XMLPullReader::GetAttributeName(const SizeType Index) const
+    {
+        const AttributeSpan& Span = this->Attributes.at(Index);
+        return StringView(this->AttributeData).substr(Span.NameStart,Span.NameLength);
+    }
+
+    StringView XMLPullReader::GetAttributeValue(const SizeType Index) const
+    {
+        const AttributeSpan& Span = this->Attributes.at(Index);
+        return StringView(this->AttributeData).substr(Span.ValueStart,Span.ValueLength);
+    }
+
+    Boole XMLPullReader::FindAttribute(const StringView Name, StringView& Value) const
+    {
+        const StringView Data(this->AttributeData);
+        for( const AttributeSpan& Span : this->Attributes )
+        {
+            if( Data.substr(Span.NameStart,Span.NameLength) == Name ) {
+                Value = Data.substr(Span.ValueStart,Span.ValueLength);
+                return true;
+            }
+        }
+        return false;
+    }
+}//Mezzanine
@@ -0,0 +1,785 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+
+/// @file
+/// @brief This file contains the implementation of the XXH3 hash functions.
+
+//-----------------------------------------------------------------------------
+// xxHash - Extremely Fast Hash algorithm
+// Copyright (C) 2012-2023 Yann Collet
+//
+// BSD 2-Clause License (https://www.opensource.org/licenses/bsd-license.php)
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//    * Redistributions of source code must retain the above copyright
+//      notice, this list of conditions and the following disclaimer.
+//    * Redistributions in binary form must reproduce the above
+//      copyright notice, this list of conditions and the following disclaimer
+//      in the documentation and/or other materials provided with the
+//      distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "XXHash.h"
+
+#include <cstring>
+#include <iterator>
+
+#if ( defined(__GNUC__) || defined(__clang__) ) && ( defined(__x86_64__) || defined(__i386__) )
+    #define MEZZ_XXHASH_X86_SIMD
+    // GCC warns about the deliberately undefined vectors its own AVX-512 wrappers start from.
+    SAVE_WARNING_STATE
+    SUPPRESS_GCC_WARNING("-Wmaybe-uninitialized")
+    #include <immintrin.h>
+    RESTORE_WARNING_STATE
+#endif
+
+namespace {
+    using namespace Mezzanine;
+    using Hashing::XXHashResult_128;
+
+    //-----------------------------------------------------------------------------
+    // Constants
+
+    const UInt32 Prime32_1 = 0x9E3779B1U;
+    const UInt32 Prime32_2 = 0x85EBCA77U;
+    const UInt32 Prime32_3 = 0xC2B2AE3DU;
+
+    SAVE_WARNING_STATE
+    SUPPRESS_CLANG_WARNING("-Wc++98-compat-pedantic")
+    const UInt64 Prime64_1 = 0x9E3779B185EBCA87ULL;
+    const UInt64 Prime64_2 = 0xC2B2AE3D27D4EB4FULL;
+    const UInt64 Prime64_3 = 0x165667B19E3779F9ULL;
+    const UInt64 Prime64_4 = 0x85EBCA77C2B2AE63ULL;
+    const UInt64 Prime64_5 = 0x27D4EB2F165667C5ULL;
+    const UInt64 PrimeMX1 = 0x165667919E3779F9ULL;
+    const UInt64 PrimeMX2 = 0x9FB21C651E98DF25ULL;
+    RESTORE_WARNING_STATE
+
+    /// @brief The number of bytes consumed by each accumulation round.
+    constexpr SizeType StripeLength = 64;
+    /// @brief The number of secret bytes the secret window advances by for each stripe.
+    constexpr SizeType SecretConsumeRate = 8;
+    /// @brief The number of 64-bit accumulators.
+    constexpr SizeType AccumulatorCount = 8;
+    /// @brief The largest input hashed without the accumulators.
+    constexpr SizeType MidSizeMax = 240;
+    /// @brief The smallest secret the algorithm is defined for.
+    constexpr SizeType SecretSizeMin = 136;
+    constexpr SizeType MidSizeStartOffset = 3;
+    constexpr SizeType MidSizeLastOffset = 17;
+    constexpr SizeType SecretLastAccStart = 7;
+    constexpr SizeType SecretMergeAccsStart = 11;
+    /// @brief The byte size of the secret.
+    constexpr SizeType SecretSize = Hashing::XXHash3Stream::SecretSize;
+    /// @brief The offset of the secret bytes used when scrambling.
+    constexpr SizeType SecretLimit = SecretSize - StripeLength;
+    /// @brief The number of stripes between scrambles.
+    constexpr SizeType StripesPerBlock = SecretLimit / SecretConsumeRate;
+    /// @brief The byte size of the input between scrambles.
+    constexpr SizeType BlockLength = StripeLength * StripesPerBlock;
+
+    /// @brief The default secret, which is pseudorandom data taken from FARSH.
+    alignas(64) const UInt8 DefaultSecret[SecretSize] = {
+        0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+        0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+        0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+        0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+        0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+        0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+        0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+        0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+        0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+        0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+        0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+        0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e
+    };
+
+    //-----------------------------------------------------------------------------
+    // Integer helpers - reads are little-endian, if your platform needs to do
+    // endian-swapping or can only handle aligned reads, do the conversion here
+
+    inline UInt32 Read32(const UInt8* Source) noexcept
+    {
+        UInt32 Result;
+        std::memcpy(&Result,Source,sizeof(Result));
+        return Result;
+    }
+
+    inline UInt64 Read64(const UInt8* Source) noexcept
+    {
+        UInt64 Result;
+        std::memcpy(&Result,Source,sizeof(Result));
+        return Result;
+    }
+
+    inline void Write64(UInt8* Dest, const UInt64 Value) noexcept
+        { std::memcpy(Dest,&Value,sizeof(Value)); }
+
+    inline UInt32 Swap32(const UInt32 Value) noexcept
+    {
+        return ( ( Value << 24 ) & 0xff000000 ) | ( ( Value << 8 ) & 0x00ff0000 ) |
+               ( ( Value >> 8 ) & 0x0000ff00 ) | ( ( Value >> 24 ) & 0x000000ff );
+    }
+
+    inline UInt64 Swap64(const UInt64 Value) noexcept
+    {
+        return ( static_cast<UInt64>( Swap32( static_cast<UInt32>(Value) ) ) << 32 ) |
+               Swap32( static_cast<UInt32>( Value >> 32 ) );
+    }
+
+    inline UInt32 Rotl32(const UInt32 Value, const int Shift) noexcept
+        { return ( Value << Shift ) | ( Value >> ( 32 - Shift ) ); }
+
+    inline UInt64 Rotl64(const UInt64 Value, const int Shift) noexcept
+        { return ( Value << Shift ) | ( Value >> ( 64 - Shift ) ); }
+
+    inline UInt64 XorShift64(const UInt64 Value, const int Shift) noexcept
+        { return Value ^ ( Value >> Shift ); }
+
+    /// @brief Multiplies two 64-bit integers into a 128-bit product.
+    /// @param Left The first factor.
+    /// @param Right The second factor.
+    /// @return Returns the low 64 bits of the product in Hash[0] and the high 64 bits in Hash[1].
+    inline XXHashResult_128 Multiply128(const UInt64 Left, const UInt64 Right) noexcept
+    {
+        XXHashResult_128 Result;
+    #if defined(__SIZEOF_INT128__)
+        SAVE_WARNING_STATE
+        SUPPRESS_GCC_WARNING("-Wpedantic")
+        SUPPRESS_CLANG_WARNING("-Wpedantic")
+        using UInt128 = unsigned __int128;
+        RESTORE_WARNING_STATE
+        const UInt128 Product = static_cast<UInt128>(Left) * Right;
+        Result.Hash[0] = static_cast<UInt64>(Product);
+        Result.Hash[1] = static_cast<UInt64>( Product >> 64 );
+    #else
+        const UInt64 LowLow = ( Left & 0xFFFFFFFF ) * ( Right & 0xFFFFFFFF );
+        const UInt64 HighLow = ( Left >> 32 ) * ( Right & 0xFFFFFFFF );
+        const UInt64 LowHigh = ( Left & 0xFFFFFFFF ) * ( Right >> 32 );
+        const UInt64 HighHigh = ( Left >> 32 ) * ( Right >> 32 );
+        const UInt64 Cross = ( LowLow >> 32 ) + ( HighLow & 0xFFFFFFFF ) + LowHigh;
+        Result.Hash[0] = ( Cross << 32 ) | ( LowLow & 0xFFFFFFFF );
+        Result.Hash[1] = ( HighLow >> 32 ) + ( Cross >> 32 ) + HighHigh;
+    #endif
+        return Result;
+    }
+
+    /// @brief Multiplies two 64-bit integers and folds the 128-bit product in half.
+    /// @param Left The first factor.
+    /// @param Right The second factor.
+    /// @return Returns the low and high halves of the product xored together.
+    inline UInt64 MultiplyFold64(const UInt64 Left, const UInt64 Right) noexcept
+    {
+        const XXHashResult_128 Product = Multiply128(Left,Right);
+        return Product.Hash[0] ^ Product.Hash[1];
+    }
+
+    //-----------------------------------------------------------------------------
+    // Finalization mixes - force all bits of a hash to avalanche
+
+    inline UInt64 Avalanche(UInt64 ToMix) noexcept
+    {
+        ToMix = XorShift64(ToMix,37);
+        ToMix *= PrimeMX1;
+        return XorShift64(ToMix,32);
+    }
+
+    inline UInt64 Avalanche64(UInt64 ToMix) noexcept
+    {
+        ToMix ^= ToMix >> 33;
+        ToMix *= Prime64_2;
+        ToMix ^= ToMix >> 29;
+        ToMix *= Prime64_3;
+        ToMix ^= ToMix >> 32;
+        return ToMix;
+    }
+
+    inline UInt64 RotateMultiplyMix(UInt64 ToMix, const UInt64 Length) noexcept
+    {
+        ToMix ^= Rotl64(ToMix,49) ^ Rotl64(ToMix,24);
+        ToMix *= PrimeMX2;
+        ToMix ^= ( ToMix >> 35 ) + Length;
+        ToMix *= PrimeMX2;
+        return XorShift64(ToMix,28);
+    }
+
+    //-----------------------------------------------------------------------------
+    // Short inputs, 240 bytes or less
+
+    /// @brief Mixes 16 bytes of input with 16 bytes of secret.
+    /// @param Input A pointer to the bytes to mix.
+    /// @param Secret A pointer to the secret bytes to mix with.
+    /// @param Seed The base number to salt the hash with.
+    /// @return Returns the mixed value.
+    inline UInt64 Mix16(const UInt8* Input, const UInt8* Secret, const UInt64 Seed) noexcept
+    {
+        return MultiplyFold64( Read64(Input) ^ ( Read64(Secret) + Seed ),
+                               Read64(Input + 8) ^ ( Read64(Secret + 8) - Seed ) );
+    }
+
+    /// @brief Mixes 32 bytes of input into a 128-bit accumulator.
+    /// @param Acc The accumulator to mix into.
+    /// @param First A pointer to the first 16 bytes to mix.
+    /// @param Second A pointer to the second 16 bytes to mix.
+    /// @param Secret A pointer to the secret bytes to mix with.
+    /// @param Seed The base number to salt the hash with.
+    /// @return Returns the updated accumulator.
+    inline XXHashResult_128 Mix32(XXHashResult_128 Acc, const UInt8* First, const UInt8* Second,
+                                  const UInt8* Secret, const UInt64 Seed) noexcept
+    {
+        Acc.Hash[0] += Mix16(First,Secret,Seed);
+        Acc.Hash[0] ^= Read64(Second) + Read64(Second + 8);
+        Acc.Hash[1] += Mix16(Second,Secret + 16,Seed);
+        Acc.Hash[1] ^= Read64(First) + Read64(First + 8);
+        return Acc;
+    }
+
+    UInt64 HashShort_64(const UInt8* Input, const SizeType Length, const UInt64 Seed) noexcept
+    {
+        const UInt8* Secret = DefaultSecret;
+        const UInt64 Length64 = static_cast<UInt64>(Length);
+        if( Length > 128 ) {
+            UInt64 Acc = Length64 * Prime64_1;
+            for( SizeType Round = 0 ; Round < 8 ; ++Round )
+                { Acc += Mix16(Input + ( 16 * Round ),Secret + ( 16 * Round ),Seed); }
+            UInt64 AccEnd = Mix16(Input + Length - 16,Secret + SecretSizeMin - MidSizeLastOffset,Seed);
+            Acc = Avalanche(Acc);
+            const SizeType RoundCount = Length / 16;
+            for( SizeType Round = 8 ; Round < RoundCount ; ++Round )
+                { AccEnd += Mix16(Input + ( 16 * Round ),Secret + ( 16 * ( Round - 8 ) ) + MidSizeStartOffset,Seed); }
+            return Avalanche(Acc + AccEnd);
+        }else if( Length > 16 ) {
+            UInt64 Acc = Length64 * Prime64_1;
+            if( Length > 32 ) {
+                if( Length > 64 ) {
+                    if( Length > 96 ) {
+                        Acc += Mix16(Input + 48,Secret + 96,Seed);
+                        Acc += Mix16(Input + Length - 64,Secret + 112,Seed);
+                    }
+                    Acc += Mix16(Input + 32,Secret + 64,Seed);
+                    Acc += Mix16(Input + Length - 48,Secret + 80,Seed);
+                }
+                Acc += Mix16(Input + 16,Secret + 32,Seed);
+                Acc += Mix16(Input + Length - 32,Secret + 48,Seed);
+            }
+            Acc += Mix16(Input,Secret,Seed);
+            Acc += Mix16(Input + Length - 16,Secret + 16,Seed);
+            return Avalanche(Acc);
+        }else if( Length > 8 ) {
+            const UInt64 BitFlipLow = ( Read64(Secret + 24) ^ Read64(Secret + 32) ) + Seed;
+            const UInt64 BitFlipHigh = ( Read64(Secret + 40) ^ Read64(Secret + 48) ) - Seed;
+            const UInt64 InputLow = Read64(Input) ^ BitFlipLow;
+            const UInt64 InputHigh = Read64(Input + Length - 8) ^ BitFlipHigh;
+            const UInt64 Acc = Length64 + Swap64(InputLow) + InputHigh + MultiplyFold64(InputLow,InputHigh);
+            return Avalanche(Acc);
+        }else if( Length >= 4 ) {
+            const UInt64 SwappedSeed = Seed ^ ( static_cast<UInt64>( Swap32( static_cast<UInt32>(Seed) ) ) << 32 );
+            const UInt32 InputFirst = Read32(Input);
+            const UInt32 InputLast = Read32(Input + Length - 4);
+            const UInt64 BitFlip = ( Read64(Secret + 8) ^ Read64(Secret + 16) ) - SwappedSeed;
+            const UInt64 Input64 = InputLast + ( static_cast<UInt64>(InputFirst) << 32 );
+            return RotateMultiplyMix(Input64 ^ BitFlip,Length64);
+        }else if( Length > 0 ) {
+            const UInt32 Combined = ( static_cast<UInt32>( Input[0] ) << 16 ) |
+                                    ( static_cast<UInt32>( Input[Length >> 1] ) << 24 ) |
+                                    ( static_cast<UInt32>( Input[Length - 1] ) << 0 ) |
+                                    ( static_cast<UInt32>(Length) << 8 );
+            const UInt64 BitFlip = ( Read32(Secret) ^ Read32(Secret + 4) ) + Seed;
+            return Avalanche64( static_cast<UInt64>(Combined) ^ BitFlip );
+        }
+        return Avalanche64( Seed ^ ( Read64(Secret + 56) ^ Read64(Secret + 64) ) );
+    }
+
+    /// @brief Finishes a 128-bit hash of 17 to 240 bytes.
+    /// @param Acc The accumulator after all of the input has been mixed.
+    /// @param Length The byte length of the input.
+    /// @param Seed The base number to salt the hash with.
+    /// @return Returns the finished hash.
+    inline XXHashResult_128 FinishMid_128(const XXHashResult_128 Acc, const UInt64 Length, const UInt64 Seed) noexcept
+    {
+        XXHashResult_128 Result;
+        Result.Hash[0] = Avalanche(Acc.Hash[0] + Acc.Hash[1]);
+        Result.Hash[1] = UInt64(0) - Avalanche( ( Acc.Hash[0] * Prime64_1 ) + ( Acc.Hash[1] * Prime64_4 ) +
+                                                ( ( Length - Seed ) * Prime64_2 ) );
+        return Result;
+    }
+
+    XXHashResult_128 HashShort_128(const UInt8* Input, const SizeType Length, const UInt64 Seed) noexcept
+    {
+        const UInt8* Secret = DefaultSecret;
+        const UInt64 Length64 = static_cast<UInt64>(Length);
+        if( Length > 128 ) {
+            XXHashResult_128 Acc;
+            Acc.Hash[0] = Length64 * Prime64_1;
+            for( SizeType Offset = 32 ; Offset < 160 ; Offset += 32 )
+                { Acc = Mix32(Acc,Input + Offset - 32,Input + Offset - 16,Secret + Offset - 32,Seed); }
+            Acc.Hash[0] = Avalanche(Acc.Hash[0]);
+            Acc.Hash[1] = Avalanche(Acc.Hash[1]);
+            for( SizeType Offset = 160 ; Offset <= Length ; Offset += 32 )
+            {
+                Acc = Mix32(Acc,Input + Offset - 32,Input + Offset - 16,
+                            Secret + MidSizeStartOffset + Offset - 160,Seed);
+            }
+            Acc = Mix32(Acc,Input + Length - 16,Input + Length - 32,
+                        Secret + SecretSizeMin - MidSizeLastOffset - 16,UInt64(0) - Seed);
+            return FinishMid_128(Acc,Length64,Seed);
+        }else if( Length > 16 ) {
+            XXHashResult_128 Acc;
+            Acc.Hash[0] = Length64 * Prime64_1;
+            if( Length > 32 ) {
+                if( Length > 64 ) {
+                    if( Length > 96 ) {
+                        Acc = Mix32(Acc,Input + 48,Input + Length - 64,Secret + 96,Seed);
+                    }
+                    Acc = Mix32(Acc,Input + 32,Input + Length - 48,Secret + 64,Seed);
+                }
+                Acc = Mix32(Acc,Input + 16,Input + Length - 32,Secret + 32,Seed);
+            }
+            Acc = Mix32(Acc,Input,Input + Length - 16,Secret,Seed);
+            return FinishMid_128(Acc,Length64,Seed);
+        }else if( Length > 8 ) {
+            const UInt64 BitFlipLow = ( Read64(Secret + 32) ^ Read64(Secret + 40) ) - Seed;
+            const UInt64 BitFlipHigh = ( Read64(Secret + 48) ^ Read64(Secret + 56) ) + Seed;
+            const UInt64 InputLow = Read64(Input);
+            const UInt64 InputHigh = Read64(Input + Length - 8) ^ BitFlipHigh;
+            XXHashResult_128 Mixed = Multiply128(InputLow ^ Read64(Input + Length - 8) ^ BitFlipLow,Prime64_1);
+            Mixed.Hash[0] += ( Length64 - 1 ) << 54;
+            Mixed.Hash[1] += InputHigh + ( ( InputHigh & 0xFFFFFFFF ) * ( Prime32_2 - 1 ) );
+            Mixed.Hash[0] ^= Swap64(Mixed.Hash[1]);
+            XXHashResult_128 Result = Multiply128(Mixed.Hash[0],Prime64_2);
+            Result.Hash[1] += Mixed.Hash[1] * Prime64_2;
+            Result.Hash[0] = Avalanche(Result.Hash[0]);
+            Result.Hash[1] = Avalanche(Result.Hash[1]);
+            return Result;
+        }else if( Length >= 4 ) {
+            const UInt64 SwappedSeed = Seed ^ ( static_cast<UInt64>( Swap32( static_cast<UInt32>(Seed) ) ) << 32 );
+            const UInt32 InputFirst = Read32(Input);
+            const UInt32 InputLast = Read32(Input + Length - 4);
+            const UInt64 Input64 = InputFirst + ( static_cast<UInt64>(InputLast) << 32 );
+            const UInt64 BitFlip = ( Read64(Secret + 16) ^ Read64(Secret + 24) ) + SwappedSeed;
+            XXHashResult_128 Result = Multiply128(Input64 ^ BitFlip,Prime64_1 + ( Length64 << 2 ));
+            Result.Hash[1] += ( Result.Hash[0] << 1 );
+            Result.Hash[0] ^= ( Result.Hash[1] >> 3 );
+            Result.Hash[0] = XorShift64(Result.Hash[0],35);
+            Result.Hash[0] *= PrimeMX2;
+            Result.Hash[0] = XorShift64(Result.Hash[0],28);
+            Result.Hash[1] = Avalanche(Result.Hash[1]);
+            return Result;
+        }else if( Length > 0 ) {
+            const UInt32 CombinedLow = ( static_cast<UInt32>( Input[0] ) << 16 ) |
+                                       ( static_cast<UInt32>( Input[Length >> 1] ) << 24 ) |
+                                       ( static_cast<UInt32>( Input[Length - 1] ) << 0 ) |
+                                       ( static_cast<UInt32>(Length) << 8 );
+            const UInt32 CombinedHigh = Rotl32(Swap32(CombinedLow),13);
+            const UInt64 BitFlipLow = ( Read32(Secret) ^ Read32(Secret + 4) ) + Seed;
+            const UInt64 BitFlipHigh = ( Read32(Secret + 8) ^ Read32(Secret + 12) ) - Seed;
+            XXHashResult_128 Result;
+            Result.Hash[0] = Avalanche64( static_cast<UInt64>(CombinedLow) ^ BitFlipLow );
+            Result.Hash[1] = Avalanche64( static_cast<UInt64>(CombinedHigh) ^ BitFlipHigh );
+            return Result;
+        }
+        XXHashResult_128 Result;
+        Result.Hash[0] = Avalanche64( Seed ^ ( Read64(Secret + 64) ^ Read64(Secret + 72) ) );
+        Result.Hash[1] = Avalanche64( Seed ^ ( Read64(Secret + 80) ^ Read64(Secret + 88) ) );
+        return Result;
+    }
+
+    //-----------------------------------------------------------------------------
+    // Long inputs - the input is consumed 64 byte stripes at a time into eight
+    // accumulators, which are scrambled after every 16 stripes
+
+    /// @brief Sets the accumulators to their starting values.
+    /// @param Accs The eight accumulators to initialize.
+    inline void InitAccumulators(UInt64* Accs) noexcept
+    {
+        const UInt64 Initial[AccumulatorCount] = { Prime32_3, Prime64_1, Prime64_2, Prime64_3,
+                                                   Prime64_4, Prime32_2, Prime64_5, Prime32_1 };
+        std::copy(std::begin(Initial),std::end(Initial),Accs);
+    }
+
+    /// @brief Derives the secret used for long inputs from the seed.
+    /// @param Secret The SecretSize byte array to write the secret to.
+    /// @param Seed The base number to salt the hash with.
+    void InitSecret(UInt8* Secret, const UInt64 Seed) noexcept
+    {
+        for( SizeType Offset = 0 ; Offset < SecretSize ; Offset += 16 )
+        {
+            Write64(Secret + Offset,Read64(DefaultSecret + Offset) + Seed);
+            Write64(Secret + Offset + 8,Read64(DefaultSecret + Offset + 8) - Seed);
+        }
+    }
+
+    /// @brief Accumulates stripes into the accumulators using portable code.
+    /// @param Accs The eight accumulators to update.
+    /// @param Input A pointer to the first stripe.
+    /// @param Secret A pointer to the secret for the first stripe, each later stripe starts 8 bytes further in.
+    /// @param StripeCount The number of stripes to accumulate.
+    void AccumulateScalar(UInt64* Accs, const UInt8* Input, const UInt8* Secret, const SizeType StripeCount) noexcept
+    {
+        for( SizeType Stripe = 0 ; Stripe < StripeCount ; ++Stripe )
+        {
+            const UInt8* StripeInput = Input + ( Stripe * StripeLength );
+            const UInt8* StripeSecret = Secret + ( Stripe * SecretConsumeRate );
+            for( SizeType Lane = 0 ; Lane < AccumulatorCount ; ++Lane )
+            {
+                const UInt64 Data = Read64(StripeInput + ( Lane * 8 ));
+                const UInt64 Keyed = Data ^ Read64(StripeSecret + ( Lane * 8 ));
+                Accs[Lane ^ 1] += Data;
+                Accs[Lane] += ( Keyed & 0xFFFFFFFF ) * ( Keyed >> 32 );
+            }
+        }
+    }
+
+    /// @brief Scrambles the accumulators using portable code.
+    /// @param Accs The eight accumulators to scramble.
+    /// @param Secret A pointer to the 64 secret bytes to scramble with.
+    void ScrambleScalar(UInt64* Accs, const UInt8* Secret) noexcept
+    {
+        for( SizeType Lane = 0 ; Lane < AccumulatorCount ; ++Lane )
+        {
+            UInt64 Acc = XorShift64(Accs[Lane],47);
+            Acc ^= Read64(Secret + ( Lane * 8 ));
+            Accs[Lane] = Acc * Prime32_1;
+        }
+    }
+
+#ifdef MEZZ_XXHASH_X86_SIMD
+    /// @brief Accumulates stripes into the accumulators using AVX2.
+    /// @param Accs The eight accumulators to update, aligned to 32 bytes.
+    /// @param Input A pointer to the first stripe.
+    /// @param Secret A pointer to the secret for the first stripe, each later stripe starts 8 bytes further in.
+    /// @param StripeCount The number of stripes to accumulate.
+    __attribute__((target("avx2")))
+    void AccumulateAVX2(UInt64* Accs, const UInt8* Input, const UInt8* Secret, const SizeType StripeCount) noexcept
+    {
+        __m256i* VecAccs = reinterpret_cast<__m256i*>(Accs);
+        __m256i AccLow = _mm256_load_si256(VecAccs);
+        __m256i AccHigh = _mm256_load_si256(VecAccs + 1);
+        for( SizeType Stripe = 0 ; Stripe < StripeCount ; ++Stripe )
+        {
+            const __m256i* VecInput = reinterpret_cast<const __m256i*>( Input + ( Stripe * StripeLength ) );
+            const __m256i* VecSecret = reinterpret_cast<const __m256i*>( Secret + ( Stripe * SecretConsumeRate ) );
+            __m256i* Targets[2] = { &AccLow, &AccHigh };
+            for( SizeType Half = 0 ; Half < 2 ; ++Half )
+            {
+                const __m256i Data = _mm256_loadu_si256(VecInput + Half);
+                const __m256i Keyed = _mm256_xor_si256( Data,_mm256_loadu_si256(VecSecret + Half) );
+                const __m256i Product = _mm256_mul_epu32( Keyed,_mm256_srli_epi64(Keyed,32) );
+                const __m256i Swapped = _mm256_shuffle_epi32( Data,_MM_SHUFFLE(1,0,3,2) );
+                *Targets[Half] = _mm256_add_epi64( Product,_mm256_add_epi64(*Targets[Half],Swapped) );
+            }
+        }
+        _mm256_store_si256(VecAccs,AccLow);
+        _mm256_store_si256(VecAccs + 1,AccHigh);
+    }
+
+    /// @brief Scrambles the accumulators using AVX2.
+    /// @param Accs The eight accumulators to scramble, aligned to 32 bytes.
+    /// @param Secret A pointer to the 64 secret bytes to scramble with.
+    __attribute__((target("avx2")))
+    void ScrambleAVX2(UInt64* Accs, const UInt8* Secret) noexcept
+    {
+        __m256i* VecAccs = reinterpret_cast<__m256i*>(Accs);
+        const __m256i* VecSecret = reinterpret_cast<const __m256i*>(Secret);
+        const __m256i Prime = _mm256_set1_epi32( static_cast<int>(Prime32_1) );
+        for( SizeType Half = 0 ; Half < 2 ; ++Half )
+        {
+            const __m256i Acc = _mm256_load_si256(VecAccs + Half);
+            const __m256i Mixed = _mm256_xor_si256( Acc,_mm256_srli_epi64(Acc,47) );
+            const __m256i Keyed = _mm256_xor_si256( Mixed,_mm256_loadu_si256(VecSecret + Half) );
+            const __m256i ProductLow = _mm256_mul_epu32(Keyed,Prime);
+            const __m256i ProductHigh = _mm256_mul_epu32( _mm256_srli_epi64(Keyed,32),Prime );
+            _mm256_store_si256( VecAccs + Half,_mm256_add_epi64( ProductLow,_mm256_slli_epi64(ProductHigh,32) ) );
+        }
+    }
+#endif // MEZZ_XXHASH_X86_SIMD
+
+    /// @brief The functions used to consume long inputs on this processor.
+    struct LongKernels
+    {
+        /// @brief The function that accumulates stripes.
+        void (*Accumulate)(UInt64*, const UInt8*, const UInt8*, const SizeType) noexcept;
+        /// @brief The function that scrambles the accumulators.
+        void (*Scramble)(UInt64*, const UInt8*) noexcept;
+    };//LongKernels
+
+    /// @brief Gets the fastest long input functions this processor supports.
+    /// @return Returns a reference to the kernels, which are picked on the first call.
+    const LongKernels& GetKernels() noexcept
+    {
+    #ifdef MEZZ_XXHASH_X86_SIMD
+        static const LongKernels Kernels = __builtin_cpu_supports("avx2") ?
+            LongKernels{ &AccumulateAVX2, &ScrambleAVX2 } : LongKernels{ &AccumulateScalar, &ScrambleScalar };
+    #else
+        static const LongKernels Kernels{ &AccumulateScalar, &ScrambleScalar };
+    #endif
+        return Kernels;
+    }
+
+    /// @brief Accumulates stripes, scrambling the accumulators each time a block is completed.
+    /// @param Kernels The functions to consume the input with.
+    /// @param Accs The eight accumulators to update.
+    /// @param Input A pointer to the first stripe.
+    /// @param StripeCount The number of stripes to accumulate.
+    /// @param Secret The secret to mix the input with.
+    /// @param SoFar The number of stripes consumed since the last scramble, updated in place.
+    /// @return Returns a pointer to the byte after the last stripe consumed.
+    const UInt8* ConsumeStripes(const LongKernels& Kernels, UInt64* Accs, const UInt8* Input, SizeType StripeCount,
+                                const UInt8* Secret, SizeType& SoFar) noexcept
+    {
+        while( StripeCount >= StripesPerBlock - SoFar )
+        {
+            const SizeType ThisBlock = StripesPerBlock - SoFar;
+            Kernels.Accumulate(Accs,Input,Secret + ( SoFar * SecretConsumeRate ),ThisBlock);
+            Kernels.Scramble(Accs,Secret + SecretLimit);
+            Input += ThisBlock * StripeLength;
+            StripeCount -= ThisBlock;
+            SoFar = 0;
+        }
+        if( StripeCount > 0 ) {
+            Kernels.Accumulate(Accs,Input,Secret + ( SoFar * SecretConsumeRate ),StripeCount);
+            Input += StripeCount * StripeLength;
+            SoFar += StripeCount;
+        }
+        return Input;
+    }
+
+    /// @brief Merges the accumulators into a 64-bit value.
+    /// @param Accs The eight accumulators to merge.
+    /// @param Secret A pointer to the 64 secret bytes to merge with.
+    /// @param Start The value to start merging from.
+    /// @return Returns the merged hash.
+    UInt64 MergeAccumulators(const UInt64* Accs, const UInt8* Secret, const UInt64 Start) noexcept
+    {
+        UInt64 Result = Start;
+        for( SizeType Pair = 0 ; Pair < 4 ; ++Pair )
+        {
+            Result += MultiplyFold64( Accs[2 * Pair] ^ Read64(Secret + ( 16 * Pair )),
+                                      Accs[( 2 * Pair ) + 1] ^ Read64(Secret + ( 16 * Pair ) + 8) );
+        }
+        return Avalanche(Result);
+    }
+
+    /// @brief Consumes all of an input larger than 240 bytes.
+    /// @param Accs The eight accumulators to write the finished state to, aligned to 32 bytes.
+    /// @param Input A pointer to the data being hashed.
+    /// @param Length The byte length of the Input.
+    /// @param Secret The secret to mix the input with.
+    void HashLong(UInt64* Accs, const UInt8* Input, const SizeType Length, const UInt8* Secret) noexcept
+    {
+        const LongKernels& Kernels = GetKernels();
+        InitAccumulators(Accs);
+        const SizeType BlockCount = ( Length - 1 ) / BlockLength;
+        for( SizeType Block = 0 ; Block < BlockCount ; ++Block )
+        {
+            Kernels.Accumulate(Accs,Input + ( Block * BlockLength ),Secret,StripesPerBlock);
+            Kernels.Scramble(Accs,Secret + SecretLimit);
+        }
+        const SizeType StripeCount = ( ( Length - 1 ) - ( BlockLength * BlockCount ) ) / StripeLength;
+        Kernels.Accumulate(Accs,Input + ( BlockCount * BlockLength ),Secret,StripeCount);
+        Kernels.Accumulate(Accs,Input + Length - StripeLength,Secret + SecretLimit - SecretLastAccStart,1);
+    }
+
+    /// @brief Finishes the 64-bit hash of a long input.
+    /// @param Accs The accumulators after consuming the whole input.
+    /// @param Length The byte length of the input.
+    /// @param Secret The secret the input was mixed with.
+    /// @return Returns the finished hash.
+    inline UInt64 FinishLong_64(const UInt64* Accs, const UInt64 Length, const UInt8* Secret) noexcept
+        { return MergeAccumulators(Accs,Secret + SecretMergeAccsStart,Length * Prime64_1); }
+
+    /// @brief Finishes the 128-bit hash of a long input.
+    /// @param Accs The accumulators after consuming the whole input.
+    /// @param Length The byte length of the input.
+    /// @param Secret The secret the input was mixed with.
+    /// @return Returns the finished hash.
+    inline XXHashResult_128 FinishLong_128(const UInt64* Accs, const UInt64 Length, const UInt8* Secret) noexcept
+    {
+        XXHashResult_128 Result;
+        Result.Hash[0] = MergeAccumulators(Accs,Secret + SecretMergeAccsStart,Length * Prime64_1);
+        Result.Hash[1] = MergeAccumulators(Accs,Secret + SecretSize - StripeLength - SecretMergeAccsStart,
+                                           ~( Length * Prime64_2 ));
+        return Result;
+    }
+}
+
+namespace Mezzanine {
+namespace Hashing {
+    UInt64 XXHash3_64(const void* Key, const SizeType Length, const UInt64 Seed) noexcept
+    {
+        const UInt8* Input = static_cast<const UInt8*>(Key);
+        if( Length <= MidSizeMax ) {
+            return HashShort_64(Input,Length,Seed);
+        }
+        alignas(64) UInt64 Accs[AccumulatorCount];
+        if( Seed == 0 ) {
+            HashLong(Accs,Input,Length,DefaultSecret);
+            return FinishLong_64(Accs,Length,DefaultSecret);
+        }
+        alignas(64) UInt8 Secret[SecretSize];
+        InitSecret(Secret,Seed);
+        HashLong(Accs,Input,Length,Secret);
+        return FinishLong_64(Accs,Length,Secret);
+    }
+
+    XXHashResult_128 XXHash3_128(const void* Key, const SizeType Length, const UInt64 Seed) noexcept
+    {
+        const UInt8* Input = static_cast<const UInt8*>(Key);
+        if( Length <= MidSizeMax ) {
+            return HashShort_128(Input,Length,Seed);
+        }
+        alignas(64) UInt64 Accs[AccumulatorCount];
+        if( Seed == 0 ) {
+            HashLong(Accs,Input,Length,DefaultSecret);
+            return FinishLong_128(Accs,Length,DefaultSecret);
+        }
+        alignas(64) UInt8 Secret[SecretSize];
+        InitSecret(Secret,Seed);
+        HashLong(Accs,Input,Length,Secret);
+        return FinishLong_128(Accs,Length,Secret);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    // XXHash3Stream Methods
+
+    XXHash3Stream::XXHash3Stream(const UInt64 NewSeed) noexcept
+        { this->Reset(NewSeed); }
+
+    const UInt8* XXHash3Stream::ConsumeStripes(UInt64* Accs, const UInt8* Stripes, SizeType StripeCount,
+                                               SizeType& SoFar) const noexcept
+        { return ::ConsumeStripes(GetKernels(),Accs,Stripes,StripeCount,this->Secret,SoFar); }
+
+    void XXHash3Stream::DigestLong(UInt64* Accs) const noexcept
+    {
+        std::copy(std::begin(this->Accumulators),std::end(this->Accumulators),Accs);
+        UInt8 LastStripe[StripeLength];
+        const UInt8* LastStripePtr = LastStripe;
+        if( this->BufferedLength >= StripeLength ) {
+            SizeType SoFar = this->StripesSoFar;
+            this->ConsumeStripes(Accs,this->Buffer,( this->BufferedLength - 1 ) / StripeLength,SoFar);
+            LastStripePtr = this->Buffer + this->BufferedLength - StripeLength;
+        }else{
+            // The rest of the last stripe is still at the end of the buffer from the last time it was consumed.
+            const SizeType CatchUp = StripeLength - this->BufferedLength;
+            std::memcpy(LastStripe,this->Buffer + BufferSize - CatchUp,CatchUp);
+            std::memcpy(LastStripe + CatchUp,this->Buffer,this->BufferedLength);
+        }
+        GetKernels().Accumulate(Accs,LastStripePtr,this->Secret + SecretLimit - SecretLastAccStart,1);
+    }
+
+    void XXHash3Stream::Reset(const UInt64 NewSeed) noexcept
+    {
+        InitAccumulators(this->Accumulators);
+        InitSecret(this->Secret,NewSeed);
+        this->Seed = NewSeed;
+        this->TotalLength = 0;
+        this->BufferedLength = 0;
+        this->StripesSoFar = 0;
+    }
+
+    void XXHash3Stream::Update(const void* Data, const SizeType Length) noexcept
+    {
+        if( Length == 0 ) {
+            return;
+        }
+        const UInt8* Input = static_cast<const UInt8*>(Data);
+        const UInt8* const End = Input + Length;
+        this->TotalLength += Length;
+
+        // Keep at least one byte buffered, so the last stripe is always handled when finalizing.
+        if( Length <= BufferSize - this->BufferedLength ) {
+            std::memcpy(this->Buffer + this->BufferedLength,Input,Length);
+            this->BufferedLength += Length;
+            return;
+        }
+        if( this->BufferedLength > 0 ) {
+            const SizeType ToCopy = BufferSize - this->BufferedLength;
+            std::memcpy(this->Buffer + this->BufferedLength,Input,ToCopy);
+            Input += ToCopy;
+            this->ConsumeStripes(this->Accumulators,this->Buffer,BufferSize / StripeLength,this->StripesSoFar);
+            this->BufferedLength = 0;
+        }
+        if( static_cast<SizeType>( End - Input ) > BufferSize ) {
+            const SizeType StripeCount = static_cast<SizeType>( End - 1 - Input ) / StripeLength;
+            Input = this->ConsumeStripes(this->Accumulators,Input,StripeCount,this->StripesSoFar);
+            std::memcpy(this->Buffer + BufferSize - StripeLength,Input - StripeLength,StripeLength);
+        }
+        this->BufferedLength = static_cast<SizeType>( End - Input );
+        std::memcpy(this->Buffer,Input,this->BufferedLength);
+    }
+
+    UInt64 XXHash3Stream::Finalize64() const noexcept
+    {
+        if( this->TotalLength <= MidSizeMax ) {
+            return HashShort_64(this->Buffer,this->TotalLength,this->Seed);
+        }
+        alignas(64) UInt64 Accs[AccumulatorCount];
+        this->DigestLong(Accs);
+        return FinishLong_64(Accs,this->TotalLength,this->Secret);
+    }
+
+    XXHashResult_128 XXHash3Stream::Finalize128() const noexcept
+    {
+        if( this->TotalLength <= MidSizeMax ) {
+            return HashShort_128(this->Buffer,this->TotalLength,this->Seed);
+        }
+        alignas(64) UInt64 Accs[AccumulatorCount];
+        this->DigestLong(Accs);
+        return FinishLong_128(Accs,this->TotalLength,this->Secret);
+    }
+
+    SizeType XXHash3Stream::GetLength() const noexcept
+        { return this->TotalLength; }
+}//Hashing
+}//Mezzanine
@@ -0,0 +1,229 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_AtomicCountedPtrTests_h
+#define Mezz_Foundation_AtomicCountedPtrTests_h
+
+/// @file
+/// @brief This file tests the functionality of the AtomicCountedPtr class and the atomic reference count.
+
+#include "MezzTest.h"
+#include "RuntimeStatics.h"
+
+#include "AtomicCountedPtr.h"
+
+#include <thread>
+#include <vector>
+
+namespace Mezzanine
+{
+    namespace AtomicCountedPtrTesting
+    {
+        SAVE_WARNING_STATE
+        SUPPRESS_CLANG_WARNING("-Wpadded")
+
+        /// @brief A class to point at from many threads that tracks how many of it exist.
+        class SharedConfig
+        {
+        public:
+            /// @brief The value expected in Check while the object is alive.
+            static constexpr Integer AliveMarker = 0x5AFE;
+
+            /// @brief The number of instances of this that currently exist.
+            static std::atomic<Integer>& LiveCount()
+            {
+                static std::atomic<Integer> Count(0);
+                return Count;
+            }
+
+            /// @brief A value to use for testing purposes.
+            Integer Version;
+            /// @brief Set to AliveMarker on construction and cleared on destruction.
+            Integer Check;
+
+            /// @brief Constructor.
+            /// @param Ver The version of the config this represents.
+            explicit SharedConfig(Integer Ver)
+                : Version(Ver), Check(AliveMarker)
+                { ++LiveCount(); }
+
+            /// @brief Destructor, marks this as dead.
+            ~SharedConfig()
+            {
+                Check = 0;
+                --LiveCount();
+            }
+        };//SharedConfig
+
+        /// @brief A class that uses atomic reference counters allocated from a pool.
+        class PooledConfig : public SharedConfig
+        {
+        public:
+            using SharedConfig::SharedConfig;
+        };//PooledConfig
+
+        RESTORE_WARNING_STATE
+    }//AtomicCountedPtrTesting
+
+    template<>
+    class ReferenceCountTraits<AtomicCountedPtrTesting::SharedConfig>
+        : public AtomicReferenceCountTraits<AtomicCountedPtrTesting::SharedConfig>
+        {};
+
+    template<>
+    class ReferenceCountTraits<AtomicCountedPtrTesting::PooledConfig>
+    {
+    public:
+        using RefCountType = PooledReferenceCount< AtomicReferenceCount<AtomicCountedPtrTesting::PooledConfig> >;
+
+        static RefCountType* ConstructionPointer(AtomicCountedPtrTesting::PooledConfig* Target)
+            { return new RefCountType(Target); }
+
+        enum { IsCastable = CastStatic };
+    };
+}//Mezzanine
+
+AUTOMATIC_TEST_GROUP(AtomicCountedPtrTests,AtomicCountedPtr)
+{
+    using namespace Mezzanine;
+    using namespace Mezzanine::AtomicCountedPtrTesting;
+
+    { // AtomicReferenceCount
+        CountedPtr<SharedConfig> First( new SharedConfig(1) );
+        CountedPtr<SharedConfig> Copy( First );
+        WeakCountedPtr<SharedConfig> Weak( First );
+
+        TEST_EQUAL("AtomicReferenceCount-UseCount", Whole(2), First.UseCount())
+        TEST_EQUAL("AtomicReferenceCount-WeakCount", Whole(1), First.GetReferenceCount()->GetWeakReferenceCount())
+        TEST_EQUAL("AtomicReferenceCount-Lock", 1, Weak.Lock()->Version)
+
+        First.Reset();
+        Copy.Reset();
+        TEST_EQUAL("AtomicReferenceCount-Destroyed", 0, SharedConfig::LiveCount().load())
+        TEST_EQUAL("AtomicReferenceCount-WeakExpired", true, Weak.Expired())
+    }
+
+    { // Single threaded semantics
+        AtomicCountedPtr<SharedConfig> Empty;
+        TEST_EQUAL("AtomicCountedPtr()-Load", false, Empty.Load())
+        TEST_EQUAL("IsLockFree()", true, Empty.IsLockFree())
+
+        CountedPtr<SharedConfig> Initial( new SharedConfig(1) );
+        AtomicCountedPtr<SharedConfig> Cell( Initial );
+        TEST_EQUAL("AtomicCountedPtr(CountedPtr)-UseCount", Whole(2), Initial.UseCount())
+
+        CountedPtr<SharedConfig> Loaded = Cell.Load();
+        TEST_EQUAL("Load()-SameGroup", true, Loaded == Initial)
+        TEST_EQUAL("Load()-UseCount", Whole(3), Initial.UseCount())
+
+        CountedPtr<SharedConfig> Previous = Cell.Exchange( CountedPtr<SharedConfig>( new SharedConfig(2) ) );
+        TEST_EQUAL("Exchange(CountedPtr)-Previous", true, Previous == Initial)
+        TEST_EQUAL("Exchange(CountedPtr)-Current", 2, Cell.Load()->Version)
+        TEST_EQUAL("Exchange(CountedPtr)-PreviousUseCount", Whole(3), Initial.UseCount())
+
+        Cell.Store( CountedPtr<SharedConfig>( new SharedConfig(3) ) );
+        TEST_EQUAL("Store(CountedPtr)-Current", 3, Cell.Load()->Version)
+        TEST_EQUAL("Store(CountedPtr)-ReleasesPrevious", 2, SharedConfig::LiveCount().load())
+
+        CountedPtr<SharedConfig> Expected = Initial;
+        Boole Swapped = Cell.CompareExchange( Expected, CountedPtr<SharedConfig>( new SharedConfig(4) ) );
+        TEST_EQUAL("CompareExchange(CountedPtr&,CountedPtr)-FailResult", false, Swapped)
+        TEST_EQUAL("CompareExchange(CountedPtr&,CountedPtr)-FailExpected", 3, Expected->Version)
+        TEST_EQUAL("CompareExchange(CountedPtr&,CountedPtr)-FailUnchanged", 3, Cell.Load()->Version)
+
+        Swapped = Cell.CompareExchange( Expected, CountedPtr<SharedConfig>( new SharedConfig(5) ) );
+        TEST_EQUAL("CompareExchange(CountedPtr&,CountedPtr)-SucceedResult", true, Swapped)
+        TEST_EQUAL("CompareExchange(CountedPtr&,CountedPtr)-SucceedCurrent", 5, Cell.Load()->Version)
+        TEST_EQUAL("CompareExchange(CountedPtr&,CountedPtr)-SucceedExpected", Whole(1), Expected.UseCount())
+
+        Cell.Store( CountedPtr<SharedConfig>() );
+        TEST_EQUAL("Store(CountedPtr)-Empty", false, Cell.Load())
+    }
+    TEST_EQUAL("AtomicCountedPtr-NoLeaks", 0, SharedConfig::LiveCount().load())
+
+    // Emscripten builds are run without thread support.
+    if(Mezzanine::RuntimeStatic::CompilerIsEmscripten())
+        { return; }
+
+    { // Publishing to many threads
+        const Whole ReaderCount = 4;
+        const Integer VersionCount = 20000;
+        std::atomic<Whole> BadReads(0);
+        std::atomic<Boole> Done(false);
+
+        AtomicCountedPtr<PooledConfig> Cell( CountedPtr<PooledConfig>( new PooledConfig(0) ) );
+
+        std::vector<std::thread> Readers;
+        for( Whole Count = 0 ; Count < ReaderCount ; ++Count )
+        {
+            Readers.emplace_back([&](){
+                Integer LastVersion = 0;
+                while( !Done.load() )
+                {
+                    CountedPtr<PooledConfig> Current = Cell.Load();
+                    if( Current->Check != SharedConfig::AliveMarker || Current->Version < LastVersion ) {
+                        ++BadReads;
+                    }
+                    LastVersion = Current->Version;
+                }
+            });
+        }
+
+        for( Integer Version = 1 ; Version <= VersionCount ; ++Version )
+        {
+            if( Version % 2 ) {
+                Cell.Store( CountedPtr<PooledConfig>( new PooledConfig(Version) ) );
+            }else{
+                CountedPtr<PooledConfig> Expected = Cell.Load();
+                while( !Cell.CompareExchange( Expected, CountedPtr<PooledConfig>( new PooledConfig(Version) ) ) )
+                    {}
+            }
+        }
+        Done.store(true);
+        for( std::thread& Reader : Readers )
+            { Reader.join(); }
+
+        TEST_EQUAL("Load()-ThreadedNoBadReads", Whole(0), BadReads.load())
+        TEST_EQUAL("Load()-ThreadedFinalVersion", VersionCount, Cell.Load()->Version)
+        TEST_EQUAL("Load()-ThreadedOnlyCurrentAlive", 1, SharedConfig::LiveCount().load())
+    }
+    TEST_EQUAL("AtomicCountedPtr-ThreadedNoLeaks", 0, SharedConfig::LiveCount().load())
+}
+
+#endif
@@ -0,0 +1,371 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_BinarySerializationTests_h
+#define Mezz_Foundation_BinarySerializationTests_h
+
+/// @file
+/// @brief This file tests the functionality of the binary archive serialization.
+
+#include "MezzTest.h"
+
+#include "MezzException.h"
+#include "BinarySerialization.h"
+
+#include <map>
+#include <vector>
+
+namespace BinarySerializationTest
+{
+    using Mezzanine::UInt8;
+    using Mezzanine::UInt16;
+    using Mezzanine::Int32;
+    using Mezzanine::UInt32;
+    using Mezzanine::UInt64;
+    using Mezzanine::String;
+    using Mezzanine::StringView;
+
+    enum class Colour : UInt8
+    {
+        Red = 1,
+        Green = 2,
+        Blue = 3
+    };
+
+    struct Point
+    {
+        Int32 X = 0;
+        Int32 Y = 0;
+
+        static auto RegisterMembers()
+        {
+            using namespace Mezzanine;
+            using SelfType = Point;
+
+            return Members(
+                MakeMemberAccessor("X",&SelfType::X),
+                MakeMemberAccessor("Y",&SelfType::Y)
+            );
+        }
+    };
+
+    struct Shape
+    {
+        String Name;
+        std::vector<Point> Outline;
+        std::map<String,UInt32> Counters;
+        std::vector<float> Weights;
+        double Scale = 1.0;
+        float Rotation = 0.0f;
+        UInt16 Flags = 0;
+        Colour Fill = Colour::Red;
+        bool Visible = false;
+        UInt32 CachedArea = 0;
+        UInt32 LocalHandle = 0;
+
+        void SetScale(const double NewScale)
+            { this->Scale = NewScale; }
+        double GetScale() const
+            { return this->Scale; }
+
+        static StringView RegisterName()
+            { return "Shape"; }
+
+        static auto RegisterMembers()
+        {
+            using namespace Mezzanine;
+            using SelfType = Shape;
+
+            return Members(
+                MakeMemberAccessor("Name",&SelfType::Name),
+                MakeMemberAccessor("Outline",&SelfType::Outline),
+                MakeMemberAccessor("Counters",&SelfType::Counters),
+                MakeMemberAccessor("Weights",&SelfType::Weights),
+                MakeMemberAccessor("Scale",&SelfType::SetScale,&SelfType::GetScale),
+                MakeMemberAccessor("Rotation",&SelfType::Rotation),
+                MakeMemberAccessor("Flags",&SelfType::Flags),
+                MakeMemberAccessor("Fill",&SelfType::Fill),
+                MakeMemberAccessor("Visible",&SelfType::Visible),
+                MakeMemberAccessor<MemberTags::Generated>("CachedArea",&SelfType::CachedArea),
+                MakeMemberAccessor<MemberTags::Local>("LocalHandle",&SelfType::LocalHandle)
+            );
+        }
+    };
+
+    struct TreeNode
+    {
+        Int32 Value = 0;
+        std::vector<TreeNode> Children;
+
+        static auto RegisterMembers()
+        {
+            using namespace Mezzanine;
+            using SelfType = TreeNode;
+
+            return Members(
+                MakeMemberAccessor("Value",&SelfType::Value),
+                MakeMemberAccessor("Children",&SelfType::Children)
+            );
+        }
+    };
+
+    struct ShapeV2
+    {
+        UInt16 Flags = 0;
+        String Name;
+        float Scale = 1.0f;
+        Int32 Layer = -1;
+        std::vector<float> Weights;
+
+        static StringView RegisterName()
+            { return "Shape"; }
+
+        static auto RegisterMembers()
+        {
+            using namespace Mezzanine;
+            using SelfType = ShapeV2;
+
+            return Members(
+                MakeMemberAccessor("Flags",&SelfType::Flags),
+                MakeMemberAccessor("Name",&SelfType::Name),
+                MakeMemberAccessor("Scale",&SelfType::Scale),
+                MakeMemberAccessor("Layer",&SelfType::Layer),
+                MakeMemberAccessor("Weights",&SelfType::Weights)
+            );
+        }
+    };
+}
+
+AUTOMATIC_TEST_GROUP(BinarySerializationTests,BinarySerialization)
+{
+    using namespace Mezzanine;
+    using namespace BinarySerializationTest;
+
+    {// Writer and Reader
+        BinaryArchiveWriter Writer(1);
+        Writer.WriteRaw<UInt32>(0x01020304);
+        Writer.WriteVarUInt(127);
+        Writer.WriteVarUInt(300);
+        Writer.WriteString("Hi");
+        Writer.WriteRaw(-2.5);
+
+        TEST_EQUAL("BinaryArchiveWriter::GetSize()",
+                   SizeType(4 + 1 + 2 + 3 + 8),Writer.GetSize())
+
+        BinaryBuffer Written = Writer.Finish();
+        TEST_EQUAL("BinaryArchiveWriter::Finish()-Size",
+                   SizeType(18),Written.Size)
+        TEST_EQUAL("BinaryArchiveWriter::Finish()-Reset",
+                   SizeType(0),Writer.GetSize())
+        TEST_EQUAL("BinaryArchiveWriter::WriteRaw(const_ValueType)-LittleEndian-First",
+                   UInt8(0x04),Written[0])
+        TEST_EQUAL("BinaryArchiveWriter::WriteRaw(const_ValueType)-LittleEndian-Last",
+                   UInt8(0x01),Written[3])
+        TEST_EQUAL("BinaryArchiveWriter::WriteVarUInt(UInt64)-SingleByte",
+                   UInt8(127),Written[4])
+        TEST_EQUAL("BinaryArchiveWriter::WriteVarUInt(UInt64)-TwoBytes-First",
+                   UInt8(0xAC),Written[5])
+        TEST_EQUAL("BinaryArchiveWriter::WriteVarUInt(UInt64)-TwoBytes-Second",
+                   UInt8(0x02),Written[6])
+
+        BinaryArchiveReader Reader(Written);
+        TEST_EQUAL("BinaryArchiveReader::ReadRaw()-UInt32",
+                   UInt32(0x01020304),Reader.ReadRaw<UInt32>())
+        TEST_EQUAL("BinaryArchiveReader::ReadVarUInt()-SingleByte",
+                   UInt64(127),Reader.ReadVarUInt())
+        TEST_EQUAL("BinaryArchiveReader::ReadVarUInt()-TwoBytes",
+                   UInt64(300),Reader.ReadVarUInt())
+        TEST_EQUAL("BinaryArchiveReader::ReadString()",
+                   String("Hi"),Reader.ReadString())
+        TEST_EQUAL("BinaryArchiveReader::ReadRaw()-Double",
+                   -2.5,Reader.ReadRaw<double>())
+        TEST_EQUAL("BinaryArchiveReader::IsAtEnd()",
+                   true,Reader.IsAtEnd())
+        TEST_THROW("BinaryArchiveReader::ReadRaw()-Throw",
+                   Mezzanine::Exception::OutOfRange,
+                   [&Reader](){ Reader.ReadRaw<UInt8>(); })
+
+        const UInt8 BadVarUInt[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+        BinaryArchiveReader BadReader(BadVarUInt,sizeof(BadVarUInt));
+        TEST_THROW("BinaryArchiveReader::ReadVarUInt()-Throw-TooLong",
+                   Mezzanine::Exception::OutOfRange,
+                   [&BadReader](){ BadReader.ReadVarUInt(); })
+    }// Writer and Reader
+
+    {// Serialize and Deserialize
+        Shape Original;
+        Original.Name = "Triangle";
+        Original.Outline = { {0,0}, {10,0}, {-5,7} };
+        Original.Counters = { {"Edges",3}, {"Vertices",3} };
+        Original.Weights = { 0.25f, 0.5f, 0.25f };
+        Original.Scale = 2.25;
+        Original.Rotation = 90.0f;
+        Original.Flags = 0xBEEF;
+        Original.Fill = Colour::Blue;
+        Original.Visible = true;
+        Original.CachedArea = 35;
+        Original.LocalHandle = 77;
+
+        BinaryBuffer Archive = SerializeBinary(Original);
+        const SizeType ExpectedSize = ( 1 + 8 ) +                   // Name
+                                      ( 1 + 3 * 8 ) +               // Outline
+                                      ( 1 + ( 1 + 5 + 4 ) + ( 1 + 8 + 4 ) ) + // Counters
+                                      ( 1 + 3 * 4 ) +               // Weights
+                                      8 + 4 + 2 + 1 + 1;            // Scale, Rotation, Flags, Fill, Visible
+        TEST_EQUAL("SerializeBinary(const_Class&)-Size",
+                   ExpectedSize,Archive.Size)
+
+        Shape Copy;
+        Copy.CachedArea = 1;
+        Copy.LocalHandle = 2;
+        Copy.Outline = { {99,99} };
+        DeserializeBinary(Archive,Copy);
+        TEST_EQUAL("DeserializeBinary(const_BinaryBuffer&,Class&)-Name",
+                   Original.Name,Copy.Name)
+        TEST_EQUAL("DeserializeBinary(const_BinaryBuffer&,Class&)-Outline-Size",
+                   Original.Outline.size(),Copy.Outline.size())
+        TEST_EQUAL("DeserializeBinary(const_BinaryBuffer&,Class&)-Outline-X",
+                   Int32(-5),Copy.Outline[2].X)
+        TEST_EQUAL("DeserializeBinary(const_BinaryBuffer&,Class&)-Outline-Y",
+                   Int32(7),Copy.Outline[2].Y)
+        TEST_EQUAL("DeserializeBinary(const_BinaryBuffer&,Class&)-Counters",
+                   true,Original.Counters == Copy.Counters)
+        TEST_EQUAL("DeserializeBinary(const_BinaryBuffer&,Class&)-Weights",
+                   true,Original.Weights == Copy.Weights)
+        TEST_EQUAL("DeserializeBinary(const_BinaryBuffer&,Class&)-Scale",
+                   Original.Scale,Copy.Scale)
+        TEST_EQUAL("DeserializeBinary(const_BinaryBuffer&,Class&)-Rotation",
+                   Original.Rotation,Copy.Rotation)
+        TEST_EQUAL("DeserializeBinary(const_BinaryBuffer&,Class&)-Flags",
+                   Original.Flags,Copy.Flags)
+        TEST_EQUAL("DeserializeBinary(const_BinaryBuffer&,Class&)-Fill",
+                   true,Original.Fill == Copy.Fill)
+        TEST_EQUAL("DeserializeBinary(const_BinaryBuffer&,Class&)-Visible",
+                   Original.Visible,Copy.Visible)
+        TEST_EQUAL("DeserializeBinary(const_BinaryBuffer&,Class&)-Generated-Skipped",
+                   UInt32(1),Copy.CachedArea)
+        TEST_EQUAL("DeserializeBinary(const_BinaryBuffer&,Class&)-Local-Skipped",
+                   UInt32(2),Copy.LocalHandle)
+
+        BinaryArchiveWriter Writer;
+        SerializeBinary(Writer,Original.Outline[1]);
+        SerializeBinary(Writer,Original.Outline[2]);
+        BinaryBuffer PointArchive = Writer.Finish();
+        BinaryArchiveReader Reader(PointArchive);
+        Point First;
+        Point Second;
+        DeserializeBinary(Reader,First);
+        DeserializeBinary(Reader,Second);
+        TEST_EQUAL("DeserializeBinary(BinaryArchiveReader&,Class&)-First",
+                   Int32(10),First.X)
+        TEST_EQUAL("DeserializeBinary(BinaryArchiveReader&,Class&)-Second",
+                   Int32(-5),Second.X)
+        TEST_EQUAL("DeserializeBinary(BinaryArchiveReader&,Class&)-AtEnd",
+                   true,Reader.IsAtEnd())
+
+        BinaryBuffer Truncated(Archive.Binary,Archive.Size - 1);
+        Archive.Binary = nullptr;
+        Shape TruncatedCopy;
+        TEST_THROW("DeserializeBinary(const_BinaryBuffer&,Class&)-Throw-Truncated",
+                   Mezzanine::Exception::OutOfRange,
+                   [&](){ DeserializeBinary(Truncated,TruncatedCopy); })
+    }// Serialize and Deserialize
+
+    {// Schema Fingerprints and Versioning
+        TEST_EQUAL("GetSchemaFingerprint()-Stable",
+                   GetSchemaFingerprint<Shape>(),GetSchemaFingerprint<Shape>())
+        TEST_EQUAL("GetSchemaFingerprint()-Changed",
+                   false,GetSchemaFingerprint<Shape>() == GetSchemaFingerprint<ShapeV2>())
+        TEST_EQUAL("GetSchemaFingerprint()-Nested",
+                   false,GetSchemaFingerprint<Point>() == GetSchemaFingerprint<Shape>())
+        // The schema is described little-endian, so this value is the same on every host.
+        TEST_EQUAL("GetSchemaFingerprint()-ByteOrder",
+                   UInt64(0x0ED9B5891B258BF1),GetSchemaFingerprint<Point>())
+        TEST_THROW("GetSchemaFingerprint()-Throw-ContainsItself",
+                   Mezzanine::Exception::Base,
+                   [](){ GetSchemaFingerprint<TreeNode>(); })
+        TEST_THROW("GetSchemaFingerprint()-Throw-ContainsItselfAgain",
+                   Mezzanine::Exception::Base,
+                   [](){ GetSchemaFingerprint<TreeNode>(); })
+
+        Shape Original;
+        Original.Name = "Square";
+        Original.Outline = { {0,0}, {4,0}, {4,4}, {0,4} };
+        Original.Weights = { 1.0f, 2.0f };
+        Original.Scale = 3.5;
+        Original.Flags = 0x0F0F;
+        Original.CachedArea = 16;
+
+        BinaryBuffer Archive = SerializeBinaryVersioned(Original);
+        Shape Copy;
+        TEST_EQUAL("DeserializeBinaryVersioned(const_BinaryBuffer&,Class&)-Match",
+                   true,DeserializeBinaryVersioned(Archive,Copy))
+        TEST_EQUAL("DeserializeBinaryVersioned(const_BinaryBuffer&,Class&)-Match-Name",
+                   Original.Name,Copy.Name)
+        TEST_EQUAL("DeserializeBinaryVersioned(const_BinaryBuffer&,Class&)-Match-Outline",
+                   Int32(4),Copy.Outline[2].Y)
+        TEST_EQUAL("DeserializeBinaryVersioned(const_BinaryBuffer&,Class&)-Match-Scale",
+                   Original.Scale,Copy.Scale)
+        TEST_EQUAL("DeserializeBinaryVersioned(const_BinaryBuffer&,Class&)-Match-Generated-Skipped",
+                   UInt32(0),Copy.CachedArea)
+
+        ShapeV2 Migrated;
+        TEST_EQUAL("DeserializeBinaryVersioned(const_BinaryBuffer&,Class&)-Migrate",
+                   false,DeserializeBinaryVersioned(Archive,Migrated))
+        TEST_EQUAL("DeserializeBinaryVersioned(const_BinaryBuffer&,Class&)-Migrate-Name",
+                   Original.Name,Migrated.Name)
+        TEST_EQUAL("DeserializeBinaryVersioned(const_BinaryBuffer&,Class&)-Migrate-Flags",
+                   Original.Flags,Migrated.Flags)
+        TEST_EQUAL("DeserializeBinaryVersioned(const_BinaryBuffer&,Class&)-Migrate-Weights",
+                   true,Original.Weights == Migrated.Weights)
+        TEST_EQUAL("DeserializeBinaryVersioned(const_BinaryBuffer&,Class&)-Migrate-ChangedType",
+                   1.0f,Migrated.Scale)
+        TEST_EQUAL("DeserializeBinaryVersioned(const_BinaryBuffer&,Class&)-Migrate-NewMember",
+                   Int32(-1),Migrated.Layer)
+
+        BinaryBuffer Truncated(Archive.Binary,Archive.Size - 1);
+        Archive.Binary = nullptr;
+        ShapeV2 TruncatedCopy;
+        TEST_THROW("DeserializeBinaryVersioned(const_BinaryBuffer&,Class&)-Throw-Truncated",
+                   Mezzanine::Exception::OutOfRange,
+                   [&](){ DeserializeBinaryVersioned(Truncated,TruncatedCopy); })
+    }// Schema Fingerprints and Versioning
+}
+
+#endif
@@ -135,6 +135,18 @@ BENCHMARK_TEST_GROUP(CountedPtrBenchmarks,CountedPtrBenchmarks)
                 << Mezzanine::Testing::PrettyDurationString(ExternalRefCreateResult.WallTotal)
                 << "\n";
 
+        /// Pooled External Reference Counter
+        auto PooledRefCreate = [&](){
+            CountedPtr<FooPooled> PtrP( new FooPooled(&destructFlag, 3) );
+            OutputE = PtrP->Value;
+        };
+        const MicroBenchmarkResults PooledRefCreateResult = MicroBenchmark(TestTime,std::move(PooledRefCreate));
+        TestLog << OutputE << " - Creating and Dereferencing a CountedPtr "
+                << PooledRefCreateResult.Iterations
+                << " times with pooled external counting took: "
+                << Mezzanine::Testing::PrettyDurationString(PooledRefCreateResult.WallTotal)
+                << "\n";
+
         /// shared_ptr
         auto StdPtrCreate = [&](){
             std::shared_ptr<FooExternal> PtrS( new FooExternal(&destructFlag, 4) );
@@ -202,6 +214,18 @@ BENCHMARK_TEST_GROUP(CountedPtrBenchmarks,CountedPtrBenchmarks)
                 << Mezzanine::Testing::PrettyDurationString(ExternalRefCopyResult.WallTotal)
                 << "\n";
 
+        /// Pooled External Reference Counter
+        auto PooledRefCopy = [&](){
+            CountedPtr<FooPooled> PtrP( new FooPooled(&destructFlag, 8) );
+            CountedPtr<FooPooled> PtrP2(PtrP);
+            OutputE = PtrP2->Value;
+        };
+        const MicroBenchmarkResults PooledRefCopyResult = MicroBenchmark(TestTime,std::move(PooledRefCopy));
+        TestLog << OutputE << " - Creating, Dereferencing, and Copying a CountedPtr "
+                << PooledRefCopyResult.Iterations
+                << " times with pooled external counting took: "
+                << Mezzanine::Testing::PrettyDurationString(PooledRefCopyResult.WallTotal)
+                << "\n";
 
         /// shared_ptr
         auto StdPtrCopy = [&](){
@@ -269,6 +293,12 @@ BENCHMARK_TEST_GROUP(CountedPtrBenchmarks,CountedPtrBenchmarks)
         Count ExternalToMakeSharedPercentageCreate =
             ExternalRefCreateResult.Iterations * Count{100} / MakeSharedCreateResult.Iterations;
 
+        // Pooled Count Comparisons
+        Count PooledToExternalPercentageCopy =
+            PooledRefCopyResult.Iterations * Count{100} / ExternalRefCopyResult.Iterations;
+        Count PooledToExternalPercentageCreate =
+            PooledRefCreateResult.Iterations * Count{100} / ExternalRefCreateResult.Iterations;
+
         RESTORE_WARNING_STATE
 
         TestLog << "The Internal Counted pointer gets about "
@@ -301,6 +331,12 @@ BENCHMARK_TEST_GROUP(CountedPtrBenchmarks,CountedPtrBenchmarks)
                 << ExternalToMakeSharedPercentageCopy << "% as many working iterations as make_shared pointers.\n"
                 << "The External Counted pointer gets about "
                 << ExternalToMakeSharedPercentageCreate << "% as many creation iterations as make_shared pointers.\n\n"
+
+                << "The Pooled External Counted pointer gets about "
+                << PooledToExternalPercentageCopy << "% as many working iterations as External Counted pointers.\n"
+                << "The Pooled External Counted pointer gets about "
+                << PooledToExternalPercentageCreate
+                << "% as many creation iterations as External Counted pointers.\n\n"
                 ;
 
         // Internal Percentage based comparisons
@@ -332,6 +368,12 @@ BENCHMARK_TEST_GROUP(CountedPtrBenchmarks,CountedPtrBenchmarks)
                    50 < ExternalToMakeSharedPercentageCreate )
         TEST_PERF( "InternalDoesntSuckAtWorlIterationsComparedToMakeSharedpointers",
                    50 < ExternalToMakeSharedPercentageCopy )
+
+        // Pooled Percentage based comparisons
+        TEST_PERF( "PooledDoesAboutAsManyOrMoreCreateIterationsThanExternalReferenceCount",
+                   95 < PooledToExternalPercentageCreate )
+        TEST_PERF( "PooledDoesAboutAsManyOrMoreWorkIterationsThanExternalReferenceCount",
+                   95 < PooledToExternalPercentageCopy )
     }
 }
 
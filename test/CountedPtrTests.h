@@ -79,6 +79,39 @@ namespace Mezzanine
             }
         };
 
+        /// @brief A class with sub-objects to point at.
+        class FooOwner
+        {
+        public:
+            /// @brief A pointer to a bool to indicate whether the object's destructor has been called.
+            Boole* IsDestructed;
+            /// @brief A sub-object to point at.
+            FooExternal Inner;
+            /// @brief A simple member to point at.
+            Integer Count;
+
+            /// @brief A constructor that allows setting the values.
+            /// @param DestructFlag Where to save destruction results.
+            /// @param InnerDestructFlag Where to save destruction results of the Inner member.
+            /// @param Val A default value to use for testing.
+            FooOwner(Boole* DestructFlag, Boole* InnerDestructFlag, Integer Val) noexcept
+                : IsDestructed(DestructFlag), Inner(InnerDestructFlag, Val), Count(Val * 2)
+                {}
+
+            /// @brief A destructor that sets the target of IsDestructed to true.
+            ~FooOwner()
+            {
+                *IsDestructed = true;
+            }
+        };
+
+        /// @brief A class to point at that uses pooled external reference counters.
+        class FooPooled : public FooExternal
+        {
+        public:
+            using FooExternal::FooExternal;
+        };
+
         /// @brief A class to point at that uses its own reference counting internal mechanism.
         class FooInternal
         {
@@ -241,6 +274,10 @@ namespace Mezzanine
 
     using namespace CountedPtrTesting;
 
+    template <>
+    class ReferenceCountTraits <FooPooled> : public PooledReferenceCountTraits<FooPooled>
+        {};
+
     template <>
     class ReferenceCountTraits <FooInternal>
     {
@@ -552,6 +589,157 @@ DEFAULT_TEST_GROUP(CountedPtrTests,CountedPtr)
         TEST_EQUAL("CountedPtrDynamicCast()-CarToVehicle", "Unknown Engine", VehiclePtrAfterDynamicCast->StartEngine())
         TEST_EQUAL("CountedPtrDynamicCast()-CastFail", false, CountedPtrDynamicCast<FooExternal>(CarPtr))
     }
+
+    { // Pooled reference counts
+        using PoolType = CountedPtr<FooPooled>::RefCountType::PoolType;
+        Boole destructFlagPooled = false;
+        Boole destructFlagPooled2 = false;
+
+        PoolType::Trim();
+        ReferenceCount<FooPooled>* FirstCounter = nullptr;
+        {
+            CountedPtr<FooPooled> PtrP( new FooPooled(&destructFlagPooled, 11) );
+            CountedPtr<FooPooled> PtrP2( PtrP );
+            FirstCounter = PtrP.GetReferenceCount();
+
+            TEST_EQUAL("PooledReferenceCount-UseCount", Whole(2), PtrP2.UseCount())
+            TEST_EQUAL("PooledReferenceCount-Value", 11, PtrP2->Value)
+            TEST_EQUAL("PooledReferenceCount-CacheEmpty", SizeType(0), PoolType::GetCachedCount())
+        }
+        TEST_EQUAL("PooledReferenceCount-Destruction", true, destructFlagPooled)
+        TEST_EQUAL("PooledReferenceCount-CounterCached", SizeType(1), PoolType::GetCachedCount())
+
+        CountedPtr<FooPooled> PtrReused( new FooPooled(&destructFlagPooled2, 12) );
+        TEST_EQUAL("PooledReferenceCount-CounterReused", true, FirstCounter == PtrReused.GetReferenceCount())
+        TEST_EQUAL("PooledReferenceCount-CacheConsumed", SizeType(0), PoolType::GetCachedCount())
+
+        WeakCountedPtr<FooPooled> WeakP( PtrReused );
+        PtrReused.Reset();
+        TEST_EQUAL("PooledReferenceCount-WeakKeepsCounter", SizeType(0), PoolType::GetCachedCount())
+        TEST_EQUAL("PooledReferenceCount-WeakDestruction", true, destructFlagPooled2)
+        WeakP.Reset();
+        TEST_EQUAL("PooledReferenceCount-WeakReleasesCounter", SizeType(1), PoolType::GetCachedCount())
+    }
+
+    { // Custom deleters
+        Boole destructFlagArena = false;
+        Boole deleterCalled = false;
+        alignas(FooExternal) UInt8 Arena[sizeof(FooExternal)];
+
+        {
+            FooExternal* InArena = new(Arena) FooExternal(&destructFlagArena, 13);
+            CountedPtr<FooExternal> PtrD( InArena, [&deleterCalled](FooExternal* Target){
+                Target->~FooExternal();
+                deleterCalled = true;
+            } );
+            CountedPtr<FooExternal> PtrD2( PtrD );
+            WeakCountedPtr<FooExternal> WeakD( PtrD );
+
+            TEST_EQUAL("CountedPtr(ElementType*,DeleterType)-Get", InArena, PtrD2.Get())
+            TEST_EQUAL("CountedPtr(ElementType*,DeleterType)-UseCount", Whole(2), PtrD.UseCount())
+            PtrD.Reset();
+            TEST_EQUAL("CountedPtr(ElementType*,DeleterType)-NotYetDeleted", false, deleterCalled)
+            PtrD2.Reset();
+            TEST_EQUAL("CountedPtr(ElementType*,DeleterType)-Deleted", true, deleterCalled)
+            TEST_EQUAL("CountedPtr(ElementType*,DeleterType)-Destructed", true, destructFlagArena)
+            TEST_EQUAL("CountedPtr(ElementType*,DeleterType)-WeakExpired", true, WeakD.Expired())
+        }
+
+        Boole destructFlagPooled = false;
+        Whole DeleteCount = 0;
+        {
+            CountedPtr<FooPooled> PtrPD( new FooPooled(&destructFlagPooled, 14), [&DeleteCount](FooPooled* Target){
+                ++DeleteCount;
+                delete Target;
+            } );
+            TEST_EQUAL("CountedPtr(ElementType*,DeleterType)-PooledValue", 14, PtrPD->Value)
+        }
+        TEST_EQUAL("CountedPtr(ElementType*,DeleterType)-PooledDeleteCount", Whole(1), DeleteCount)
+        TEST_EQUAL("CountedPtr(ElementType*,DeleterType)-PooledDestructed", true, destructFlagPooled)
+
+        CountedPtr<FooExternal> NullDeleted( nullptr, [&DeleteCount](FooExternal*){ ++DeleteCount; } );
+        TEST_EQUAL("CountedPtr(nullptr,DeleterType)-Empty", false, NullDeleted)
+        TEST_EQUAL("CountedPtr(nullptr,DeleterType)-NotCalled", Whole(1), DeleteCount)
+    }
+
+    { // Aliasing
+        Boole destructFlagOwner = false;
+        Boole destructFlagInner = false;
+
+        AliasedCountedPtr<FooExternal,FooOwner> InnerPtr;
+        TEST_EQUAL("AliasedCountedPtr()-Empty", false, InnerPtr)
+        TEST_EQUAL("AliasedCountedPtr()-UseCount", Whole(0), InnerPtr.UseCount())
+        {
+            CountedPtr<FooOwner> OwnerPtr( new FooOwner(&destructFlagOwner, &destructFlagInner, 21) );
+            InnerPtr = AliasedCountedPtr<FooExternal,FooOwner>( OwnerPtr, &OwnerPtr->Inner );
+            AliasedCountedPtr<Integer,FooOwner> CountPtr = MakeAliasedCountedPtr( OwnerPtr, &FooOwner::Count );
+
+            TEST_EQUAL("AliasedCountedPtr(CountedPtr&,ElementType*)-Get", &OwnerPtr->Inner, InnerPtr.Get())
+            TEST_EQUAL("AliasedCountedPtr(CountedPtr&,ElementType*)-Value", 21, InnerPtr->Value)
+            TEST_EQUAL("AliasedCountedPtr(CountedPtr&,ElementType*)-UseCount", Whole(3), OwnerPtr.UseCount())
+            TEST_EQUAL("AliasedCountedPtr-SharesOwner", true, InnerPtr.GetOwner() == OwnerPtr)
+            TEST_EQUAL("MakeAliasedCountedPtr(CountedPtr&,MemberType_OwnerType::*)", 42, *CountPtr)
+        }
+        TEST_EQUAL("AliasedCountedPtr-KeepsOwnerAlive", false, destructFlagOwner)
+        TEST_EQUAL("AliasedCountedPtr-KeepsSubObjectAlive", false, destructFlagInner)
+        TEST_EQUAL("AliasedCountedPtr-OnlyOwner", Whole(1), InnerPtr.UseCount())
+
+        AliasedCountedPtr<FooExternal,FooOwner> InnerCopy( InnerPtr );
+        TEST_EQUAL("AliasedCountedPtr(AliasedCountedPtr&)-Equal", true, InnerCopy == InnerPtr)
+        InnerPtr.Reset();
+        TEST_EQUAL("AliasedCountedPtr::Reset()-OtherStillAlive", false, destructFlagOwner)
+        InnerCopy.Reset();
+        TEST_EQUAL("AliasedCountedPtr::Reset()-OwnerDestroyed", true, destructFlagOwner)
+        TEST_EQUAL("AliasedCountedPtr::Reset()-SubObjectDestroyed", true, destructFlagInner)
+    }
+
+    { // Weak pointers
+        Boole destructFlagExternal = false;
+
+        WeakCountedPtr<FooExternal> EmptyWeak;
+        TEST_EQUAL("WeakCountedPtr()-Expired", true, EmptyWeak.Expired())
+        TEST_EQUAL("WeakCountedPtr()-Lock", false, EmptyWeak.Lock())
+
+        CountedPtr<FooExternal> PtrE( new FooExternal(&destructFlagExternal, 5) );
+        WeakCountedPtr<FooExternal> WeakE( PtrE );
+        WeakCountedPtr<FooExternal> WeakCopy( WeakE );
+
+        TEST_EQUAL("WeakCountedPtr(CountedPtr&)-UseCount", Whole(1), WeakE.UseCount())
+        TEST_EQUAL("WeakCountedPtr(CountedPtr&)-WeakCount", Whole(2), PtrE.GetReferenceCount()->GetWeakReferenceCount())
+        TEST_EQUAL("WeakCountedPtr(CountedPtr&)-Expired", false, WeakE.Expired())
+        TEST_EQUAL("WeakCountedPtr::operator==", true, WeakE == WeakCopy)
+
+        {
+            CountedPtr<FooExternal> Locked = WeakE.Lock();
+            TEST_EQUAL("WeakCountedPtr::Lock()-Valid", true, Locked)
+            TEST_EQUAL("WeakCountedPtr::Lock()-Value", 5, Locked->Value)
+            TEST_EQUAL("WeakCountedPtr::Lock()-SharesCount", Whole(2), PtrE.UseCount())
+            TEST_EQUAL("WeakCountedPtr::Lock()-SameGroup", true, Locked == PtrE)
+        }
+        TEST_EQUAL("WeakCountedPtr::Lock()-Released", Whole(1), PtrE.UseCount())
+
+        PtrE.Reset();
+        TEST_EQUAL("WeakCountedPtr-DoesNotOwn", true, destructFlagExternal)
+        TEST_EQUAL("WeakCountedPtr-ExpiredAfterReset", true, WeakE.Expired())
+        TEST_EQUAL("WeakCountedPtr-CopyExpiredAfterReset", true, WeakCopy.Expired())
+        TEST_EQUAL("WeakCountedPtr::Lock()-Expired", false, WeakE.Lock())
+
+        WeakCountedPtr<FooExternal> WeakMoved( std::move(WeakCopy) );
+        TEST_EQUAL("WeakCountedPtr(WeakCountedPtr&&)-NewPointer", true, WeakMoved == WeakE)
+        TEST_EQUAL("WeakCountedPtr(WeakCountedPtr&&)-OldPointer", true, WeakCopy == EmptyWeak)
+
+        CountedPtr<int> IntPtr( new int(7) );
+        WeakCountedPtr<int> WeakInt;
+        WeakInt = IntPtr;
+        TEST_EQUAL("WeakCountedPtr::operator=(CountedPtr&)", 7, *WeakInt.Lock())
+        TEST_EQUAL("WeakCountedPtr::Reset()-LiveBefore", false, WeakInt.Expired())
+        WeakInt.Reset();
+        TEST_EQUAL("WeakCountedPtr::Reset()-Expired", true, WeakInt.Expired())
+        TEST_EQUAL("WeakCountedPtr::Reset()-Lock", false, WeakInt.Lock())
+        TEST_EQUAL("WeakCountedPtr::Reset()-TargetUntouched", Whole(1), IntPtr.UseCount())
+        TEST_EQUAL("WeakCountedPtr::Reset()-WeakCountReleased", Whole(0),
+                   IntPtr.GetReferenceCount()->GetWeakReferenceCount())
+    }
 }
 
 #endif
@@ -0,0 +1,221 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_DeltaSerializationTests_h
+#define Mezz_Foundation_DeltaSerializationTests_h
+
+/// @file
+/// @brief This file tests the functionality of delta serialization.
+
+#include "MezzTest.h"
+
+#include "MezzException.h"
+#include "DeltaSerialization.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace DeltaSerializationTest
+{
+    using Mezzanine::UInt32;
+    using Mezzanine::String;
+
+    struct Waypoint
+    {
+        float X = 0.0f;
+        float Y = 0.0f;
+
+        static auto RegisterMembers()
+        {
+            using namespace Mezzanine;
+            using SelfType = Waypoint;
+
+            return Members(
+                MakeMemberAccessor("X",&SelfType::X),
+                MakeMemberAccessor("Y",&SelfType::Y)
+            );
+        }
+    };
+
+    struct Actor
+    {
+        UInt32 ID = 0;
+        float X = 0.0f;
+        float Y = 0.0f;
+        float Z = 0.0f;
+        String Name;
+        std::vector<Waypoint> Path;
+        UInt32 Health = 100;
+        UInt32 Armour = 0;
+        UInt32 LocalTicks = 0;
+
+        static auto RegisterMembers()
+        {
+            using namespace Mezzanine;
+            using SelfType = Actor;
+
+            return Members(
+                MakeMemberAccessor("ID",&SelfType::ID),
+                MakeMemberAccessor("X",&SelfType::X),
+                MakeMemberAccessor("Y",&SelfType::Y),
+                MakeMemberAccessor("Z",&SelfType::Z),
+                MakeMemberAccessor("Name",&SelfType::Name),
+                MakeMemberAccessor("Path",&SelfType::Path),
+                MakeMemberAccessor("Health",&SelfType::Health),
+                MakeMemberAccessor("Armour",&SelfType::Armour),
+                MakeMemberAccessor<MemberTags::Local>("LocalTicks",&SelfType::LocalTicks)
+            );
+        }
+    };
+}
+
+AUTOMATIC_TEST_GROUP(DeltaSerializationTests,DeltaSerialization)
+{
+    using namespace Mezzanine;
+    using namespace DeltaSerializationTest;
+
+    Actor Old;
+    Old.ID = 7;
+    Old.Name = "Grunt";
+    Old.Path = { {1.0f,2.0f}, {3.0f,4.0f} };
+
+    {// Unchanged
+        Actor Same = Old;
+        Same.LocalTicks = 99;
+        TEST_EQUAL("GetChangedMembers(const_Class&,const_Class&)-Unchanged",
+                   true,GetChangedMembers(Old,Same).none())
+
+        BinaryBuffer Delta = Diff(Old,Same);
+        TEST_EQUAL("Diff(const_Class&,const_Class&)-Unchanged-Size",
+                   SizeType(2),Delta.Size)
+    }// Unchanged
+
+    {// Changed
+        Actor New = Old;
+        New.Y = 5.5f;
+        New.Path[1].Y = 8.0f;
+        New.Armour = 25;
+        New.LocalTicks = 99;
+
+        DeltaMask<Actor> Changed = GetChangedMembers(Old,New);
+        TEST_EQUAL("GetChangedMembers(const_Class&,const_Class&)-Count",
+                   SizeType(3),Changed.count())
+        TEST_EQUAL("GetChangedMembers(const_Class&,const_Class&)-Y",
+                   true,Changed.test(2))
+        TEST_EQUAL("GetChangedMembers(const_Class&,const_Class&)-Path",
+                   true,Changed.test(5))
+        TEST_EQUAL("GetChangedMembers(const_Class&,const_Class&)-Armour",
+                   true,Changed.test(7))
+        TEST_EQUAL("GetChangedMembers(const_Class&,const_Class&)-Local",
+                   false,Changed.test(8))
+
+        BinaryBuffer Delta = Diff(Old,New);
+        TEST_EQUAL("Diff(const_Class&,const_Class&)-Size",
+                   SizeType(2 + 4 + ( 1 + 2 * 8 ) + 4),Delta.Size)
+
+        Actor Replica = Old;
+        Replica.Health = 50;
+        DeltaMask<Actor> Applied = ApplyDiff(Delta,Replica);
+        TEST_EQUAL("ApplyDiff(const_BinaryBuffer&,Class&)-Mask",
+                   true,Applied == Changed)
+        TEST_EQUAL("ApplyDiff(const_BinaryBuffer&,Class&)-Y",
+                   5.5f,Replica.Y)
+        TEST_EQUAL("ApplyDiff(const_BinaryBuffer&,Class&)-Path",
+                   8.0f,Replica.Path[1].Y)
+        TEST_EQUAL("ApplyDiff(const_BinaryBuffer&,Class&)-Armour",
+                   UInt32(25),Replica.Armour)
+        TEST_EQUAL("ApplyDiff(const_BinaryBuffer&,Class&)-Untouched",
+                   UInt32(50),Replica.Health)
+        TEST_EQUAL("ApplyDiff(const_BinaryBuffer&,Class&)-Local",
+                   UInt32(0),Replica.LocalTicks)
+
+        BinaryArchiveWriter Writer;
+        TEST_EQUAL("SerializeDelta(BinaryArchiveWriter&,const_Class&,const_Class&)-Changed",
+                   true,SerializeDelta(Writer,Old,New))
+        TEST_EQUAL("SerializeDelta(BinaryArchiveWriter&,const_Class&,const_Class&)-Unchanged",
+                   false,SerializeDelta(Writer,New,New))
+        BinaryBuffer Stream = Writer.Finish();
+        BinaryArchiveReader Reader(Stream);
+        Actor Streamed = Old;
+        ApplyDiff(Reader,Streamed);
+        TEST_EQUAL("ApplyDiff(BinaryArchiveReader&,Class&)-First",
+                   UInt32(25),Streamed.Armour)
+        TEST_EQUAL("ApplyDiff(BinaryArchiveReader&,Class&)-Second",
+                   true,ApplyDiff(Reader,Streamed).none())
+        TEST_EQUAL("ApplyDiff(BinaryArchiveReader&,Class&)-AtEnd",
+                   true,Reader.IsAtEnd())
+
+        Delta[1] = static_cast<UInt8>( Delta[1] | 0x01 );
+        TEST_THROW("ApplyDiff(const_BinaryBuffer&,Class&)-Throw-LocalMember",
+                   Mezzanine::Exception::Encoding,
+                   [&](){ ApplyDiff(Delta,Replica); })
+        BinaryBuffer Truncated(Delta.Binary,Delta.Size - 1);
+        Delta.Binary = nullptr;
+        Truncated[1] = 0;
+        TEST_THROW("ApplyDiff(const_BinaryBuffer&,Class&)-Throw-Truncated",
+                   Mezzanine::Exception::OutOfRange,
+                   [&](){ ApplyDiff(Truncated,Replica); })
+    }// Changed
+
+    {// Floating Point
+        Actor NotANumber = Old;
+        NotANumber.X = std::numeric_limits<float>::quiet_NaN();
+        Actor SameNotANumber = NotANumber;
+        TEST_EQUAL("GetChangedMembers(const_Class&,const_Class&)-SameNaN",
+                   true,GetChangedMembers(NotANumber,SameNotANumber).none())
+        TEST_EQUAL("GetChangedMembers(const_Class&,const_Class&)-ToNaN",
+                   true,GetChangedMembers(Old,NotANumber).test(1))
+
+        Actor NegativeZero = Old;
+        NegativeZero.Z = -0.0f;
+        DeltaMask<Actor> Changed = GetChangedMembers(Old,NegativeZero);
+        TEST_EQUAL("GetChangedMembers(const_Class&,const_Class&)-NegativeZero",
+                   true,Changed.test(3))
+        TEST_EQUAL("GetChangedMembers(const_Class&,const_Class&)-NegativeZero-Count",
+                   SizeType(1),Changed.count())
+
+        Actor Replica = Old;
+        ApplyDiff(Diff(Old,NegativeZero),Replica);
+        TEST_EQUAL("ApplyDiff(const_BinaryBuffer&,Class&)-NegativeZero",
+                   true,std::signbit(Replica.Z))
+    }// Floating Point
+}
+
+#endif
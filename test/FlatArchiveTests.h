@@ -0,0 +1,202 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_FlatArchiveTests_h
+#define Mezz_Foundation_FlatArchiveTests_h
+
+/// @file
+/// @brief This file tests the functionality of the flat archive format.
+
+#include "MezzTest.h"
+
+#include "MezzException.h"
+#include "FlatArchive.h"
+
+#include <vector>
+
+namespace FlatArchiveTest
+{
+    using Mezzanine::UInt8;
+    using Mezzanine::UInt16;
+    using Mezzanine::Int32;
+    using Mezzanine::UInt64;
+    using Mezzanine::StringView;
+
+    struct AssetRecord
+    {
+        UInt64 AssetID = 0;
+        double Scale = 1.0;
+        Int32 Offset = 0;
+        UInt16 Flags = 0;
+        UInt8 Kind = 0;
+        bool Loaded = false;
+
+        void SetOffset(const Int32 NewOffset)
+            { this->Offset = NewOffset; }
+        Int32 GetOffset() const
+            { return this->Offset; }
+
+        static StringView RegisterName()
+            { return "AssetRecord"; }
+
+        static auto RegisterMembers()
+        {
+            using namespace Mezzanine;
+            using SelfType = AssetRecord;
+
+            return Members(
+                MakeMemberAccessor("AssetID",&SelfType::AssetID),
+                MakeMemberAccessor("Scale",&SelfType::Scale),
+                MakeMemberAccessor("Offset",&SelfType::SetOffset,&SelfType::GetOffset),
+                MakeMemberAccessor("Flags",&SelfType::Flags),
+                MakeMemberAccessor("Kind",&SelfType::Kind),
+                MakeMemberAccessor("Loaded",&SelfType::Loaded)
+            );
+        }
+    };
+
+    struct RenamedAssetRecord
+    {
+        UInt64 AssetID = 0;
+        double Scale = 1.0;
+        Int32 Offset = 0;
+        UInt16 Flags = 0;
+        UInt8 Kind = 0;
+        bool Loaded = false;
+
+        static StringView RegisterName()
+            { return "AssetRecord"; }
+
+        static auto RegisterMembers()
+        {
+            using namespace Mezzanine;
+            using SelfType = RenamedAssetRecord;
+
+            return Members(
+                MakeMemberAccessor("AssetID",&SelfType::AssetID),
+                MakeMemberAccessor("Scale",&SelfType::Scale),
+                MakeMemberAccessor("Position",&SelfType::Offset),
+                MakeMemberAccessor("Flags",&SelfType::Flags),
+                MakeMemberAccessor("Kind",&SelfType::Kind),
+                MakeMemberAccessor("Loaded",&SelfType::Loaded)
+            );
+        }
+    };
+}
+
+AUTOMATIC_TEST_GROUP(FlatArchiveTests,FlatArchive)
+{
+    using namespace Mezzanine;
+    using namespace FlatArchiveTest;
+
+    {// Layout
+        using LayoutType = FlatLayout<AssetRecord>;
+        static_assert( LayoutType::MemberCount == 6, "Supposed to Pass." );
+        static_assert( LayoutType::RecordSize == 8 + 8 + 4 + 2 + 1 + 1, "Supposed to Pass." );
+        static_assert( LayoutType::Offsets[2] == 16, "Supposed to Pass." );
+        static_assert( std::is_same_v<LayoutType::MemberTypeAt<3>,UInt16>, "Supposed to Pass." );
+        static_assert( !FlatArchiveHelpers::IsFlatMember<String>(), "Supposed to Fail." );
+        static_assert( !FlatArchiveHelpers::IsFlatMember<int*>(), "Supposed to Fail." );
+
+        TEST_EQUAL("FlatLayout::GetSchemaHash()-Stable",
+                   LayoutType::GetSchemaHash(),LayoutType::GetSchemaHash())
+        TEST_EQUAL("FlatLayout::GetSchemaHash()-RenamedMember",
+                   false,LayoutType::GetSchemaHash() == FlatLayout<RenamedAssetRecord>::GetSchemaHash())
+    }// Layout
+
+    {// Write and View
+        std::vector<AssetRecord> Assets(100);
+        for( size_t Idx = 0 ; Idx < Assets.size() ; ++Idx )
+        {
+            Assets[Idx].AssetID = 0x100000000ull + Idx;
+            Assets[Idx].Scale = static_cast<double>(Idx) * 0.5;
+            Assets[Idx].Offset = -static_cast<Int32>(Idx);
+            Assets[Idx].Flags = static_cast<UInt16>(Idx * 3);
+            Assets[Idx].Kind = static_cast<UInt8>(Idx % 4);
+            Assets[Idx].Loaded = ( Idx % 2 == 0 );
+        }
+
+        BinaryBuffer Archive = SerializeFlatArchive(Assets);
+        TEST_EQUAL("SerializeFlatArchive(const_ContainerType&)-Size",
+                   sizeof(FlatArchiveHeader) + 100 * FlatLayout<AssetRecord>::RecordSize,Archive.Size)
+
+        FlatArchiveView<AssetRecord> View(Archive);
+        TEST_EQUAL("FlatArchiveView::size()_const",
+                   SizeType(100),View.size())
+        TEST_EQUAL("FlatArchiveView::GetHeader()_const-Version",
+                   FlatArchiveVersion,View.GetHeader().Version)
+        TEST_EQUAL("FlatRecordView::Get()_const-First",
+                   0x100000000ull + 42,View[42].Get<0>())
+        TEST_EQUAL("FlatRecordView::Get()_const-Second",
+                   21.0,View[42].Get<1>())
+        TEST_EQUAL("FlatRecordView::Get()_const-Third",
+                   Int32(-42),View[42].Get<2>())
+        TEST_EQUAL("FlatRecordView::GetMemberValue(const_StringView)_const",
+                   UInt16(297),View.at(99).GetMemberValue<UInt16>("Flags"))
+        TEST_EQUAL("FlatRecordView::GetMemberValue(const_StringView)_const-WrongType",
+                   Int32(0),View.at(99).GetMemberValue<Int32>("Flags"))
+
+        AssetRecord Loaded;
+        View[7].Load(Loaded);
+        TEST_EQUAL("FlatRecordView::Load(Class&)_const-AssetID",
+                   Assets[7].AssetID,Loaded.AssetID)
+        TEST_EQUAL("FlatRecordView::Load(Class&)_const-Offset",
+                   Assets[7].Offset,Loaded.Offset)
+        TEST_EQUAL("FlatRecordView::Load(Class&)_const-Kind",
+                   Assets[7].Kind,Loaded.Kind)
+        TEST_EQUAL("FlatRecordView::Load(Class&)_const-Loaded",
+                   Assets[7].Loaded,Loaded.Loaded)
+
+        TEST_THROW("FlatArchiveView::at(const_SizeType)_const-Throw",
+                   Mezzanine::Exception::OutOfRange,
+                   [&View](){ View.at(100); })
+        TEST_THROW("FlatArchiveView(const_void*,const_SizeType)-Throw-Truncated",
+                   Mezzanine::Exception::OutOfRange,
+                   [&Archive](){ FlatArchiveView<AssetRecord> Truncated(Archive.Binary,Archive.Size - 1); })
+        TEST_THROW("FlatArchiveView(const_void*,const_SizeType)-Throw-Schema",
+                   Mezzanine::Exception::Encoding,
+                   [&Archive](){ FlatArchiveView<RenamedAssetRecord> Renamed(Archive); })
+        Archive[0] = 0;
+        TEST_THROW("FlatArchiveView(const_void*,const_SizeType)-Throw-Magic",
+                   Mezzanine::Exception::Encoding,
+                   [&Archive](){ FlatArchiveView<AssetRecord> Corrupt(Archive); })
+    }// Write and View
+}
+
+#endif
@@ -0,0 +1,111 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_HashCollisionRegistryTests_h
+#define Mezz_Foundation_HashCollisionRegistryTests_h
+
+/// @file
+/// @brief This file tests the functionality of the hash collision registry.
+
+#include "MezzTest.h"
+
+#include "HashCollisionRegistry.h"
+#include "MezzException.h"
+
+AUTOMATIC_TEST_GROUP(HashCollisionRegistryTests,HashCollisionRegistry)
+{
+    using namespace Mezzanine;
+
+    {// Default Handler
+        HashCollisionRegistry Throwing;
+        Throwing.Register(7,"Alpha");
+        TEST_THROW("Register(const_UInt64,const_StringView)-DefaultThrows",
+                   Exception::Base,
+                   [&](){ Throwing.Register(7,"Beta"); })
+        TEST_EQUAL("Register(const_UInt64,const_StringView)-RecordedBeforeThrow",
+                   size_t(1),Throwing.GetCollisions().size())
+        TEST_EQUAL("Register(const_UInt64,const_StringView)-DefaultRepeat",
+                   true,Throwing.Register(7,"Alpha"))
+    }// Default Handler
+
+    HashCollisionRegistry Registry;
+    SizeType HandlerCalls = 0;
+    Registry.SetHandler([&HandlerCalls](const HashCollision&){ ++HandlerCalls; });
+
+    TEST_EQUAL("Register(const_UInt64,const_StringView)-New",
+               true,Registry.Register(42,"Alpha"))
+    TEST_EQUAL("Register(const_UInt64,const_StringView)-Repeat",
+               true,Registry.Register(42,"Alpha"))
+    TEST_EQUAL("Register(const_UInt64,const_StringView)-Other",
+               true,Registry.Register(43,"Beta"))
+    TEST_EQUAL("GetCount()_const",
+               SizeType(2),Registry.GetCount())
+    TEST_EQUAL("GetCollisions()_const-None",
+               true,Registry.GetCollisions().empty())
+
+    TEST_EQUAL("Register(const_UInt64,const_StringView)-Collision",
+               false,Registry.Register(42,"Gamma"))
+    TEST_EQUAL("SetHandler(HandlerType)-Called",
+               SizeType(1),HandlerCalls)
+    const std::vector<HashCollision> Collisions = Registry.GetCollisions();
+    TEST_EQUAL("GetCollisions()_const-Count",
+               size_t(1),Collisions.size())
+    TEST_EQUAL("GetCollisions()_const-Hash",
+               UInt64(42),Collisions.front().Hash)
+    TEST_EQUAL("GetCollisions()_const-Existing",
+               String("Alpha"),Collisions.front().Existing)
+    TEST_EQUAL("GetCollisions()_const-Incoming",
+               String("Gamma"),Collisions.front().Incoming)
+
+    Registry.SetHandler( HashCollisionRegistry::HandlerType() );
+    TEST_EQUAL("SetHandler(HandlerType)-Empty",
+               false,Registry.Register(43,"Delta"))
+    TEST_EQUAL("SetHandler(HandlerType)-EmptyNotCalled",
+               SizeType(1),HandlerCalls)
+
+    Registry.Clear();
+    TEST_EQUAL("Clear()-Count",
+               SizeType(0),Registry.GetCount())
+    TEST_EQUAL("Clear()-Collisions",
+               true,Registry.GetCollisions().empty())
+    TEST_EQUAL("Clear()-Forgotten",
+               true,Registry.Register(42,"Gamma"))
+}
+
+#endif
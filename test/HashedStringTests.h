@@ -0,0 +1,267 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_HashedStringTests_h
+#define Mezz_Foundation_HashedStringTests_h
+
+/// @file
+/// @brief This file tests the functionality of the hashed string identifiers.
+
+#include "MezzTest.h"
+
+#include "HashCollisionRegistry.h"
+#include "HashedString.h"
+#include "MezzException.h"
+
+#include <set>
+#include <sstream>
+
+AUTOMATIC_TEST_GROUP(HashedStringTests,HashedString)
+{
+    using namespace Mezzanine;
+    using namespace Mezzanine::Literals;
+
+    const String Empty("");
+    const String LineOne("Sing, O goddess, the anger of Achilles son of Peleus, that brought countless ills upon the "
+                         "Achaeans.");
+    const String LineTwo("And which of the gods was it that set them on to quarrel? It was the son of Jove and Leto;");
+    const String LineThree("\"Sons of Atreus,\" he cried, \"and all other Achaeans, may the gods who dwell in Olympus "
+                           "grant you to sack the city of Priam\"");
+
+    {// HashedString32
+        const HashedString32 HashedEmpty(Empty);
+        const HashedString32 HashedLineOne(LineOne);
+        const HashedString32 HashedLineTwo(LineTwo);
+        const HashedString32 HashedLineThree(LineThree.c_str());
+
+        TEST_EQUAL("HashedString32::EmptyHash",
+                   HashedString32::EmptyHash,HashedEmpty.GetHash())
+        TEST_EQUAL("HashedString32()-IsEmpty",
+                   true,HashedString32().IsEmpty())
+        TEST_EQUAL("HashedString32(const_String&)-IsEmpty",
+                   false,HashedLineOne.IsEmpty())
+        TEST_EQUAL("HashedString32::Murmur32bit(const_String&)",
+                   static_cast<HashedString32::HashType>( Hashing::MurmurHash3_x86_32(LineOne.data(),LineOne.size(),1) ),
+                   HashedString32::Murmur32bit(LineOne))
+        TEST_EQUAL("HashedString32::Murmur32bit(const_char*)",
+                   HashedString32::Murmur32bit(LineTwo),HashedString32::Murmur32bit(LineTwo.c_str()))
+        TEST_EQUAL("GetString()_const",
+                   LineOne,HashedLineOne.GetString())
+
+        TEST_EQUAL("operator==(const_HashedString32&)_const-Empty",
+                   true,HashedString32(Empty) == HashedEmpty)
+        TEST_EQUAL("operator==(const_HashedString32&)_const-Line",
+                   true,HashedString32(LineTwo) == HashedLineTwo)
+        TEST_EQUAL("operator!=(const_HashedString32&)_const",
+                   true,HashedString32(LineTwo) != HashedLineOne)
+        TEST_EQUAL("operator<(const_HashedString32&)_const",
+                   HashedLineThree.GetHash() < HashedLineTwo.GetHash(),HashedLineThree < HashedLineTwo)
+        TEST_EQUAL("operator>(const_HashedString32&)_const",
+                   HashedLineThree.GetHash() > HashedLineTwo.GetHash(),HashedLineThree > HashedLineTwo)
+
+        HashedString32 Changing(LineOne);
+        Changing.SetString(Empty);
+        TEST_EQUAL("SetString(const_String&)-Hash",
+                   HashedString32::EmptyHash,Changing.GetHash())
+        TEST_EQUAL("SetString(const_String&)-IsEmpty",
+                   true,Changing.IsEmpty())
+        Changing = LineThree;
+        TEST_EQUAL("operator=(const_String&)",
+                   HashedLineThree,Changing)
+        Changing = LineTwo.c_str();
+        TEST_EQUAL("operator=(const_char*)",
+                   HashedLineTwo,Changing)
+
+        TEST_EQUAL("operator+(const_HashedString32&,const_char*)",
+                   String("Name.xml"),HashedString32("Name") + ".xml")
+        TEST_EQUAL("operator+(const_char*,const_HashedString32&)",
+                   String("The Name"),"The " + HashedString32("Name"))
+        std::ostringstream Streamed;
+        Streamed << HashedLineOne;
+        TEST_EQUAL("operator<<(std::ostream&,const_HashedString32&)",
+                   LineOne,Streamed.str())
+
+        std::set<HashedString32> Sorted{ HashedLineOne, HashedLineTwo, HashedLineThree, HashedString32(LineOne) };
+        TEST_EQUAL("operator<(const_HashedString32&)_const-Set",
+                   SizeType(3),Sorted.size())
+    }// HashedString32
+
+    {// Interning
+        const HashedString32 First(LineOne);
+        // A separate copy of the text, so the pool is what makes them share storage.
+        const String Rebuilt = LineOne.substr(0,10) + LineOne.substr(10);
+        const HashedString32 Second(Rebuilt);
+        const HashedString32 Copied(First);
+        TEST_EQUAL("HashedString32(const_String&)-Interned",
+                   &(First.GetString()),&(Second.GetString()))
+        TEST_EQUAL("HashedString32(const_HashedString32&)-Interned",
+                   &(First.GetString()),&(Copied.GetString()))
+        TEST_EQUAL("HashedString32(const_String&)-Pooled",
+                   &(First.GetString()),
+                   &(StringInternPool::GetGlobal().Find(LineOne,static_cast<UInt32>(First.GetHash()))->Text))
+        TEST_EQUAL("HashedString32-Size",
+                   true,sizeof(HashedString32) <= sizeof(void*) * 2)
+
+        const SizeType CountBefore = StringInternPool::GetGlobal().GetCount();
+        const HashedString32 Again(LineOne);
+        TEST_EQUAL("HashedString32(const_String&)-NoNewEntry",
+                   CountBefore,StringInternPool::GetGlobal().GetCount())
+
+        // Different strings forced to share a hash must still compare by their text.
+        const HashedString32 Genuine("Hector");
+        const HashedString32 Impostor("Paris",Genuine.GetHash());
+        TEST_EQUAL("HashedString32(const_StringView,const_HashType)-Hash",
+                   Genuine.GetHash(),Impostor.GetHash())
+        TEST_EQUAL("operator==(const_HashedString32&)_const-Collision",
+                   false,Genuine == Impostor)
+        TEST_EQUAL("operator!=(const_HashedString32&)_const-Collision",
+                   true,Genuine != Impostor)
+        TEST_EQUAL("operator<(const_HashedString32&)_const-Collision",
+                   true,Genuine < Impostor)
+        TEST_EQUAL("operator>(const_HashedString32&)_const-Collision",
+                   true,Impostor > Genuine)
+        TEST_EQUAL("GetString()_const-Collision",
+                   String("Paris"),Impostor.GetString())
+    }// Interning
+
+    {// HashedString64
+        const HashedString64 HashedEmpty(Empty);
+        const HashedString64 HashedLineOne(LineOne);
+        const HashedString64 HashedLineTwo(LineTwo.c_str());
+
+        TEST_EQUAL("HashedString64::EmptyHash",
+                   HashedString64::EmptyHash,HashedEmpty.GetHash())
+        TEST_EQUAL("HashedString64()-IsEmpty",
+                   true,HashedString64().IsEmpty())
+        TEST_EQUAL("HashedString64::Murmur64bit(const_StringView)",
+                   Hashing::MurmurHash3_x64_128(LineOne.data(),LineOne.size(),1).Hash[0],
+                   HashedString64::Murmur64bit(LineOne))
+        TEST_EQUAL("GetString()_const",
+                   LineTwo,HashedLineTwo.GetString())
+        TEST_EQUAL("HashedString64(const_String&)-Interned",
+                   &(HashedLineOne.GetString()),&(HashedString64(LineOne).GetString()))
+
+        TEST_EQUAL("operator==(const_HashedString64&)_const",
+                   true,HashedString64(LineOne) == HashedLineOne)
+        TEST_EQUAL("operator!=(const_HashedString64&)_const",
+                   true,HashedLineTwo != HashedLineOne)
+        TEST_EQUAL("operator<(const_HashedString64&)_const",
+                   HashedLineOne.GetHash() < HashedLineTwo.GetHash(),HashedLineOne < HashedLineTwo)
+        TEST_EQUAL("operator>(const_HashedString64&)_const",
+                   HashedLineOne.GetHash() > HashedLineTwo.GetHash(),HashedLineOne > HashedLineTwo)
+        // Only the hash is compared, so a precomputed hash stands in for the string.
+        TEST_EQUAL("HashedString64(const_StringView,const_HashType)",
+                   HashedLineOne,HashedString64(LineOne,HashedLineOne.GetHash()))
+
+        HashedString64 Changing(LineOne);
+        Changing.SetString(Empty);
+        TEST_EQUAL("SetString(const_String&)",
+                   true,Changing.IsEmpty())
+        Changing = LineTwo;
+        TEST_EQUAL("operator=(const_String&)",
+                   HashedLineTwo,Changing)
+        Changing = LineOne.c_str();
+        TEST_EQUAL("operator=(const_char*)",
+                   HashedLineOne,Changing)
+
+        std::ostringstream Streamed;
+        Streamed << HashedLineTwo;
+        TEST_EQUAL("operator<<(std::ostream&,const_HashedString64&)",
+                   LineTwo,Streamed.str())
+
+#if HASHED_STRING_COLLISION_CHECKS
+        // A precomputed hash forces a different string onto the hash of an existing one.
+        HashCollisionRegistry& Registry = HashCollisionRegistry::GetGlobal();
+        const HashedString64 Hector("Hector");
+        const SizeType CollisionsBefore = Registry.GetCollisions().size();
+        TEST_THROW("HashedString64(const_StringView,const_HashType)-CollisionThrows",
+                   Exception::Base,
+                   [&](){ HashedString64 Priam("Priam",Hector.GetHash()); })
+
+        SizeType HandlerCalls = 0;
+        Registry.SetHandler([&HandlerCalls](const HashCollision&){ ++HandlerCalls; });
+        const HashedString64 Paris("Paris",Hector.GetHash());
+        Registry.SetHandler( &HashCollisionRegistry::ThrowOnCollision );
+        TEST_EQUAL("HashedString64(const_StringView,const_HashType)-CollisionHandled",
+                   SizeType(1),HandlerCalls)
+        TEST_EQUAL("HashedString64(const_StringView,const_HashType)-CollisionRecorded",
+                   CollisionsBefore + 2,Registry.GetCollisions().size())
+        TEST_EQUAL("HashedString64(const_StringView,const_HashType)-CollisionIncoming",
+                   String("Paris"),Registry.GetCollisions().back().Incoming)
+#endif
+    }// HashedString64
+
+    {// Literals
+        constexpr HashedString32::HashType CompileTime = "Achilles"_hash;
+        TEST_EQUAL("operator\"\"_hash(const_char*,const_size_t)",
+                   HashedString32::Murmur32bit("Achilles"),CompileTime)
+        TEST_EQUAL("operator\"\"_hash(const_char*,const_size_t)-Empty",
+                   HashedString32::EmptyHash,""_hash)
+        TEST_EQUAL("HashedString32::CompileTimeMurmur32bit(const_StringView)",
+                   HashedString32::Murmur32bit(LineOne),HashedString32::CompileTimeMurmur32bit(LineOne))
+
+        // Declaring the literal constexpr fails to compile unless the hash is computed at compile time.
+        constexpr HashedString32::Literal CompileTimeLiteral = "Achilles"_hs;
+        static_assert( CompileTimeLiteral.Hash == "Achilles"_hash, "operator\"\"_hs must hash at compile time." );
+        TEST_EQUAL("operator\"\"_hs(const_char*,const_size_t)-CompileTime",
+                   HashedString32::Murmur32bit("Achilles"),CompileTimeLiteral.Hash)
+
+        const HashedString32 FromLiteral = "Achilles"_hs;
+        TEST_EQUAL("operator\"\"_hs(const_char*,const_size_t)",
+                   HashedString32("Achilles"),FromLiteral)
+        TEST_EQUAL("operator\"\"_hs(const_char*,const_size_t)-String",
+                   String("Achilles"),FromLiteral.GetString())
+
+        // Literal hashes are constants, so they can be used as case labels.
+        auto Classify = [](const HashedString32& Name) {
+            switch( Name.GetHash() )
+            {
+                case "Achilles"_hash:  return 1;
+                case "Hector"_hash:    return 2;
+                default:               return 0;
+            }
+        };
+        TEST_EQUAL("operator\"\"_hash(const_char*,const_size_t)-CaseLabel",
+                   2,Classify(HashedString32("Hector")))
+        TEST_EQUAL("operator\"\"_hash(const_char*,const_size_t)-CaseDefault",
+                   0,Classify(HashedString32("Priam")))
+    }// Literals
+}
+
+#endif
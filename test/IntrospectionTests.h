@@ -202,6 +202,23 @@ namespace IntrospectTest
     std::ostream& operator<<(std::ostream& Stream, const SingleVarStruct& Var)
         { Stream << Var.UIntVar;  return Stream; }
 
+    struct DuplicateNameStruct
+    {
+        int IntVar = 1;
+        std::string StringVar = "Duplicate";
+
+        static auto RegisterMembers()
+        {
+            using namespace Mezzanine;
+            using SelfType = DuplicateNameStruct;
+
+            return Members(
+                MakeMemberAccessor("Var",&SelfType::IntVar),
+                MakeMemberAccessor("Var",&SelfType::StringVar)
+            );
+        }
+    };
+
     struct ContainerStruct
     {
         std::vector<BaseStruct> VectorVar;
@@ -463,6 +480,36 @@ AUTOMATIC_TEST_GROUP(IntrospectionTests,Introspection)
                     [&](){ NoSetOrGetAccessor.GetValue(TestStruct); } )
     }// MemberAccessor/BaseStruct Throw Tests
 
+    {// MemberAccessor/Const Objects
+        BaseStruct MutableBase;
+        MutableBase.IntVar = 12;
+        const BaseStruct& ConstBase = MutableBase;
+        const ContainerStruct ConstContainer;
+
+        auto IntAccessor = MakeMemberAccessor("IntVar",&BaseStruct::IntVar);
+        TEST_EQUAL("MemberAccessor::GetValue(const_ClassType&)_const-MemberPtr",
+                   12,IntAccessor.GetValue(ConstBase))
+        TEST_EQUAL("MemberAccessor::GetValue(const_ClassType&)_const-MemberPtr-NoCopy",
+                   &(MutableBase.IntVar),&(IntAccessor.GetValue(ConstBase)))
+
+        auto FloatAccessor = MakeMemberAccessor("FloatVar",&BaseStruct::SetFloatVar,&BaseStruct::GetFloatVar);
+        TEST_EQUAL_EPSILON("MemberAccessor::GetValue(const_ClassType&)_const-ConstGetter",
+                           ConstBase.GetFloatVar(),FloatAccessor.GetValue(ConstBase))
+
+        auto StringAccessor = MakeMemberAccessor("StringVar",&ContainerStruct::GetStringVar);
+        static_assert( std::is_same_v<decltype(StringAccessor.GetValue(ConstContainer)),const std::string&>,
+                       "Non-const reference getters should return a const reference from a const object." );
+        TEST_EQUAL("MemberAccessor::GetValue(const_ClassType&)_const-NonConstRefGetter",
+                   &(ConstContainer.StringVar),&(StringAccessor.GetValue(ConstContainer)))
+
+        using NoGetMethodType = decltype(&BaseStruct::FloatVar);
+        using NoGetType = MemberAccessor<NoGetMethodType,NoGetMethodType,MemberTags::None>;
+        NoGetType NoGetAccessor("InvalidFloatVar",&BaseStruct::FloatVar,nullptr);
+        TEST_THROW( "MemberAccessor::GetValue(const_ClassType&)_const-NoGet-Throw",
+                    Mezzanine::Exception::IntrospectionNullptr,
+                    [&](){ NoGetAccessor.GetValue(ConstBase); } )
+    }// MemberAccessor/Const Objects
+
     {// MakeMemberAccessor/BaseStruct
         constexpr MemberTags Combined = MemberTags::Local | MemberTags::Generated;
 
@@ -674,6 +721,43 @@ AUTOMATIC_TEST_GROUP(IntrospectionTests,Introspection)
         TEST_EQUAL("SetMemberValue-BaseStruct-String",
                    ThirdNewVal,ThirdTestStruct.StringVar)
     }// (Get/Set)MemberValue
+
+    {// Member Name Table
+        using DiamondTableType = IntrospectionHelpers::MemberNameTable<DiamondStruct>;
+        const DiamondTableType& DiamondTable = DiamondTableType::Get();
+        TEST_EQUAL("MemberNameTable-DiamondStruct-IsPerfect",
+                   true,DiamondTable.IsPerfect())
+
+        Boole AllFound = true;
+        size_t ExpectedIndex = 0;
+        DoForAllMembers<DiamondStruct>( [&](const auto& Member) {
+            AllFound = AllFound && ( DiamondTable.Find( Member.GetName() ) == ExpectedIndex++ );
+        } );
+        TEST_EQUAL("MemberNameTable-DiamondStruct-FindAll",
+                   true,AllFound)
+        TEST_EQUAL("MemberNameTable-DiamondStruct-FindMissing",
+                   DiamondTableType::MemberCount,DiamondTable.Find("DiamondStringVarTres"))
+        TEST_EQUAL("MemberNameTable-DiamondStruct-FindEmpty",
+                   DiamondTableType::MemberCount,DiamondTable.Find(""))
+
+        using DuplicateTableType = IntrospectionHelpers::MemberNameTable<DuplicateNameStruct>;
+        TEST_EQUAL("MemberNameTable-DuplicateNameStruct-IsPerfect",
+                   false,DuplicateTableType::Get().IsPerfect())
+        TEST_EQUAL("MemberNameTable-DuplicateNameStruct-Find",
+                   size_t(0),DuplicateTableType::Get().Find("Var"))
+        TEST_EQUAL("HasMember()-DuplicateNameStruct-Pass",
+                   true,HasMember<DuplicateNameStruct>("Var"))
+
+        DuplicateNameStruct DuplicateStruct;
+        TEST_EQUAL("GetMemberValue-DuplicateNameStruct-Int",
+                   int(1),GetMemberValue<int>(DuplicateStruct,"Var"))
+        TEST_EQUAL("GetMemberValue-DuplicateNameStruct-String",
+                   std::string("Duplicate"),GetMemberValue<std::string>(DuplicateStruct,"Var"))
+
+        using EmptyTableType = IntrospectionHelpers::MemberNameTable<std::vector<int>>;
+        TEST_EQUAL("MemberNameTable-vector-Find",
+                   size_t(0),EmptyTableType::Get().Find("Start"))
+    }// Member Name Table
 }
 
 #endif
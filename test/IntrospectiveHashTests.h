@@ -0,0 +1,191 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_IntrospectiveHashTests_h
+#define Mezz_Foundation_IntrospectiveHashTests_h
+
+/// @file
+/// @brief This file tests the functionality of the introspective hash and equality functors.
+
+#include "MezzTest.h"
+
+#include "IntrospectiveHash.h"
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace IntrospectiveHashTest
+{
+    using Mezzanine::Int32;
+    using Mezzanine::UInt32;
+    using Mezzanine::String;
+
+    struct GridCell
+    {
+        Int32 X = 0;
+        Int32 Y = 0;
+        Int32 Z = 0;
+        UInt32 Layer = 0;
+        UInt32 CachedKey = 0;
+
+        static auto RegisterMembers()
+        {
+            using namespace Mezzanine;
+            using SelfType = GridCell;
+
+            return Members(
+                MakeMemberAccessor("X",&SelfType::X),
+                MakeMemberAccessor("Y",&SelfType::Y),
+                MakeMemberAccessor("Z",&SelfType::Z),
+                MakeMemberAccessor("Layer",&SelfType::Layer),
+                MakeMemberAccessor<MemberTags::Generated>("CachedKey",&SelfType::CachedKey)
+            );
+        }
+    };
+
+    struct Marker
+    {
+        GridCell Cell;
+        float Weight = 0.0f;
+        String Label;
+        std::vector<UInt32> Tags;
+
+        static auto RegisterMembers()
+        {
+            using namespace Mezzanine;
+            using SelfType = Marker;
+
+            return Members(
+                MakeMemberAccessor("Cell",&SelfType::Cell),
+                MakeMemberAccessor("Weight",&SelfType::Weight),
+                MakeMemberAccessor("Label",&SelfType::Label),
+                MakeMemberAccessor("Tags",&SelfType::Tags)
+            );
+        }
+    };
+}
+
+AUTOMATIC_TEST_GROUP(IntrospectiveHashTests,IntrospectiveHash)
+{
+    using namespace Mezzanine;
+    using namespace IntrospectiveHashTest;
+
+    {// Plain Members
+        IntrospectiveHash<GridCell> Hasher;
+        IntrospectiveEqual<GridCell> Equal;
+
+        GridCell First{1,2,3,4,0};
+        GridCell Second{1,2,3,4,99};
+        GridCell Third{1,2,4,3,0};
+
+        TEST_EQUAL("IntrospectiveHash::operator()-EqualObjects",
+                   Hasher(First),Hasher(Second))
+        TEST_EQUAL("IntrospectiveEqual::operator()-IgnoresGenerated",
+                   true,Equal(First,Second))
+        TEST_EQUAL("IntrospectiveHash::operator()-DifferentObjects",
+                   false,Hasher(First) == Hasher(Third))
+        TEST_EQUAL("IntrospectiveEqual::operator()-DifferentObjects",
+                   false,Equal(First,Third))
+    }// Plain Members
+
+    {// Mixed Members
+        IntrospectiveHash<Marker> Hasher;
+        IntrospectiveEqual<Marker> Equal;
+
+        Marker First;
+        First.Cell = GridCell{5,6,7,8,0};
+        First.Weight = 0.0f;
+        First.Label = "Spawn";
+        First.Tags = { 1, 2, 3 };
+        Marker Second = First;
+        Second.Weight = -0.0f;
+        Second.Cell.CachedKey = 12;
+
+        TEST_EQUAL("IntrospectiveHash::operator()-SignedZero",
+                   Hasher(First),Hasher(Second))
+        TEST_EQUAL("IntrospectiveEqual::operator()-SignedZero",
+                   true,Equal(First,Second))
+
+        Second.Label = "Spawm";
+        TEST_EQUAL("IntrospectiveHash::operator()-String",
+                   false,Hasher(First) == Hasher(Second))
+        TEST_EQUAL("IntrospectiveEqual::operator()-String",
+                   false,Equal(First,Second))
+
+        Second.Label = First.Label;
+        Second.Tags.push_back(4);
+        TEST_EQUAL("IntrospectiveHash::operator()-Container",
+                   false,Hasher(First) == Hasher(Second))
+        TEST_EQUAL("IntrospectiveEqual::operator()-Container",
+                   false,Equal(First,Second))
+    }// Mixed Members
+
+    {// Unordered Containers
+        using CellSet = std::unordered_set<GridCell,IntrospectiveHash<GridCell>,IntrospectiveEqual<GridCell>>;
+        using MarkerMap = std::unordered_map<Marker,UInt32,IntrospectiveHash<Marker>,IntrospectiveEqual<Marker>>;
+
+        CellSet Cells;
+        for( Int32 X = 0 ; X < 16 ; ++X )
+        {
+            for( Int32 Y = 0 ; Y < 16 ; ++Y )
+                { Cells.insert( GridCell{X,Y,0,0,static_cast<UInt32>(X * Y)} ); }
+        }
+        Cells.insert( GridCell{3,4,0,0,0} );
+        TEST_EQUAL("unordered_set-Size",
+                   size_t(256),Cells.size())
+        TEST_EQUAL("unordered_set-Find",
+                   size_t(1),Cells.count( GridCell{15,15,0,0,7} ))
+        TEST_EQUAL("unordered_set-Missing",
+                   size_t(0),Cells.count( GridCell{15,15,1,0,0} ))
+
+        MarkerMap Markers;
+        Marker Key;
+        Key.Label = "Exit";
+        Markers[Key] = 3;
+        Key.Cell.CachedKey = 40;
+        Markers[Key] += 1;
+        TEST_EQUAL("unordered_map-Size",
+                   size_t(1),Markers.size())
+        TEST_EQUAL("unordered_map-Value",
+                   UInt32(4),Markers[Key])
+    }// Unordered Containers
+}
+
+#endif
@@ -0,0 +1,250 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_JSONSerializationTests_h
+#define Mezz_Foundation_JSONSerializationTests_h
+
+/// @file
+/// @brief This file tests the functionality of the JSON writer and reader.
+
+#include "MezzTest.h"
+
+#include "MezzException.h"
+#include "JSONSerialization.h"
+
+#include <map>
+#include <vector>
+
+namespace JSONSerializationTest
+{
+    using Mezzanine::UInt8;
+    using Mezzanine::Int32;
+    using Mezzanine::UInt32;
+    using Mezzanine::String;
+    using Mezzanine::StringView;
+
+    enum class Colour : UInt8
+    {
+        Red = 1,
+        Green = 2,
+        Blue = 3
+    };
+
+    struct Point
+    {
+        Int32 X = 0;
+        Int32 Y = 0;
+
+        static auto RegisterMembers()
+        {
+            using namespace Mezzanine;
+            using SelfType = Point;
+
+            return Members(
+                MakeMemberAccessor("X",&SelfType::X),
+                MakeMemberAccessor("Y",&SelfType::Y)
+            );
+        }
+    };
+
+    struct Shape
+    {
+        String Name;
+        std::vector<Point> Outline;
+        std::map<String,UInt32> Counters;
+        std::map<Int32,String> Labels;
+        double Scale = 1.0;
+        Colour Fill = Colour::Red;
+        bool Visible = false;
+        UInt32 CachedArea = 0;
+
+        static StringView RegisterName()
+            { return "Shape"; }
+
+        static auto RegisterMembers()
+        {
+            using namespace Mezzanine;
+            using SelfType = Shape;
+
+            return Members(
+                MakeMemberAccessor("Name",&SelfType::Name),
+                MakeMemberAccessor("Outline",&SelfType::Outline),
+                MakeMemberAccessor("Counters",&SelfType::Counters),
+                MakeMemberAccessor("Labels",&SelfType::Labels),
+                MakeMemberAccessor("Scale",&SelfType::Scale),
+                MakeMemberAccessor("Fill",&SelfType::Fill),
+                MakeMemberAccessor("Visible",&SelfType::Visible),
+                MakeMemberAccessor<MemberTags::Generated>("CachedArea",&SelfType::CachedArea)
+            );
+        }
+    };
+
+    /// @brief Reads JSON text into a Point, for the error tests.
+    inline void ReadPoint(const String& Text)
+    {
+        Point Dest;
+        Mezzanine::DeserializeJSON(Mezzanine::BinaryBuffer(Text),Dest);
+    }
+}
+
+AUTOMATIC_TEST_GROUP(JSONSerializationTests,JSONSerialization)
+{
+    using namespace Mezzanine;
+    using namespace JSONSerializationTest;
+
+    {// Writing
+        Shape Original;
+        Original.Name = "Tri\"angle\\\n\x01";
+        Original.Outline = { Point{0,0}, Point{4,-3} };
+        Original.Counters = { { "Edges", 3 }, { "Faces", 1 } };
+        Original.Labels = { { 2, "Two" } };
+        Original.Scale = 0.5;
+        Original.Fill = Colour::Blue;
+        Original.Visible = true;
+        Original.CachedArea = 6;
+
+        const String Expected = "{\"Name\":\"Tri\\\"angle\\\\\\n\\u0001\","
+                                "\"Outline\":[{\"X\":0,\"Y\":0},{\"X\":4,\"Y\":-3}],"
+                                "\"Counters\":{\"Edges\":3,\"Faces\":1},"
+                                "\"Labels\":[[2,\"Two\"]],"
+                                "\"Scale\":0.5,\"Fill\":3,\"Visible\":true}";
+        TEST_EQUAL("SerializeJSON(const_Class&)",
+                   Expected,SerializeJSON(Original).ToString())
+
+        BinaryArchiveWriter Writer;
+        Writer.WriteBytes("[",1);
+        SerializeJSON(Writer,Point{1,2});
+        TEST_EQUAL("SerializeJSON(BinaryArchiveWriter&,const_Class&)-Appends",
+                   String("[{\"X\":1,\"Y\":2}"),Writer.Finish().ToString())
+    }// Writing
+
+    {// Round Trip
+        Shape Original;
+        Original.Name = "Quad \xE2\x82\xAC";
+        Original.Outline = { Point{1,2}, Point{3,4}, Point{-5,6}, Point{7,-8} };
+        Original.Counters = { { "Edges", 4 } };
+        Original.Labels = { { -1, "Minus" }, { 10, "Ten" } };
+        Original.Scale = 0.1;
+        Original.Fill = Colour::Green;
+        Original.Visible = true;
+        Original.CachedArea = 16;
+
+        Shape Copy;
+        DeserializeJSON(SerializeJSON(Original),Copy);
+        TEST_EQUAL("DeserializeJSON(const_BinaryBuffer&,Class&)-Name",
+                   Original.Name,Copy.Name)
+        TEST_EQUAL("DeserializeJSON(const_BinaryBuffer&,Class&)-OutlineSize",
+                   Original.Outline.size(),Copy.Outline.size())
+        TEST_EQUAL("DeserializeJSON(const_BinaryBuffer&,Class&)-Outline",
+                   -8,Copy.Outline.back().Y)
+        TEST_EQUAL("DeserializeJSON(const_BinaryBuffer&,Class&)-Counters",
+                   UInt32(4),Copy.Counters["Edges"])
+        TEST_EQUAL("DeserializeJSON(const_BinaryBuffer&,Class&)-Labels",
+                   String("Minus"),Copy.Labels[-1])
+        TEST_EQUAL("DeserializeJSON(const_BinaryBuffer&,Class&)-Scale",
+                   0.1,Copy.Scale)
+        TEST_EQUAL("DeserializeJSON(const_BinaryBuffer&,Class&)-Fill",
+                   Colour::Green,Copy.Fill)
+        TEST_EQUAL("DeserializeJSON(const_BinaryBuffer&,Class&)-Visible",
+                   true,Copy.Visible)
+        TEST_EQUAL("DeserializeJSON(const_BinaryBuffer&,Class&)-Generated",
+                   UInt32(0),Copy.CachedArea)
+    }// Round Trip
+
+    {// Reading
+        const String Text = " { \"Extra\" : { \"Nested\" : [ 1, 2.5e3, true, null, \"}\" ] } ,\n"
+                            "\t\"Visible\":false, \"Name\":\"\\u00e9\\ud83d\\ude00\\/\" , \"Scale\":null,"
+                            " \"CachedArea\":9, \"Fill\":2 } ";
+        Shape Dest;
+        Dest.Visible = true;
+        Dest.Scale = 2.0;
+        BinaryBuffer Source(Text);
+        BinaryArchiveReader Reader(Source);
+        DeserializeJSON(Reader,Dest);
+        TEST_EQUAL("DeserializeJSON(BinaryArchiveReader&,Class&)-AnyOrder",
+                   false,Dest.Visible)
+        TEST_EQUAL("DeserializeJSON(BinaryArchiveReader&,Class&)-Unicode",
+                   String("\xC3\xA9\xF0\x9F\x98\x80/"),Dest.Name)
+        TEST_EQUAL("DeserializeJSON(BinaryArchiveReader&,Class&)-Null",
+                   2.0,Dest.Scale)
+        TEST_EQUAL("DeserializeJSON(BinaryArchiveReader&,Class&)-SkipsGenerated",
+                   UInt32(0),Dest.CachedArea)
+        TEST_EQUAL("DeserializeJSON(BinaryArchiveReader&,Class&)-Enum",
+                   Colour::Green,Dest.Fill)
+        TEST_EQUAL("DeserializeJSON(BinaryArchiveReader&,Class&)-Position",
+                   Text.size() - 1,Reader.GetPosition())
+
+        Point Empty{5,6};
+        DeserializeJSON(BinaryBuffer(String("{}")),Empty);
+        TEST_EQUAL("DeserializeJSON(const_BinaryBuffer&,Class&)-EmptyObject",
+                   5,Empty.X)
+    }// Reading
+
+    {// Errors
+        TEST_THROW("DeserializeJSON(const_BinaryBuffer&,Class&)-Throw-NotObject",
+                   Mezzanine::Exception::Encoding,
+                   [](){ ReadPoint("[1,2]"); })
+        TEST_THROW("DeserializeJSON(const_BinaryBuffer&,Class&)-Throw-MissingComma",
+                   Mezzanine::Exception::Encoding,
+                   [](){ ReadPoint("{\"X\":1 \"Y\":2}"); })
+        TEST_THROW("DeserializeJSON(const_BinaryBuffer&,Class&)-Throw-BadNumber",
+                   Mezzanine::Exception::Encoding,
+                   [](){ ReadPoint("{\"X\":1.5}"); })
+        TEST_THROW("DeserializeJSON(const_BinaryBuffer&,Class&)-Throw-Overflow",
+                   Mezzanine::Exception::Encoding,
+                   [](){ ReadPoint("{\"X\":4294967296}"); })
+        TEST_THROW("DeserializeJSON(const_BinaryBuffer&,Class&)-Throw-BadLiteral",
+                   Mezzanine::Exception::Encoding,
+                   [](){ ReadPoint("{\"Z\":nul}"); })
+        TEST_THROW("DeserializeJSON(const_BinaryBuffer&,Class&)-Throw-BadEscape",
+                   Mezzanine::Exception::Encoding,
+                   [](){ ReadPoint("{\"Z\":\"\\q\"}"); })
+        TEST_THROW("DeserializeJSON(const_BinaryBuffer&,Class&)-Throw-LoneSurrogate",
+                   Mezzanine::Exception::Encoding,
+                   [](){ ReadPoint("{\"Z\":\"\\udc00\"}"); })
+        TEST_THROW("DeserializeJSON(const_BinaryBuffer&,Class&)-Throw-Truncated",
+                   Mezzanine::Exception::OutOfRange,
+                   [](){ ReadPoint("{\"X\":1,"); })
+        TEST_THROW("DeserializeJSON(const_BinaryBuffer&,Class&)-Throw-TooDeep",
+                   Mezzanine::Exception::Encoding,
+                   [](){ ReadPoint("{\"Z\":" + String(300,'[')); })
+    }// Errors
+}
+
+#endif
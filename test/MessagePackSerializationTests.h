@@ -0,0 +1,281 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_MessagePackSerializationTests_h
+#define Mezz_Foundation_MessagePackSerializationTests_h
+
+/// @file
+/// @brief This file tests the functionality of the MessagePack writer and reader.
+
+#include "MezzTest.h"
+
+#include "MezzException.h"
+#include "MessagePackSerialization.h"
+
+#include <map>
+#include <vector>
+
+namespace MessagePackSerializationTest
+{
+    using Mezzanine::UInt8;
+    using Mezzanine::Int64;
+    using Mezzanine::Int32;
+    using Mezzanine::UInt32;
+    using Mezzanine::String;
+    using Mezzanine::StringView;
+
+    enum class Colour : UInt8
+    {
+        Red = 1,
+        Green = 2,
+        Blue = 3
+    };
+
+    struct Point
+    {
+        Int32 X = 0;
+        Int32 Y = 0;
+
+        static auto RegisterMembers()
+        {
+            using namespace Mezzanine;
+            using SelfType = Point;
+
+            return Members(
+                MakeMemberAccessor("X",&SelfType::X),
+                MakeMemberAccessor("Y",&SelfType::Y)
+            );
+        }
+    };
+
+    struct SmallPoint
+    {
+        UInt8 X = 0;
+        String Y;
+
+        static auto RegisterMembers()
+        {
+            using namespace Mezzanine;
+            using SelfType = SmallPoint;
+
+            return Members(
+                MakeMemberAccessor("X",&SelfType::X),
+                MakeMemberAccessor("Y",&SelfType::Y)
+            );
+        }
+    };
+
+    struct Shape
+    {
+        String Name;
+        std::vector<Point> Outline;
+        std::map<String,UInt32> Counters;
+        std::vector<Int64> Offsets;
+        double Scale = 1.0;
+        float Rotation = 0.0f;
+        Colour Fill = Colour::Red;
+        bool Visible = false;
+        UInt32 CachedArea = 0;
+
+        static StringView RegisterName()
+            { return "Shape"; }
+
+        static auto RegisterMembers()
+        {
+            using namespace Mezzanine;
+            using SelfType = Shape;
+
+            return Members(
+                MakeMemberAccessor("Name",&SelfType::Name),
+                MakeMemberAccessor("Outline",&SelfType::Outline),
+                MakeMemberAccessor("Counters",&SelfType::Counters),
+                MakeMemberAccessor("Offsets",&SelfType::Offsets),
+                MakeMemberAccessor("Scale",&SelfType::Scale),
+                MakeMemberAccessor("Rotation",&SelfType::Rotation),
+                MakeMemberAccessor("Fill",&SelfType::Fill),
+                MakeMemberAccessor("Visible",&SelfType::Visible),
+                MakeMemberAccessor<MemberTags::Generated>("CachedArea",&SelfType::CachedArea)
+            );
+        }
+    };
+
+    /// @brief Wraps a list of bytes in a BinaryBuffer.
+    inline Mezzanine::BinaryBuffer MakeBuffer(const std::vector<UInt8>& Bytes)
+    {
+        Mezzanine::BinaryBuffer Result(Bytes.size());
+        std::copy(Bytes.begin(),Bytes.end(),Result.Binary);
+        return Result;
+    }
+    /// @brief Copies the contents of a BinaryBuffer into a list of bytes.
+    inline std::vector<UInt8> GetBytes(const Mezzanine::BinaryBuffer& Buffer)
+        { return std::vector<UInt8>(Buffer.Binary,Buffer.Binary + Buffer.Size); }
+}
+
+AUTOMATIC_TEST_GROUP(MessagePackSerializationTests,MessagePackSerialization)
+{
+    using namespace Mezzanine;
+    using namespace MessagePackSerializationTest;
+
+    {// Writing
+        const std::vector<UInt8> SmallExpected = { 0x82, 0xA1, 'X', 0x01, 0xA1, 'Y', 0xFD };
+        TEST_EQUAL("SerializeMessagePack(const_Class&)-FixFormats",
+                   true,SmallExpected == GetBytes( SerializeMessagePack( Point{1,-3} ) ))
+
+        const std::vector<UInt8> WideExpected = { 0x82, 0xA1, 'X', 0xCD, 0x01, 0x2C,
+                                                  0xA1, 'Y', 0xD2, 0xFF, 0xFE, 0x79, 0x60 };
+        TEST_EQUAL("SerializeMessagePack(const_Class&)-SizedFormats",
+                   true,WideExpected == GetBytes( SerializeMessagePack( Point{300,-100000} ) ))
+
+        BinaryArchiveWriter Writer;
+        Writer.WriteRaw( UInt8(0x92) );
+        SerializeMessagePack(Writer,Point{0,0});
+        SerializeMessagePack(Writer,Point{1,1});
+        TEST_EQUAL("SerializeMessagePack(BinaryArchiveWriter&,const_Class&)-Appends",
+                   SizeType(15),Writer.GetSize())
+    }// Writing
+
+    {// Round Trip
+        Shape Original;
+        Original.Name = String(40,'n');
+        Original.Outline.resize(20,Point{-40000,70000});
+        Original.Counters = { { "Edges", 4000000000u }, { "Faces", 1 } };
+        Original.Offsets = { -1, -33, -129, -32769, std::numeric_limits<Int64>::min(), 1ll << 40 };
+        Original.Scale = 0.1;
+        Original.Rotation = 1.5f;
+        Original.Fill = Colour::Green;
+        Original.Visible = true;
+        Original.CachedArea = 16;
+
+        Shape Copy;
+        DeserializeMessagePack(SerializeMessagePack(Original),Copy);
+        TEST_EQUAL("DeserializeMessagePack(const_BinaryBuffer&,Class&)-Name",
+                   Original.Name,Copy.Name)
+        TEST_EQUAL("DeserializeMessagePack(const_BinaryBuffer&,Class&)-OutlineSize",
+                   Original.Outline.size(),Copy.Outline.size())
+        TEST_EQUAL("DeserializeMessagePack(const_BinaryBuffer&,Class&)-Outline",
+                   70000,Copy.Outline.back().Y)
+        TEST_EQUAL("DeserializeMessagePack(const_BinaryBuffer&,Class&)-Counters",
+                   UInt32(4000000000u),Copy.Counters["Edges"])
+        TEST_EQUAL("DeserializeMessagePack(const_BinaryBuffer&,Class&)-Offsets",
+                   true,Original.Offsets == Copy.Offsets)
+        TEST_EQUAL("DeserializeMessagePack(const_BinaryBuffer&,Class&)-Scale",
+                   0.1,Copy.Scale)
+        TEST_EQUAL("DeserializeMessagePack(const_BinaryBuffer&,Class&)-Rotation",
+                   1.5f,Copy.Rotation)
+        TEST_EQUAL("DeserializeMessagePack(const_BinaryBuffer&,Class&)-Fill",
+                   Colour::Green,Copy.Fill)
+        TEST_EQUAL("DeserializeMessagePack(const_BinaryBuffer&,Class&)-Visible",
+                   true,Copy.Visible)
+        TEST_EQUAL("DeserializeMessagePack(const_BinaryBuffer&,Class&)-Generated",
+                   UInt32(0),Copy.CachedArea)
+    }// Round Trip
+
+    {// Reading
+        // { "Extra": [bin8, fixext4, ext8, {nil:false}], "Y": 7, "X": nil, "Z": 1.0 }
+        const std::vector<UInt8> Bytes = { 0x84,
+                                           0xA5, 'E', 'x', 't', 'r', 'a', 0x94,
+                                               0xC4, 0x02, 0xAA, 0xBB,
+                                               0xD6, 0x01, 0x00, 0x00, 0x00, 0x00,
+                                               0xC7, 0x01, 0x05, 0xCC,
+                                               0x81, 0xC0, 0xC2,
+                                           0xA1, 'Y', 0x07,
+                                           0xA1, 'X', 0xC0,
+                                           0xA1, 'Z', 0xCB, 0x3F, 0xF0, 0, 0, 0, 0, 0, 0,
+                                           0xC0 };
+        Point Dest{9,9};
+        BinaryBuffer Source = MakeBuffer(Bytes);
+        BinaryArchiveReader Reader(Source);
+        DeserializeMessagePack(Reader,Dest);
+        TEST_EQUAL("DeserializeMessagePack(BinaryArchiveReader&,Class&)-AnyOrder",
+                   7,Dest.Y)
+        TEST_EQUAL("DeserializeMessagePack(BinaryArchiveReader&,Class&)-Nil",
+                   9,Dest.X)
+        TEST_EQUAL("DeserializeMessagePack(BinaryArchiveReader&,Class&)-Position",
+                   Bytes.size() - 1,Reader.GetPosition())
+    }// Reading
+
+    {// Errors
+        TEST_THROW("DeserializeMessagePack(const_BinaryBuffer&,Class&)-Throw-Overflow",
+                   Mezzanine::Exception::OutOfRange,
+                   [](){
+                       SmallPoint Dest;
+                       DeserializeMessagePack(SerializeMessagePack( Point{256,0} ),Dest);
+                   })
+        TEST_THROW("DeserializeMessagePack(const_BinaryBuffer&,Class&)-Throw-Negative",
+                   Mezzanine::Exception::OutOfRange,
+                   [](){
+                       SmallPoint Dest;
+                       DeserializeMessagePack(SerializeMessagePack( Point{-1,0} ),Dest);
+                   })
+        TEST_THROW("DeserializeMessagePack(const_BinaryBuffer&,Class&)-Throw-WrongType",
+                   Mezzanine::Exception::Encoding,
+                   [](){
+                       SmallPoint Dest;
+                       DeserializeMessagePack(SerializeMessagePack( Point{1,2} ),Dest);
+                   })
+        TEST_THROW("DeserializeMessagePack(const_BinaryBuffer&,Class&)-Throw-NotMap",
+                   Mezzanine::Exception::Encoding,
+                   [](){
+                       Point Dest;
+                       DeserializeMessagePack(MakeBuffer( { 0x92, 0x01, 0x02 } ),Dest);
+                   })
+        TEST_THROW("DeserializeMessagePack(const_BinaryBuffer&,Class&)-Throw-UnknownFormat",
+                   Mezzanine::Exception::Encoding,
+                   [](){
+                       Point Dest;
+                       DeserializeMessagePack(MakeBuffer( { 0x81, 0xA1, 'Z', 0xC1 } ),Dest);
+                   })
+        TEST_THROW("DeserializeMessagePack(const_BinaryBuffer&,Class&)-Throw-Truncated",
+                   Mezzanine::Exception::OutOfRange,
+                   [](){
+                       Point Dest;
+                       DeserializeMessagePack(MakeBuffer( { 0x82, 0xA1, 'X', 0xCD, 0x01 } ),Dest);
+                   })
+        std::vector<UInt8> Deep = { 0x81, 0xA1, 'Z' };
+        Deep.resize(400,0x91);
+        TEST_THROW("DeserializeMessagePack(const_BinaryBuffer&,Class&)-Throw-TooDeep",
+                   Mezzanine::Exception::Encoding,
+                   [&Deep](){
+                       Point Dest;
+                       DeserializeMessagePack(MakeBuffer(Deep),Dest);
+                   })
+    }// Errors
+}
+
+#endif
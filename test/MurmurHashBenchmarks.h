@@ -0,0 +1,120 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_MurmurHashBenchmarks_h
+#define Mezz_Foundation_MurmurHashBenchmarks_h
+
+/// @file
+/// @brief This contains benchmarks comparing the batch Murmur hash against hashing each key alone.
+
+#include "MezzTest.h"
+#include "TimingTools.h"
+#include "RuntimeStatics.h"
+
+#include "MurmurHash.h"
+
+BENCHMARK_TEST_GROUP(MurmurHashBenchmarks,MurmurHashBenchmarks)
+{
+    if(Mezzanine::RuntimeStatic::Debug())
+        { return; }
+
+    using namespace Mezzanine;
+
+    using Mezzanine::Testing::MicroBenchmark;
+    using Mezzanine::Testing::MicroBenchmarkResults;
+
+    const std::chrono::seconds TestTime(1);
+
+    // Lots of short keys of similar length, like the names handed to HashedString.
+    const SizeType KeyCount = 4096;
+    String Text;
+    std::vector<SizeType> Offsets;
+    std::vector<SizeType> Lengths;
+    for( SizeType KeyIdx = 0 ; KeyIdx < KeyCount ; ++KeyIdx )
+    {
+        const String Name = "Mezzanine.Resource.Asset." + std::to_string( KeyIdx * 7919 ) + ".mesh";
+        Offsets.push_back( Text.size() );
+        Lengths.push_back( Name.size() );
+        Text += Name;
+    }
+    std::vector<const void*> Keys;
+    SizeType TotalBytes = 0;
+    for( SizeType KeyIdx = 0 ; KeyIdx < KeyCount ; ++KeyIdx )
+    {
+        Keys.push_back( Text.data() + Offsets[KeyIdx] );
+        TotalBytes += Lengths[KeyIdx];
+    }
+
+    TestLog << "\n" << "Murmur Hash Benchmarks" << "\n\n"
+            << "Hashing " << KeyCount << " keys of about " << ( TotalBytes / KeyCount ) << " bytes each with "
+            << "MurmurHash3_x86_32 one at a time, and all at once with MurmurHash3_x86_32_Batch.\n\n";
+
+    // Reports a result and returns the nanoseconds per iteration.
+    auto Report = [&](const char* Description, const MicroBenchmarkResults& Result) {
+        const PreciseReal Per = PreciseReal( Result.WallTotal.count() ) / PreciseReal( Result.Iterations );
+        TestLog << Description << " " << Result.Iterations << " times in "
+                << Mezzanine::Testing::PrettyDurationString(Result.WallTotal) << ", "
+                << ( PreciseReal(TotalBytes) * 1000.0 / Per ) << " MB/s and "
+                << ( PreciseReal(KeyCount) * 1000.0 / Per ) << " million keys/s\n";
+        return Per;
+    };
+
+    std::vector<UInt32> ScalarHashes(KeyCount);
+    auto HashScalar = [&](){
+        for( SizeType KeyIdx = 0 ; KeyIdx < KeyCount ; ++KeyIdx )
+            { ScalarHashes[KeyIdx] = Hashing::MurmurHash3_x86_32(Keys[KeyIdx],Lengths[KeyIdx],0); }
+    };
+    const MicroBenchmarkResults ScalarResult = MicroBenchmark(TestTime,std::move(HashScalar));
+    const PreciseReal ScalarPer = Report("One at a time hashed every key",ScalarResult);
+
+    std::vector<UInt32> BatchHashes(KeyCount);
+    auto HashBatch = [&](){
+        Hashing::MurmurHash3_x86_32_Batch(Keys.data(),Lengths.data(),KeyCount,0,BatchHashes.data());
+    };
+    const MicroBenchmarkResults BatchResult = MicroBenchmark(TestTime,std::move(HashBatch));
+    const PreciseReal BatchPer = Report("Batch hashed every key",BatchResult);
+
+    TestLog << "\nThe batch takes about " << ( BatchPer * 100.0 ) / ScalarPer << "% as long.\n\n";
+
+    TEST_EQUAL("MurmurHash3_x86_32_Batch-MatchesScalar",
+               true,ScalarHashes == BatchHashes)
+    TEST_PERF("BatchIsFaster", BatchPer < ScalarPer)
+}
+
+#endif
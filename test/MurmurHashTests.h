@@ -55,6 +55,7 @@ SUPPRESS_GCC_WARNING("-Wimplicit-fallthrough")
 SUPPRESS_GCC_WARNING("-Wcast-align")
 SUPPRESS_CLANG_WARNING("-Wc++98-compat-pedantic")
 SUPPRESS_CLANG_WARNING("-Wsign-conversion")
+SUPPRESS_GCC_WARNING("-Wsign-conversion")
 SUPPRESS_CLANG_WARNING("-Wcast-align")
 namespace aappleby {
 #if defined(_MSC_VER)
@@ -464,6 +465,86 @@ AUTOMATIC_TEST_GROUP(MurmurHashTests,MurmurHash)
                    AapplebyLarge,MezzLarge)
     }// x86_32 - Binary
 
+    {// x86_32 - Constexpr
+        // Every prefix of the text, to cover each tail length.
+        SizeType Mismatches = 0;
+        for( SizeType Length = 0 ; Length <= SmallText.size() ; ++Length )
+        {
+            const UInt32 Runtime = Hashing::MurmurHash3_x86_32(SmallText.data(),Length,FirstSeed);
+            const UInt32 Constexpr = Hashing::MurmurHash3_x86_32(StringView(SmallText.data(),Length),FirstSeed);
+            Mismatches += ( Runtime != Constexpr );
+        }
+        TEST_EQUAL("MurmurHash3_x86_32(const_StringView,const_UInt32)-Text-Prefixes",
+                   SizeType(0),Mismatches)
+        const UInt32 MezzLarge = Hashing::MurmurHash3_x86_32(LargeText.data(),LargeText.size(),SecondSeed);
+        TEST_EQUAL("MurmurHash3_x86_32(const_StringView,const_UInt32)-Text-Large",
+                   MezzLarge,Hashing::MurmurHash3_x86_32(StringView(LargeText),SecondSeed))
+        const StringView BinaryView( reinterpret_cast<const char*>( LargeBinary.data() ), LargeBinary.size() );
+        const UInt32 MezzBinary = Hashing::MurmurHash3_x86_32(LargeBinary.data(),LargeBinary.size(),SecondSeed);
+        TEST_EQUAL("MurmurHash3_x86_32(const_StringView,const_UInt32)-Binary-Large",
+                   MezzBinary,Hashing::MurmurHash3_x86_32(BinaryView,SecondSeed))
+
+        constexpr UInt32 CompileTimeTiny = Hashing::MurmurHash3_x86_32(StringView("Hi"),FirstSeed);
+        const UInt32 MezzTiny = Hashing::MurmurHash3_x86_32(TinyText.data(),TinyText.size(),FirstSeed);
+        Boole MatchedCase = false;
+        switch( MezzTiny )
+        {
+            case CompileTimeTiny:  MatchedCase = true;  break;
+            default:                                    break;
+        }
+        TEST_EQUAL("MurmurHash3_x86_32(const_StringView,const_UInt32)-CaseLabel",
+                   true,MatchedCase)
+    }// x86_32 - Constexpr
+
+    {// x86_32 - Batch
+        // 31 keys fill one group of each lane width with 3 left over for the scalar path.  The lengths step
+        // through every tail and through keys long enough to share several vector steps.
+        const SizeType KeyCount = 31;
+        std::vector<const void*> Keys;
+        std::vector<SizeType> Lengths;
+        for( SizeType KeyIdx = 0 ; KeyIdx < KeyCount ; ++KeyIdx )
+        {
+            const SizeType Offset = KeyIdx % 7;
+            Keys.push_back( LargeText.data() + Offset );
+            Lengths.push_back( ( ( KeyIdx * 37 ) + ( 48 * ( KeyIdx % 2 ) ) ) % ( LargeText.size() - Offset + 1 ) );
+        }
+        // All the same long length, so the vector lanes do nearly all of the work.
+        std::vector<const void*> BinaryKeys(KeyCount,LargeBinary.data());
+        std::vector<SizeType> BinaryLengths(KeyCount,LargeBinary.size() - 1);
+
+        SizeType TextMismatches = 0;
+        SizeType BinaryMismatches = 0;
+        for( SizeType Count = 0 ; Count <= KeyCount ; ++Count )
+        {
+            std::vector<UInt32> TextHashes(Count);
+            std::vector<UInt32> BinaryHashes(Count);
+            Hashing::MurmurHash3_x86_32_Batch(Keys.data(),Lengths.data(),Count,FirstSeed,TextHashes.data());
+            Hashing::MurmurHash3_x86_32_Batch(BinaryKeys.data(),BinaryLengths.data(),Count,SecondSeed,
+                                              BinaryHashes.data());
+            for( SizeType KeyIdx = 0 ; KeyIdx < Count ; ++KeyIdx )
+            {
+                TextMismatches += ( TextHashes[KeyIdx] !=
+                                    Hashing::MurmurHash3_x86_32(Keys[KeyIdx],Lengths[KeyIdx],FirstSeed) );
+                const UInt32 BinaryHash =
+                    Hashing::MurmurHash3_x86_32(LargeBinary.data(),BinaryLengths[KeyIdx],SecondSeed);
+                BinaryMismatches += ( BinaryHashes[KeyIdx] != BinaryHash );
+            }
+        }
+        TEST_EQUAL("MurmurHash3_x86_32_Batch(const_void*const*,const_SizeType*,const_SizeType,const_UInt32,UInt32*)-Text",
+                   SizeType(0),TextMismatches)
+        TEST_EQUAL("MurmurHash3_x86_32_Batch(const_void*const*,const_SizeType*,const_SizeType,const_UInt32,UInt32*)-Binary",
+                   SizeType(0),BinaryMismatches)
+
+        UInt32 AapplebyLarge{};
+        MurmurHash3_x86_32(LargeText.data(),LargeTextSize,FirstSeed,&AapplebyLarge);
+        std::vector<const void*> SameKeys(KeyCount,LargeText.data());
+        std::vector<SizeType> SameLengths(KeyCount,LargeText.size());
+        std::vector<UInt32> SameHashes(KeyCount);
+        Hashing::MurmurHash3_x86_32_Batch(SameKeys.data(),SameLengths.data(),KeyCount,FirstSeed,SameHashes.data());
+        TEST_EQUAL("MurmurHash3_x86_32_Batch(const_void*const*,const_SizeType*,const_SizeType,const_UInt32,UInt32*)-Reference",
+                   KeyCount,static_cast<SizeType>( std::count(SameHashes.begin(),SameHashes.end(),AapplebyLarge) ))
+    }// x86_32 - Batch
+
     {// x86_128 - Text
         Result_x86 AapplebyTiny;
         MurmurHash3_x86_128(TinyText.data(),TinyTextSize,FirstSeed,&AapplebyTiny.Hash[0]);
@@ -591,6 +672,74 @@ AUTOMATIC_TEST_GROUP(MurmurHashTests,MurmurHash)
         TEST_EQUAL("MurmurHash3_x64_128(const_void*,const_Integer,const_UInt32)-Binary-Large-Index1",
                    AapplebyLarge.Hash[1],MezzLarge.Hash[1])
     }// x64_128 - Binary
+
+    {// Streams
+        // Feed the text in every piece size up to a bit over the largest block, so the carried over bytes land
+        // at every offset within a block.
+        const UInt8* Text = reinterpret_cast<const UInt8*>( LargeText.data() );
+        const SizeType TextSize = LargeText.size();
+        const UInt32 OneShot32 = Hashing::MurmurHash3_x86_32(Text,TextSize,FirstSeed);
+        const Result_x86 OneShot86 = Hashing::MurmurHash3_x86_128(Text,TextSize,FirstSeed);
+        const Result_x64 OneShot64 = Hashing::MurmurHash3_x64_128(Text,TextSize,FirstSeed);
+        SizeType Mismatches32 = 0;
+        SizeType Mismatches86 = 0;
+        SizeType Mismatches64 = 0;
+        for( SizeType PieceSize = 1 ; PieceSize <= 35 ; ++PieceSize )
+        {
+            Hashing::MurmurHash3Stream_x86_32 Stream32(FirstSeed);
+            Hashing::MurmurHash3Stream_x86_128 Stream86(FirstSeed);
+            Hashing::MurmurHash3Stream_x64_128 Stream64(FirstSeed);
+            for( SizeType Offset = 0 ; Offset < TextSize ; Offset += PieceSize )
+            {
+                const SizeType Length = std::min(PieceSize,TextSize - Offset);
+                Stream32.Update(Text + Offset,Length);
+                Stream86.Update(Text + Offset,Length);
+                Stream64.Update(Text + Offset,Length);
+            }
+            const Result_x86 Streamed86 = Stream86.Finalize();
+            const Result_x64 Streamed64 = Stream64.Finalize();
+            Mismatches32 += ( Stream32.Finalize() != OneShot32 );
+            Mismatches86 += !std::equal(std::begin(Streamed86.Hash),std::end(Streamed86.Hash),
+                                        std::begin(OneShot86.Hash));
+            Mismatches64 += !std::equal(std::begin(Streamed64.Hash),std::end(Streamed64.Hash),
+                                        std::begin(OneShot64.Hash));
+        }
+        TEST_EQUAL("MurmurHash3Stream_x86_32::Update(const_void*,const_SizeType)-PieceSizes",
+                   SizeType(0),Mismatches32)
+        TEST_EQUAL("MurmurHash3Stream_x86_128::Update(const_void*,const_SizeType)-PieceSizes",
+                   SizeType(0),Mismatches86)
+        TEST_EQUAL("MurmurHash3Stream_x64_128::Update(const_void*,const_SizeType)-PieceSizes",
+                   SizeType(0),Mismatches64)
+
+        // Uneven pieces, including empty ones, checking the hash of each prefix along the way.
+        Hashing::MurmurHash3Stream_x64_128 Uneven(SecondSeed);
+        SizeType PrefixMismatches = 0;
+        SizeType Offset = 0;
+        for( SizeType PieceIdx = 0 ; Offset < LargeBinary.size() ; ++PieceIdx )
+        {
+            const SizeType Length = std::min( ( PieceIdx * 7 ) % 19,LargeBinary.size() - Offset );
+            Uneven.Update(LargeBinary.data() + Offset,Length);
+            Offset += Length;
+            const Result_x64 Prefix = Hashing::MurmurHash3_x64_128(LargeBinary.data(),Offset,SecondSeed);
+            const Result_x64 Streamed = Uneven.Finalize();
+            PrefixMismatches += ( Prefix.Hash[0] != Streamed.Hash[0] || Prefix.Hash[1] != Streamed.Hash[1] );
+        }
+        TEST_EQUAL("MurmurHash3Stream_x64_128::Finalize()_const-Prefixes",
+                   SizeType(0),PrefixMismatches)
+        TEST_EQUAL("MurmurHash3Stream_x64_128::GetLength()_const",
+                   LargeBinary.size(),Uneven.GetLength())
+
+        Hashing::MurmurHash3Stream_x86_32 Reused(SecondSeed);
+        Reused.Update(Text,TextSize);
+        Reused.Reset(FirstSeed);
+        TEST_EQUAL("MurmurHash3Stream_x86_32::Reset(const_UInt32)-Empty",
+                   Hashing::MurmurHash3_x86_32(Text,0,FirstSeed),Reused.Finalize())
+        Reused.Update(TinyText.data(),TinyText.size());
+        UInt32 AapplebyTiny{};
+        MurmurHash3_x86_32(TinyText.data(),TinyTextSize,FirstSeed,&AapplebyTiny);
+        TEST_EQUAL("MurmurHash3Stream_x86_32::Reset(const_UInt32)-Reference",
+                   AapplebyTiny,Reused.Finalize())
+    }// Streams
 }
 
 #endif // Mezz_Foundation_MurmurHashTests_h
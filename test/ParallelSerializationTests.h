@@ -0,0 +1,176 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_ParallelSerializationTests_h
+#define Mezz_Foundation_ParallelSerializationTests_h
+
+/// @file
+/// @brief This file tests the functionality of chunked parallel serialization.
+
+#include "MezzTest.h"
+#include "RuntimeStatics.h"
+
+#include "MezzException.h"
+#include "ParallelSerialization.h"
+
+#include <atomic>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <streambuf>
+
+AUTOMATIC_TEST_GROUP(ParallelSerializationTests,ParallelSerialization)
+{
+    using namespace Mezzanine;
+
+    const SizeType ItemCount = 10007;
+    auto WriteItems = [](const SizeType Begin, const SizeType End, String& Buffer) {
+        for( SizeType Item = Begin ; Item < End ; ++Item )
+        {
+            Buffer.append("<Item Id=\"");
+            Buffer.append( std::to_string(Item) );
+            Buffer.append("\"/>");
+        }
+    };
+
+    std::ostringstream Expected;
+    {
+        String All;
+        WriteItems(0,ItemCount,All);
+        Expected << All;
+    }
+
+    {// Serial
+        ParallelChunkOptions Serial;
+        Serial.ThreadCount = 1;
+        Serial.ChunkSize = 100;
+        std::ostringstream SerialOut;
+        ParallelSerializeChunks(SerialOut,ItemCount,Serial,WriteItems);
+        TEST_EQUAL("ParallelSerializeChunks-Serial",
+                   Expected.str(),SerialOut.str())
+
+        ParallelChunkOptions Parallel;
+        Parallel.ThreadCount = 4;
+        std::ostringstream EmptyOut;
+        ParallelSerializeChunks(EmptyOut,0,Parallel,WriteItems);
+        TEST_EQUAL("ParallelSerializeChunks-Empty",
+                   true,EmptyOut.str().empty())
+
+        ParallelChunkOptions NoChunk;
+        NoChunk.ChunkSize = 0;
+        TEST_THROW("ParallelSerializeChunks-ZeroChunkSize",
+                   Exception::InvalidLength,
+                   [&](){ std::ostringstream Out;
+                          ParallelSerializeChunks(Out,ItemCount,NoChunk,WriteItems); })
+    }// Serial
+
+    // Emscripten builds are run without thread support.
+    if(Mezzanine::RuntimeStatic::CompilerIsEmscripten())
+        { return; }
+
+    {// Ordering
+        ParallelChunkOptions Parallel;
+        Parallel.ThreadCount = 4;
+        Parallel.ChunkSize = 64;
+        std::ostringstream ParallelOut;
+        ParallelSerializeChunks(ParallelOut,ItemCount,Parallel,WriteItems);
+        TEST_EQUAL("ParallelSerializeChunks-Parallel",
+                   Expected.str(),ParallelOut.str())
+
+        ParallelChunkOptions Tight = Parallel;
+        Tight.MaxChunksInFlight = 1;
+        std::ostringstream TightOut;
+        ParallelSerializeChunks(TightOut,ItemCount,Tight,WriteItems);
+        TEST_EQUAL("ParallelSerializeChunks-OneInFlight",
+                   Expected.str(),TightOut.str())
+    }// Ordering
+
+    {// Memory Bound
+        ParallelChunkOptions Bounded;
+        Bounded.ThreadCount = 4;
+        Bounded.ChunkSize = 16;
+        Bounded.MaxChunksInFlight = 3;
+        std::atomic<SizeType> Active{0};
+        std::atomic<SizeType> MostActive{0};
+        std::ostringstream BoundedOut;
+        ParallelSerializeChunks(BoundedOut,ItemCount,Bounded,[&](const SizeType Begin, const SizeType End, String& Buffer) {
+            SizeType Now = ++Active;
+            SizeType Most = MostActive.load();
+            while( Now > Most && !MostActive.compare_exchange_weak(Most,Now) ) {  }
+            WriteItems(Begin,End,Buffer);
+            --Active;
+        });
+        TEST_EQUAL("ParallelSerializeChunks-BoundedOutput",
+                   Expected.str(),BoundedOut.str())
+        TEST_EQUAL("ParallelSerializeChunks-BoundedInFlight",
+                   true,MostActive.load() <= 3)
+    }// Memory Bound
+
+    {// Errors
+        ParallelChunkOptions Failing;
+        Failing.ThreadCount = 4;
+        Failing.ChunkSize = 10;
+        TEST_THROW("ParallelSerializeChunks-Rethrow",
+                   std::runtime_error,
+                   [&](){ std::ostringstream Out;
+                          ParallelSerializeChunks(Out,ItemCount,Failing,[](const SizeType Begin, const SizeType, String&) {
+                              if( Begin == 500 ) {
+                                  throw std::runtime_error("Chunk failed.");
+                              }
+                          }); })
+
+        // A stream buffer that refuses every write, so a stream with exceptions enabled throws from the writer.
+        class RejectingBuffer : public std::streambuf
+        {
+        protected:
+            std::streamsize xsputn(const char*, std::streamsize) override
+                { return 0; }
+            int_type overflow(int_type) override
+                { return traits_type::eof(); }
+        };
+        TEST_THROW("ParallelSerializeChunks-StreamThrows",
+                   std::ios_base::failure,
+                   [&](){ RejectingBuffer Rejecting;
+                          std::ostream Out(&Rejecting);
+                          Out.exceptions(std::ios_base::badbit);
+                          ParallelSerializeChunks(Out,ItemCount,Failing,WriteItems); })
+    }// Errors
+}
+
+#endif
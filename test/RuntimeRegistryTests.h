@@ -0,0 +1,193 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_RuntimeRegistryTests_h
+#define Mezz_Foundation_RuntimeRegistryTests_h
+
+/// @file
+/// @brief This file tests the functionality of the runtime registry of registered classes.
+
+#include "MezzTest.h"
+
+#include "MezzException.h"
+#include "RuntimeRegistry.h"
+
+#include <vector>
+
+namespace RuntimeRegistryTest
+{
+    using Mezzanine::Int32;
+    using Mezzanine::String;
+    using Mezzanine::StringView;
+
+    class Lamp
+    {
+    protected:
+        Int32 Brightness = 0;
+    public:
+        String Label;
+        std::vector<Int32> History;
+        float Warmth = 0.5f;
+
+        void SetBrightness(const Int32 NewBrightness)
+            { this->Brightness = NewBrightness; }
+        Int32 GetBrightness() const
+            { return this->Brightness; }
+
+        static StringView RegisterName()
+            { return "Lamp"; }
+
+        static auto RegisterMembers()
+        {
+            using namespace Mezzanine;
+            using SelfType = Lamp;
+
+            return Members(
+                MakeMemberAccessor("Label",&SelfType::Label),
+                MakeMemberAccessor("Brightness",&SelfType::SetBrightness,&SelfType::GetBrightness),
+                MakeMemberAccessor("History",&SelfType::History),
+                MakeMemberAccessor<MemberTags::Local>("Warmth",&SelfType::Warmth)
+            );
+        }
+    };
+
+    struct OtherLamp
+    {
+        Int32 Watts = 0;
+
+        static StringView RegisterName()
+            { return "Lamp"; }
+
+        static auto RegisterMembers()
+        {
+            using namespace Mezzanine;
+            return Members( MakeMemberAccessor("Watts",&OtherLamp::Watts) );
+        }
+    };
+}
+
+AUTOMATIC_TEST_GROUP(RuntimeRegistryTests,RuntimeRegistry)
+{
+    using namespace Mezzanine;
+    using namespace RuntimeRegistryTest;
+
+    {// Registration
+        RuntimeRegistry Registry;
+        const RuntimeClassInfo& Info = Registry.Register<Lamp>();
+        TEST_EQUAL("Register()-Count",
+                   SizeType(1),Registry.GetClassCount())
+        TEST_EQUAL("Register()-Repeat",
+                   &Info,&Registry.Register<Lamp>())
+        TEST_EQUAL("Find(const_StringView)",
+                   &Info,Registry.Find("Lamp"))
+        TEST_EQUAL("Find(const_StringView)-Missing",
+                   true,Registry.Find("Candle") == nullptr)
+        TEST_THROW("Get(const_StringView)-Missing",
+                   Exception::OutOfRange,
+                   [&](){ Registry.Get("Candle"); })
+        TEST_THROW("Register()-NameCollision",
+                   Exception::BadCast,
+                   [&](){ Registry.Register<OtherLamp>(); })
+
+        TEST_EQUAL("RuntimeClassInfo::GetName()",
+                   StringView("Lamp"),Info.GetName())
+        TEST_EQUAL("RuntimeClassInfo::GetSize()",
+                   sizeof(Lamp),Info.GetSize())
+        TEST_EQUAL("RuntimeClassInfo::GetMemberCount()",
+                   SizeType(4),Info.GetMemberCount())
+        TEST_EQUAL("RuntimeClassInfo::GetMember(const_SizeType)",
+                   StringView("Brightness"),Info.GetMember(1).Name)
+        TEST_EQUAL("RuntimeClassInfo::GetMember(const_StringView)-Type",
+                   true,*Info.GetMember("History").Type == typeid(std::vector<Int32>))
+        TEST_EQUAL("RuntimeClassInfo::GetMember(const_StringView)-Tags",
+                   MemberTags::Local,Info.GetMember("Warmth").Tags)
+        TEST_EQUAL("RuntimeClassInfo::FindMember(const_StringView)-Missing",
+                   true,Info.FindMember("Colour") == nullptr)
+        TEST_THROW("RuntimeClassInfo::GetMember(const_SizeType)-OutOfBounds",
+                   Exception::OutOfRange,
+                   [&](){ Info.GetMember(SizeType(4)); })
+    }// Registration
+
+    {// Member Access
+        RuntimeRegistry Registry;
+        Registry.Register<Lamp>();
+        const RuntimeClassInfo& Info = Registry.Get("Lamp");
+
+        Lamp Desk;
+        Desk.Label = "Desk";
+        Desk.SetBrightness(40);
+
+        RuntimeValue Label = Info.GetValue(Desk,"Label");
+        TEST_EQUAL("RuntimeClassInfo::GetValue(const_Class&,const_StringView)-Direct",
+                   String("Desk"),StaticAnyCast<String>(Label))
+        RuntimeValue Brightness = Info.GetValue(Desk,"Brightness");
+        TEST_EQUAL("RuntimeClassInfo::GetValue(const_Class&,const_StringView)-Method",
+                   Int32(40),StaticAnyCast<Int32>(Brightness))
+
+        Info.SetValue(Desk,"Brightness",RuntimeValue(Int32(75)));
+        TEST_EQUAL("RuntimeClassInfo::SetValue(Class&,const_StringView,const_RuntimeValue&)-Method",
+                   Int32(75),Desk.GetBrightness())
+        Info.SetValue(Desk,"History",RuntimeValue(std::vector<Int32>{ 1, 2, 3 }));
+        TEST_EQUAL("RuntimeClassInfo::SetValue(Class&,const_StringView,const_RuntimeValue&)-Spilled",
+                   SizeType(3),Desk.History.size())
+
+        void* Erased = &Desk;
+        Info.SetValue(Erased,"Label",RuntimeValue(String("Floor")));
+        TEST_EQUAL("RuntimeClassInfo::SetValue(void*,const_StringView,const_RuntimeValue&)",
+                   String("Floor"),Desk.Label)
+
+        TEST_THROW("RuntimeClassInfo::SetValue(Class&,const_StringView,const_RuntimeValue&)-WrongValueType",
+                   Exception::BadCast,
+                   [&](){ Info.SetValue(Desk,"Brightness",RuntimeValue(0.5f)); })
+        TEST_THROW("RuntimeClassInfo::GetValue(const_Class&,const_StringView)-WrongObjectType",
+                   Exception::BadCast,
+                   [&](){ OtherLamp Wrong; Info.GetValue(Wrong,"Label"); })
+        TEST_THROW("RuntimeClassInfo::GetValue(const_Class&,const_StringView)-MissingMember",
+                   Exception::OutOfRange,
+                   [&](){ Info.GetValue(Desk,"Colour"); })
+    }// Member Access
+
+    {// Global Registry
+        RuntimeRegistry& Global = RuntimeRegistry::GetGlobal();
+        TEST_EQUAL("GetGlobal()-SameInstance",
+                   &Global,&RuntimeRegistry::GetGlobal())
+    }// Global Registry
+}
+
+#endif
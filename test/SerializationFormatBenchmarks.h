@@ -0,0 +1,157 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_SerializationFormatBenchmarks_h
+#define Mezz_Foundation_SerializationFormatBenchmarks_h
+
+/// @file
+/// @brief This contains benchmarks comparing the JSON and MessagePack archives against the XML path.
+
+#include "MezzTest.h"
+#include "TimingTools.h"
+#include "RuntimeStatics.h"
+
+#include "JSONSerialization.h"
+#include "MessagePackSerialization.h"
+#include "XMLNodeBuilder.h"
+#include "XMLNodeBuilderTests.h"
+#include "XMLPullReader.h"
+
+BENCHMARK_TEST_GROUP(SerializationFormatBenchmarks,SerializationFormatBenchmarks)
+{
+    if(Mezzanine::RuntimeStatic::Debug())
+        { return; }
+
+    using namespace Mezzanine;
+    using namespace XMLNodeBuilderTest;
+
+    using Mezzanine::Testing::MicroBenchmark;
+    using Mezzanine::Testing::MicroBenchmarkResults;
+
+    const std::chrono::seconds TestTime(1);
+
+    Prop Source;
+    Source.Label = "Crate";
+    Source.Count = 12;
+    Source.Mass = 40.5;
+    Source.Visible = true;
+    Source.Form = Shape::Sphere;
+    Source.Extent = Bounds{2.5f,0.3f};
+
+    TestLog << "\n" << "Serialization Format Benchmarks" << "\n\n"
+            << "Writing and reading one registered object as XML, by building a node and printing it then pulling "
+            << "it back out of a stream, and as JSON and MessagePack through a reused binary archive.\n\n";
+
+    // Reports a result and returns the nanoseconds per iteration.
+    auto Report = [](const char* Description, const MicroBenchmarkResults& Result, const SizeType Bytes) {
+        const PreciseReal Per = PreciseReal( Result.WallTotal.count() ) / PreciseReal( Result.Iterations );
+        TestLog << Description << " " << Result.Iterations << " times in "
+                << Mezzanine::Testing::PrettyDurationString(Result.WallTotal) << ", "
+                << ( PreciseReal(Bytes) * 1000.0 / Per ) << " MB/s of " << Bytes << " byte documents\n";
+        return Per;
+    };
+
+    std::stringstream XMLText;
+    auto WriteXML = [&](){
+        XMLText.str( String() );
+        TestElement Root;
+        TestNode RootNode{ &Root };
+        BuildNode(RootNode,Source);
+        PrintElement(XMLText,Root.Children.front());
+    };
+    const MicroBenchmarkResults XMLWriteResult = MicroBenchmark(TestTime,std::move(WriteXML));
+    const PreciseReal XMLWritePer = Report("XML wrote",XMLWriteResult,XMLText.str().size());
+
+    BinaryArchiveWriter JSONWriter;
+    auto WriteJSON = [&](){
+        JSONWriter.Clear();
+        SerializeJSON(JSONWriter,Source);
+    };
+    const MicroBenchmarkResults JSONWriteResult = MicroBenchmark(TestTime,std::move(WriteJSON));
+    const PreciseReal JSONWritePer = Report("JSON wrote",JSONWriteResult,JSONWriter.GetSize());
+
+    BinaryArchiveWriter PackWriter;
+    auto WritePack = [&](){
+        PackWriter.Clear();
+        SerializeMessagePack(PackWriter,Source);
+    };
+    const MicroBenchmarkResults PackWriteResult = MicroBenchmark(TestTime,std::move(WritePack));
+    const PreciseReal PackWritePer = Report("MessagePack wrote",PackWriteResult,PackWriter.GetSize());
+
+    const String XMLDocument = XMLText.str();
+    Prop XMLCopy;
+    auto ReadXML = [&](){
+        std::istringstream Stream(XMLDocument);
+        StreamDeSerialize(Stream,XMLCopy);
+    };
+    const MicroBenchmarkResults XMLReadResult = MicroBenchmark(TestTime,std::move(ReadXML));
+    const PreciseReal XMLReadPer = Report("XML read",XMLReadResult,XMLDocument.size());
+
+    Prop JSONCopy;
+    auto ReadJSON = [&](){
+        BinaryArchiveReader Reader(JSONWriter.GetData(),JSONWriter.GetSize());
+        DeserializeJSON(Reader,JSONCopy);
+    };
+    const MicroBenchmarkResults JSONReadResult = MicroBenchmark(TestTime,std::move(ReadJSON));
+    const PreciseReal JSONReadPer = Report("JSON read",JSONReadResult,JSONWriter.GetSize());
+
+    Prop PackCopy;
+    auto ReadPack = [&](){
+        BinaryArchiveReader Reader(PackWriter.GetData(),PackWriter.GetSize());
+        DeserializeMessagePack(Reader,PackCopy);
+    };
+    const MicroBenchmarkResults PackReadResult = MicroBenchmark(TestTime,std::move(ReadPack));
+    const PreciseReal PackReadPer = Report("MessagePack read",PackReadResult,PackWriter.GetSize());
+
+    TestLog << "\nJSON takes about " << ( JSONWritePer * 100.0 ) / XMLWritePer << "% as long as XML to write and "
+            << ( JSONReadPer * 100.0 ) / XMLReadPer << "% as long to read.\n"
+            << "MessagePack takes about " << ( PackWritePer * 100.0 ) / XMLWritePer << "% as long as XML to write and "
+            << ( PackReadPer * 100.0 ) / XMLReadPer << "% as long to read.\n\n";
+
+    TEST_EQUAL("DeserializeJSON-RoundTrip",
+               Source.Label,JSONCopy.Label)
+    TEST_EQUAL("DeserializeMessagePack-RoundTrip",
+               Source.Extent.Height,PackCopy.Extent.Height)
+    TEST_PERF("JSONWriteIsFaster", JSONWritePer < XMLWritePer)
+    TEST_PERF("JSONReadIsFaster", JSONReadPer < XMLReadPer)
+    TEST_PERF("MessagePackWriteIsFaster", PackWritePer < XMLWritePer)
+    TEST_PERF("MessagePackReadIsFaster", PackReadPer < XMLReadPer)
+}
+
+#endif
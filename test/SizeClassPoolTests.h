@@ -0,0 +1,130 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_SizeClassPoolTests_h
+#define Mezz_Foundation_SizeClassPoolTests_h
+
+/// @file
+/// @brief This file tests the functionality of the SizeClassPool class.
+
+#include "MezzTest.h"
+#include "RuntimeStatics.h"
+
+#include "SizeClassPool.h"
+
+#include <thread>
+#include <vector>
+
+AUTOMATIC_TEST_GROUP(SizeClassPoolTests,SizeClassPool)
+{
+    using namespace Mezzanine;
+
+    { // Allocation and reuse
+        using PoolType = SizeClassPool<24,8>;
+        PoolType::Trim();
+
+        void* First = PoolType::Allocate();
+        void* Second = PoolType::Allocate();
+        TEST_EQUAL("Allocate()-Distinct", true, First != Second)
+        TEST_EQUAL("Allocate()-Aligned", true, reinterpret_cast<std::uintptr_t>(First) % 8 == 0)
+        TEST_EQUAL("Allocate()-CacheEmpty", SizeType(0), PoolType::GetCachedCount())
+
+        PoolType::Deallocate(First);
+        PoolType::Deallocate(Second);
+        TEST_EQUAL("Deallocate(void*)-Cached", SizeType(2), PoolType::GetCachedCount())
+
+        void* Reused = PoolType::Allocate();
+        TEST_EQUAL("Allocate()-ReusesLastFreed", Second, Reused)
+        TEST_EQUAL("Allocate()-CacheShrinks", SizeType(1), PoolType::GetCachedCount())
+        PoolType::Deallocate(Reused);
+        PoolType::Deallocate(nullptr);
+        TEST_EQUAL("Deallocate(nullptr)-Ignored", SizeType(2), PoolType::GetCachedCount())
+
+        PoolType::Trim();
+        TEST_EQUAL("Trim()", SizeType(0), PoolType::GetCachedCount())
+    }
+
+    { // Cache limits
+        using PoolType = SizeClassPool<8>;
+        PoolType::Trim();
+
+        std::vector<void*> Blocks;
+        for( SizeType Count = 0 ; Count < PoolType::MaxCachedBlocks + 10 ; ++Count )
+            { Blocks.push_back( PoolType::Allocate() ); }
+        for( void* Block : Blocks )
+            { PoolType::Deallocate(Block); }
+        TEST_EQUAL("MaxCachedBlocks", PoolType::MaxCachedBlocks, PoolType::GetCachedCount())
+        PoolType::Trim();
+    }
+
+    { // Over-aligned blocks
+        using PoolType = SizeClassPool<64,64>;
+        void* Block = PoolType::Allocate();
+        TEST_EQUAL("Allocate()-OverAligned", true, reinterpret_cast<std::uintptr_t>(Block) % 64 == 0)
+        PoolType::Deallocate(Block);
+        PoolType::Trim();
+    }
+
+    // Emscripten builds are run without thread support.
+    if(Mezzanine::RuntimeStatic::CompilerIsEmscripten())
+        { return; }
+
+    { // Threads
+        using PoolType = SizeClassPool<32>;
+        PoolType::Trim();
+
+        void* FromOtherThread = nullptr;
+        SizeType OtherThreadCached = 0;
+        std::thread Worker([&](){
+            FromOtherThread = PoolType::Allocate();
+            void* Local = PoolType::Allocate();
+            PoolType::Deallocate(Local);
+            OtherThreadCached = PoolType::GetCachedCount();
+        });
+        Worker.join();
+
+        TEST_EQUAL("ThreadCache-Separate", SizeType(1), OtherThreadCached)
+        TEST_EQUAL("ThreadCache-NotShared", SizeType(0), PoolType::GetCachedCount())
+        PoolType::Deallocate(FromOtherThread);
+        TEST_EQUAL("ThreadCache-CrossThreadFree", SizeType(1), PoolType::GetCachedCount())
+        PoolType::Trim();
+    }
+}
+
+#endif
@@ -0,0 +1,207 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_SoAContainerTests_h
+#define Mezz_Foundation_SoAContainerTests_h
+
+/// @file
+/// @brief This file tests the functionality of the SoAContainer class.
+
+#include "MezzTest.h"
+
+#include "MezzException.h"
+#include "SoAContainer.h"
+
+namespace SoAContainerTest
+{
+    using Mezzanine::UInt32;
+    using Mezzanine::String;
+
+    struct Particle
+    {
+        float X = 0.0f;
+        float Y = 0.0f;
+        UInt32 ID = 0;
+        bool Alive = true;
+        String Tag;
+
+        void SetTag(const String& NewTag)
+            { this->Tag = NewTag; }
+        const String& GetTag() const
+            { return this->Tag; }
+
+        static auto RegisterMembers()
+        {
+            using namespace Mezzanine;
+            using SelfType = Particle;
+
+            return Members(
+                MakeMemberAccessor("X",&SelfType::X),
+                MakeMemberAccessor("Y",&SelfType::Y),
+                MakeMemberAccessor("ID",&SelfType::ID),
+                MakeMemberAccessor("Alive",&SelfType::Alive),
+                MakeMemberAccessor("Tag",&SelfType::SetTag,&SelfType::GetTag)
+            );
+        }
+    };
+}
+
+AUTOMATIC_TEST_GROUP(SoAContainerTests,SoAContainer)
+{
+    using namespace Mezzanine;
+    using namespace SoAContainerTest;
+    using ContainerType = SoAContainer<Particle>;
+
+    {// Layout
+        static_assert( ContainerType::MemberCount == 5, "Supposed to Pass." );
+        static_assert( std::is_same_v<ContainerType::MemberTypeAt<2>,UInt32>, "Supposed to Pass." );
+        static_assert( std::is_same_v<ContainerType::MemberTypeAt<3>,bool>, "Supposed to Pass." );
+    }// Layout
+
+    {// Rows
+        ContainerType Particles;
+        TEST_EQUAL("SoAContainer()-Empty",
+                   true,Particles.empty())
+
+        for( UInt32 Idx = 0 ; Idx < 20 ; ++Idx )
+        {
+            Particle Current;
+            Current.X = static_cast<float>(Idx);
+            Current.Y = static_cast<float>(Idx) * 2.0f;
+            Current.ID = Idx + 100;
+            Current.Alive = ( Idx % 3 != 0 );
+            Current.Tag = "P" + std::to_string(Idx);
+            Particles.push_back(Current);
+        }
+        TEST_EQUAL("push_back(const_Class&)-Size",
+                   SizeType(20),Particles.size())
+        TEST_EQUAL("push_back(const_Class&)-Capacity",
+                   true,Particles.capacity() >= 20)
+
+        Particle Loaded = Particles.Load(7);
+        TEST_EQUAL("Load(const_SizeType)_const-X",
+                   7.0f,Loaded.X)
+        TEST_EQUAL("Load(const_SizeType)_const-ID",
+                   UInt32(107),Loaded.ID)
+        TEST_EQUAL("Load(const_SizeType)_const-Tag",
+                   String("P7"),Loaded.Tag)
+
+        auto Row = Particles[4];
+        TEST_EQUAL("SoARow::Get()_const",
+                   8.0f,Row.Get<1>())
+        TEST_EQUAL("GetMemberValue(SoARow<Class>&,const_StringView)",
+                   UInt32(104),GetMemberValue<UInt32>(Row,"ID"))
+        TEST_EQUAL("GetMemberValue(const_SoARow<Class>&,const_StringView)",
+                   String("P5"),GetMemberValue<String>(Particles[5],"Tag"))
+        TEST_EQUAL("GetMemberValue(SoARow<Class>&,const_StringView)-WrongType",
+                   0.0f,GetMemberValue<float>(Row,"ID"))
+        SetMemberValue<UInt32>(Row,"ID",999u);
+        SetMemberValue<String>(Particles[4],"Tag",String("Renamed"));
+        TEST_EQUAL("SetMemberValue(SoARow<Class>&,const_StringView,ValueType&&)",
+                   UInt32(999),Particles.GetElement<2>(4))
+        TEST_EQUAL("SetMemberValue(const_SoARow<Class>&,const_StringView,ValueType&&)",
+                   String("Renamed"),Particles.GetElement<4>(4))
+
+        auto NewRow = Particles.emplace_back();
+        TEST_EQUAL("emplace_back()-Index",
+                   SizeType(20),NewRow.GetIndex())
+        TEST_EQUAL("emplace_back()-DefaultConstructed",
+                   true,NewRow.Get<3>())
+        Particles.pop_back();
+        TEST_EQUAL("pop_back()",
+                   SizeType(20),Particles.size())
+
+        TEST_THROW("at(const_SizeType)-Throw",
+                   Mezzanine::Exception::OutOfRange,
+                   [&Particles](){ Particles.at(20); })
+
+        ContainerType Copy(Particles);
+        Particles.clear();
+        TEST_EQUAL("clear()",
+                   SizeType(0),Particles.size())
+        TEST_EQUAL("SoAContainer(const_SoAContainer&)-Size",
+                   SizeType(20),Copy.size())
+        TEST_EQUAL("SoAContainer(const_SoAContainer&)-Element",
+                   String("P19"),Copy.GetElement<4>(19))
+
+        Copy.resize(25);
+        TEST_EQUAL("resize(const_SizeType)-Grow",
+                   0.0f,Copy.GetElement<0>(24))
+        Copy.resize(10);
+        TEST_EQUAL("resize(const_SizeType)-Shrink",
+                   SizeType(10),Copy.size())
+    }// Rows
+
+    {// Columns
+        ContainerType Particles;
+        Particles.resize(1000);
+        auto XColumn = Particles.GetColumn<0>();
+        auto YColumn = Particles.GetColumn<1>();
+        for( SizeType Idx = 0 ; Idx < XColumn.size() ; ++Idx )
+        {
+            XColumn[Idx] = static_cast<float>(Idx);
+        }
+        for( SizeType Idx = 0 ; Idx < YColumn.size() ; ++Idx )
+        {
+            YColumn[Idx] = XColumn[Idx] * 0.5f;
+        }
+        TEST_EQUAL("GetColumn()-Size",
+                   SizeType(1000),XColumn.size())
+        TEST_EQUAL("GetColumn()-Contiguous",
+                   XColumn.data() + 999,&Particles.GetElement<0>(999))
+        TEST_EQUAL("GetColumn()-Write",
+                   250.0f,GetMemberValue<float>(Particles[500],"Y"))
+
+        float Sum = 0.0f;
+        for( const float Current : Particles.GetColumn<float>("Y") )
+            { Sum += Current; }
+        TEST_EQUAL("GetColumn(const_StringView)",
+                   249750.0f,Sum)
+        TEST_EQUAL("GetColumn(const_StringView)-WrongType",
+                   true,Particles.GetColumn<UInt32>("Y").empty())
+        TEST_EQUAL("GetColumn(const_StringView)-Missing",
+                   true,Particles.GetColumn<float>("Z").empty())
+
+        const ContainerType& ConstParticles = Particles;
+        TEST_EQUAL("GetColumn()_const",
+                   true,ConstParticles.GetColumn<3>()[10])
+    }// Columns
+}
+
+#endif
@@ -47,6 +47,9 @@
 
 #include "StaticAny.h"
 
+#include <array>
+#include <stdexcept>
+
 DEFAULT_TEST_GROUP(StaticAnyTests,StaticAny)
 {
     using namespace Mezzanine;
@@ -131,6 +134,172 @@ DEFAULT_TEST_GROUP(StaticAnyTests,StaticAny)
                     1, StringPtr.use_count() )
     }// Simple Construct / Destruct
 
+    {// Trivial Fast Paths
+        using AnyType = StaticAny<32,alignof(std::shared_ptr<String>)>;
+
+        AnyType TrivialSource( double(6.25) );
+        AnyType TrivialCopy( TrivialSource );
+        TEST_EQUAL_EPSILON( "StaticAny(const_StaticAny&)-Trivial",
+                            double(6.25), StaticAnyCast<double>(TrivialCopy) )
+        AnyType TrivialMove( std::move(TrivialSource) );
+        TEST_EQUAL_EPSILON( "StaticAny(StaticAny&&)-Dest-Trivial",
+                            double(6.25), StaticAnyCast<double>(TrivialMove) )
+        TEST_EQUAL( "StaticAny(StaticAny&&)-Source-Trivial",
+                    true, TrivialSource.empty() )
+
+        AnyType EmptySource;
+        AnyType EmptyCopy( EmptySource );
+        TEST_EQUAL( "StaticAny(const_StaticAny&)-Empty",
+                    true, EmptyCopy.empty() )
+        TrivialCopy = EmptySource;
+        TEST_EQUAL( "operator=(const_StaticAny&)-Empty",
+                    true, TrivialCopy.empty() )
+
+        std::shared_ptr<String> StringPtr = std::make_shared<String>("Moved");
+        AnyType MoveSource( StringPtr );
+        AnyType MoveDest( std::move(MoveSource) );
+        TEST_EQUAL( "StaticAny(StaticAny&&)-Source-NonTrivial",
+                    true, MoveSource.empty() )
+        TEST_EQUAL( "StaticAny(StaticAny&&)-UseCount-NonTrivial",
+                    2, StringPtr.use_count() )
+        MoveDest.clear();
+        TEST_EQUAL( "clear()-UseCount-NonTrivial",
+                    1, StringPtr.use_count() )
+    }// Trivial Fast Paths
+
+    {// Visit
+        using AnyType = StaticAny<40>;
+
+        AnyType IntAny( int(42) );
+        int IntResult = 0;
+        Boole IntVisited = IntAny.visit<int,String,double>( [&IntResult](auto& Element) {
+            if constexpr( std::is_same_v<std::decay_t<decltype(Element)>,int> ) {
+                IntResult = Element;
+                Element = 84;
+            }
+        } );
+        TEST_EQUAL( "visit<ElementTypes...>(VisitorType&&)-Int-Visited",
+                    true, IntVisited )
+        TEST_EQUAL( "visit<ElementTypes...>(VisitorType&&)-Int-Value",
+                    int(42), IntResult )
+        TEST_EQUAL( "visit<ElementTypes...>(VisitorType&&)-Int-Mutated",
+                    int(84), StaticAnyCast<int>(IntAny) )
+
+        const AnyType StringAny( String("Visited") );
+        String StringResult;
+        Boole StringVisited = StringAny.visit<int,String,double>( [&StringResult](const auto& Element) {
+            if constexpr( std::is_same_v<std::decay_t<decltype(Element)>,String> ) {
+                StringResult = Element;
+            }
+        } );
+        TEST_EQUAL( "visit<ElementTypes...>(VisitorType&&)_const-String-Visited",
+                    true, StringVisited )
+        TEST_EQUAL( "visit<ElementTypes...>(VisitorType&&)_const-String-Value",
+                    String("Visited"), StringResult )
+
+        AnyType CharAny( char('x') );
+        Boole CharVisited = CharAny.visit<int,String,double>( [](auto&) {  } );
+        TEST_EQUAL( "visit<ElementTypes...>(VisitorType&&)-Unlisted",
+                    false, CharVisited )
+
+        AnyType EmptyAny;
+        Boole EmptyVisited = EmptyAny.visit<int,String,double>( [](auto&) {  } );
+        TEST_EQUAL( "visit<ElementTypes...>(VisitorType&&)-Empty",
+                    false, EmptyVisited )
+    }// Visit
+
+    {// SmallAny Heap Spill
+        using SmallAnyType = SmallAny<16>;
+        using LargerSmallAnyType = SmallAny<128>;
+        using LargeElementType = std::array<std::shared_ptr<String>,8>;
+        struct ThrowingElement
+        {
+            char Padding[64];
+            ThrowingElement()
+                { throw std::runtime_error("Construction failed."); }
+        };
+
+        static_assert( SmallAnyType::can_spill(), "Supposed to Pass." );
+        static_assert( !StaticAny<16>::can_spill(), "Supposed to Fail." );
+        static_assert( is_static_any_v<SmallAnyType>, "Supposed to Pass." );
+        static_assert( sizeof(SmallAnyType) < sizeof(StaticAny<sizeof(LargeElementType)>), "Supposed to Pass." );
+        static_assert( std::is_constructible_v<SmallAnyType,const StaticAny<64>&>, "Supposed to Pass." );
+        static_assert( !std::is_constructible_v<StaticAny<128>,const SmallAnyType&>, "Supposed to Fail." );
+
+        SmallAnyType InlineAny( Integer(99) );
+        TEST_EQUAL( "SmallAny(ElementType&&)-Inline",
+                    true, InlineAny.is_inline() )
+        TEST_EQUAL( "SmallAny(ElementType&&)-Inline-Value",
+                    Integer(99), StaticAnyCast<Integer>(InlineAny) )
+
+        std::shared_ptr<String> StringPtr = std::make_shared<String>("Spilled");
+        LargeElementType LargeElement;
+        LargeElement.fill(StringPtr);
+        SmallAnyType SpilledAny( LargeElement );
+        TEST_EQUAL( "SmallAny(ElementType&&)-Spilled",
+                    false, SpilledAny.is_inline() )
+        TEST_EQUAL( "SmallAny(ElementType&&)-Spilled-Size",
+                    sizeof(LargeElementType), SpilledAny.size() )
+        TEST_EQUAL( "SmallAny(ElementType&&)-Spilled-Value",
+                    String("Spilled"), *StaticAnyCast<LargeElementType>(SpilledAny)[7] )
+        TEST_EQUAL( "SmallAny(ElementType&&)-Spilled-UseCount",
+                    long(17), StringPtr.use_count() )
+
+        SmallAnyType SpilledCopy( SpilledAny );
+        TEST_EQUAL( "SmallAny(const_SmallAny&)-Spilled",
+                    false, SpilledCopy.is_inline() )
+        TEST_EQUAL( "SmallAny(const_SmallAny&)-Spilled-Distinct",
+                    false, StaticAnyCast<LargeElementType>(&SpilledCopy) ==
+                           StaticAnyCast<LargeElementType>(&SpilledAny) )
+        TEST_EQUAL( "SmallAny(const_SmallAny&)-Spilled-UseCount",
+                    long(25), StringPtr.use_count() )
+
+        const LargeElementType* SpilledAddress = StaticAnyCast<LargeElementType>(&SpilledCopy);
+        SmallAnyType SpilledMove( std::move(SpilledCopy) );
+        TEST_EQUAL( "SmallAny(SmallAny&&)-Spilled-Source",
+                    true, SpilledCopy.empty() )
+        TEST_EQUAL( "SmallAny(SmallAny&&)-Spilled-Stolen",
+                    true, StaticAnyCast<LargeElementType>(&SpilledMove) == SpilledAddress )
+        TEST_EQUAL( "SmallAny(SmallAny&&)-Spilled-UseCount",
+                    long(25), StringPtr.use_count() )
+
+        LargerSmallAnyType LargerAny( std::move(SpilledMove) );
+        TEST_EQUAL( "SmallAny(SmallAny<size_t>&&)-Unspilled",
+                    true, LargerAny.is_inline() )
+        TEST_EQUAL( "SmallAny(SmallAny<size_t>&&)-Unspilled-Value",
+                    String("Spilled"), *StaticAnyCast<LargeElementType>(LargerAny)[0] )
+        TEST_EQUAL( "SmallAny(SmallAny<size_t>&&)-Unspilled-UseCount",
+                    long(25), StringPtr.use_count() )
+
+        SmallAnyType RespilledAny( LargerAny );
+        TEST_EQUAL( "SmallAny(const_SmallAny<size_t>&)-Respilled",
+                    false, RespilledAny.is_inline() )
+        TEST_EQUAL( "SmallAny(const_SmallAny<size_t>&)-Respilled-UseCount",
+                    long(33), StringPtr.use_count() )
+
+        StaticAny<sizeof(Integer)> StaticSource( Integer(5) );
+        SmallAnyType FromStaticAny( StaticSource );
+        TEST_EQUAL( "SmallAny(const_StaticAny<size_t>&)",
+                    Integer(5), StaticAnyCast<Integer>(FromStaticAny) )
+
+        Boole Visited = RespilledAny.visit<Integer,LargeElementType>( [](auto&) {  } );
+        TEST_EQUAL( "visit<ElementTypes...>(VisitorType&&)-Spilled",
+                    true, Visited )
+
+        SpilledAny = Integer(1);
+        LargerAny.clear();
+        RespilledAny.clear();
+        TEST_EQUAL( "clear()-Spilled-UseCount",
+                    long(9), StringPtr.use_count() )
+
+        SmallAnyType ThrowingAny( Integer(3) );
+        TEST_THROW( "emplace(ArgTypes&&...)-Spilled-Throws",
+                    std::runtime_error,
+                    [&ThrowingAny](){ ThrowingAny.emplace<ThrowingElement>(); } )
+        TEST_EQUAL( "emplace(ArgTypes&&...)-Spilled-Throws-Empty",
+                    true, ThrowingAny.empty() )
+    }// SmallAny Heap Spill
+
     {// Integer
         using AnyType = StaticAny<sizeof(unsigned),alignof(unsigned)>;
         using SmallerAnyType = StaticAny<sizeof(short),alignof(short)>;
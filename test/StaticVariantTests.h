@@ -0,0 +1,276 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_StaticVariantTests_h
+#define Mezz_Foundation_StaticVariantTests_h
+
+/// @file
+/// @brief This file tests the functionality of the StaticVariant class.
+
+#include "MezzTest.h"
+
+#include "StaticVariant.h"
+
+DEFAULT_TEST_GROUP(StaticVariantTests,StaticVariant)
+{
+    using namespace Mezzanine;
+    using VariantType = StaticVariant<Integer,Real,String>;
+
+    {// Traits
+        static_assert( is_static_variant_v<VariantType>, "Supposed to Pass." );
+        static_assert( !is_static_variant_v<int>, "Supposed to Fail." );
+        static_assert( std::is_same_v<VariantType::IndexType,UInt8>, "Supposed to Pass." );
+        static_assert( VariantType::index_of<Integer>() == 0, "Supposed to Pass." );
+        static_assert( VariantType::index_of<String>() == 2, "Supposed to Pass." );
+        static_assert( VariantType::is_alternative<Real>(), "Supposed to Pass." );
+        static_assert( !VariantType::is_alternative<char>(), "Supposed to Fail." );
+
+        TEST_EQUAL( "type_count()",
+                    size_t(3), VariantType::type_count() )
+        TEST_EQUAL( "capacity()",
+                    sizeof(String), VariantType::capacity() )
+        TEST_EQUAL( "align()",
+                    alignof(String), VariantType::align() )
+        TEST_EQUAL( "sizeof(StaticVariant)",
+                    true, sizeof(VariantType) <= sizeof(String) + alignof(String) )
+    }// Traits
+
+    {// Construction and Assignment
+        VariantType EmptyVariant;
+        TEST_EQUAL( "StaticVariant()-Empty",
+                    true, EmptyVariant.empty() )
+        TEST_EQUAL( "StaticVariant()-Index",
+                    VariantType::npos, EmptyVariant.index() )
+        TEST_EQUAL( "StaticVariant()-Type",
+                    typeid(void).hash_code(), EmptyVariant.get_type().hash_code() )
+
+        VariantType IntVariant( Integer(42) );
+        TEST_EQUAL( "StaticVariant(ElementType&&)-Integer-Index",
+                    VariantType::index_of<Integer>(), IntVariant.index() )
+        TEST_EQUAL( "StaticVariant(ElementType&&)-Integer-Value",
+                    Integer(42), StaticAnyCast<Integer>(IntVariant) )
+        TEST_EQUAL( "StaticVariant(ElementType&&)-Integer-Size",
+                    sizeof(Integer), IntVariant.size() )
+
+        VariantType StringSource( String("Variant") );
+        VariantType StringCopy( StringSource );
+        TEST_EQUAL( "StaticVariant(const_StaticVariant&)-Source",
+                    String("Variant"), StaticAnyCast<String>(StringSource) )
+        TEST_EQUAL( "StaticVariant(const_StaticVariant&)-Dest",
+                    String("Variant"), StaticAnyCast<String>(StringCopy) )
+
+        VariantType StringMove( std::move(StringSource) );
+        TEST_EQUAL( "StaticVariant(StaticVariant&&)-Source",
+                    true, StringSource.empty() )
+        TEST_EQUAL( "StaticVariant(StaticVariant&&)-Dest",
+                    String("Variant"), StaticAnyCast<String>(StringMove) )
+
+        VariantType AssignDest;
+        AssignDest = StringMove;
+        TEST_EQUAL( "operator=(const_StaticVariant&)",
+                    String("Variant"), StaticAnyCast<String>(AssignDest) )
+        AssignDest = Real(2.5);
+        TEST_EQUAL( "operator=(ElementType&&)-Index",
+                    VariantType::index_of<Real>(), AssignDest.index() )
+        TEST_EQUAL_EPSILON( "operator=(ElementType&&)-Value",
+                            Real(2.5), StaticAnyCast<Real>(AssignDest) )
+        AssignDest = std::move(StringMove);
+        TEST_EQUAL( "operator=(StaticVariant&&)-Dest",
+                    String("Variant"), StaticAnyCast<String>(AssignDest) )
+        TEST_EQUAL( "operator=(StaticVariant&&)-Source",
+                    true, StringMove.empty() )
+
+        AssignDest = StaticAnyCast<String>(AssignDest);
+        TEST_EQUAL( "operator=(ElementType&&)-SelfElement",
+                    String("Variant"), StaticAnyCast<String>(AssignDest) )
+        AssignDest = std::move( StaticAnyCast<String>(AssignDest) );
+        TEST_EQUAL( "operator=(ElementType&&)-SelfElementMoved",
+                    String("Variant"), StaticAnyCast<String>(AssignDest) )
+        const VariantType& SelfRef = AssignDest;
+        AssignDest = SelfRef;
+        TEST_EQUAL( "operator=(const_StaticVariant&)-Self",
+                    String("Variant"), StaticAnyCast<String>(AssignDest) )
+
+        AssignDest.emplace<String>(size_t(3),'z');
+        TEST_EQUAL( "emplace(ArgTypes&&...)",
+                    String("zzz"), StaticAnyCast<String>(AssignDest) )
+        TEST_EQUAL( "holds_alternative()-Pass",
+                    true, AssignDest.holds_alternative<String>() )
+        TEST_EQUAL( "holds_alternative()-Fail",
+                    false, AssignDest.holds_alternative<Integer>() )
+        TEST_EQUAL( "holds_alternative()-NotListed",
+                    false, AssignDest.holds_alternative<char>() )
+        TEST_EQUAL( "get_type()",
+                    typeid(String).hash_code(), AssignDest.get_type().hash_code() )
+
+        AssignDest.clear();
+        TEST_EQUAL( "clear()",
+                    true, AssignDest.empty() )
+    }// Construction and Assignment
+
+    {// Lifetime
+        using SharedVariantType = StaticVariant<Integer,std::shared_ptr<String>>;
+
+        std::shared_ptr<String> StringPtr = std::make_shared<String>("Shared");
+        SharedVariantType FirstVariant( StringPtr );
+        TEST_EQUAL( "StaticVariant(ElementType&&)-UseCount",
+                    2, StringPtr.use_count() )
+        SharedVariantType SecondVariant( FirstVariant );
+        TEST_EQUAL( "StaticVariant(const_StaticVariant&)-UseCount",
+                    3, StringPtr.use_count() )
+        SecondVariant = Integer(1);
+        TEST_EQUAL( "operator=(ElementType&&)-UseCount",
+                    2, StringPtr.use_count() )
+        FirstVariant.clear();
+        TEST_EQUAL( "clear()-UseCount",
+                    1, StringPtr.use_count() )
+    }// Lifetime
+
+    {// Casting
+        VariantType RealVariant( Real(1.25) );
+        const VariantType ConstStringVariant( String("Const") );
+
+        TEST_EQUAL_EPSILON( "StaticAnyCast<Real>(StaticVariant<>)-Ptr-Pass",
+                            Real(1.25), *StaticAnyCast<Real>(&RealVariant) )
+        TEST_EQUAL( "StaticAnyCast<String>(StaticVariant<>)-ConstRef-Pass",
+                    String("Const"), StaticAnyCast<String>(ConstStringVariant) )
+        TEST_EQUAL( "StaticAnyCast<String>(StaticVariant<>)-ConstPtr-Pass",
+                    String("Const"), *StaticAnyCast<String>(&ConstStringVariant) )
+        TEST_THROW( "StaticAnyCast<Integer>(StaticVariant<>)-Ref-Fail",
+                    Mezzanine::Exception::BadCast,
+                    [&RealVariant](){ StaticAnyCast<Integer>(RealVariant); } )
+        TEST_THROW( "StaticAnyCast<Integer>(StaticVariant<>)-ConstRef-Fail",
+                    Mezzanine::Exception::BadCast,
+                    [&ConstStringVariant](){ StaticAnyCast<Integer>(ConstStringVariant); } )
+        TEST_THROW( "StaticAnyCast<double>(StaticVariant<>)-Ptr-Fail",
+                    Mezzanine::Exception::BadCast,
+                    [&RealVariant](){ StaticAnyCast<double>(&RealVariant); } )
+    }// Casting
+
+    {// Visit
+        VariantType IntVariant( Integer(7) );
+        Integer Doubled = IntVariant.visit( [](auto& Element) -> Integer {
+            using ElementType = std::decay_t<decltype(Element)>;
+            if constexpr( std::is_same_v<ElementType,Integer> ) {
+                Element *= 2;
+                return Element;
+            }else{
+                return -1;
+            }
+        } );
+        TEST_EQUAL( "visit(VisitorType&&)-Result",
+                    Integer(14), Doubled )
+        TEST_EQUAL( "visit(VisitorType&&)-Mutated",
+                    Integer(14), StaticAnyCast<Integer>(IntVariant) )
+
+        const VariantType StringVariant( String("Visit") );
+        size_t VisitedSize = StringVariant.visit( [](const auto& Element) -> size_t {
+            using ElementType = std::decay_t<decltype(Element)>;
+            if constexpr( std::is_same_v<ElementType,String> ) {
+                return Element.size();
+            }else{
+                return 0;
+            }
+        } );
+        TEST_EQUAL( "visit(VisitorType&&)_const-Result",
+                    size_t(5), VisitedSize )
+
+        VariantType EmptyVariant;
+        TEST_THROW( "visit(VisitorType&&)-Empty",
+                    Mezzanine::Exception::BadCast,
+                    [&EmptyVariant](){ EmptyVariant.visit( [](auto&) {  } ); } )
+
+        std::vector<VariantType> Mixed;
+        Mixed.emplace_back( Integer(1) );
+        Mixed.emplace_back( Real(2.0) );
+        Mixed.emplace_back( String("abc") );
+        Mixed.emplace_back( Integer(4) );
+        Real Total = 0.0;
+        for( const VariantType& Current : Mixed )
+        {
+            switch( Current.index() )
+            {
+                case VariantType::index_of<Integer>():
+                    Total += static_cast<Real>( StaticAnyCast<Integer>(Current) );
+                    break;
+                case VariantType::index_of<Real>():
+                    Total += StaticAnyCast<Real>(Current);
+                    break;
+                case VariantType::index_of<String>():
+                    Total += static_cast<Real>( StaticAnyCast<String>(Current).size() );
+                    break;
+                default:
+                    break;
+            }
+        }
+        TEST_EQUAL_EPSILON( "index()-SwitchDispatch",
+                            Real(10.0), Total )
+    }// Visit
+
+    {// Over-aligned Types
+        struct alignas(64) CacheLine
+            { Integer Value; };
+        using AlignedVariant = StaticVariant<Integer,CacheLine>;
+
+        TEST_EQUAL( "align()-OverAligned",
+                    size_t(64), AlignedVariant::align() )
+        TEST_EQUAL( "alignof(StaticVariant)-OverAligned",
+                    size_t(64), alignof(AlignedVariant) )
+
+        AlignedVariant OnStack( CacheLine{ 7 } );
+        TEST_EQUAL( "StaticVariant(ElementType&&)-OverAlignedStack",
+                    true, reinterpret_cast<std::uintptr_t>( &StaticAnyCast<CacheLine>(OnStack) ) % 64 == 0 )
+        TEST_EQUAL( "StaticVariant(ElementType&&)-OverAlignedValue",
+                    Integer(7), StaticAnyCast<CacheLine>(OnStack).Value )
+
+        std::vector<AlignedVariant> OnHeap;
+        OnHeap.emplace_back( Integer(1) );
+        OnHeap.emplace_back( CacheLine{ 2 } );
+        OnHeap.emplace_back( CacheLine{ 3 } );
+        Boole AllAligned = true;
+        for( AlignedVariant& Current : OnHeap )
+            { AllAligned = AllAligned && reinterpret_cast<std::uintptr_t>( &Current ) % 64 == 0; }
+        TEST_EQUAL( "StaticVariant(ElementType&&)-OverAlignedHeap",
+                    true, AllAligned )
+        TEST_EQUAL( "StaticVariant(ElementType&&)-OverAlignedHeapValue",
+                    Integer(3), StaticAnyCast<CacheLine>(OnHeap.back()).Value )
+    }// Over-aligned Types
+}
+
+#endif // Mezz_Foundation_StaticVariantTests_h
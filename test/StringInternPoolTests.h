@@ -0,0 +1,153 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_StringInternPoolTests_h
+#define Mezz_Foundation_StringInternPoolTests_h
+
+/// @file
+/// @brief This file tests the functionality of the string interning pool.
+
+#include "MezzTest.h"
+#include "RuntimeStatics.h"
+
+#include "MurmurHash.h"
+#include "StringInternPool.h"
+
+#include <thread>
+#include <vector>
+
+AUTOMATIC_TEST_GROUP(StringInternPoolTests,StringInternPool)
+{
+    using namespace Mezzanine;
+    using Entry = StringInternPool::Entry;
+
+    auto HashOf = [](const StringView Text) {
+        return Hashing::MurmurHash3_x86_32(Text.data(),Text.size(),1);
+    };
+
+    {// Interning
+        StringInternPool Pool(4);
+        const String Name = "ObjectName";
+        const Entry& First = Pool.Intern(Name,HashOf(Name));
+        const Entry& Second = Pool.Intern(String("Object") + "Name",HashOf(Name));
+        TEST_EQUAL("Intern(const_StringView,const_UInt32)-Text",
+                   Name,First.Text)
+        TEST_EQUAL("Intern(const_StringView,const_UInt32)-Hash",
+                   HashOf(Name),First.Hash)
+        TEST_EQUAL("Intern(const_StringView,const_UInt32)-Canonical",
+                   &First,&Second)
+        TEST_EQUAL("Intern(const_StringView,const_UInt32)-Empty",
+                   String(),Pool.Intern(StringView(),HashOf(StringView())).Text)
+        TEST_EQUAL("GetCount()_const",
+                   SizeType(2),Pool.GetCount())
+
+        // Different strings that share a hash must stay distinct.
+        const Entry& Collided = Pool.Intern("Impostor",First.Hash);
+        TEST_EQUAL("Intern(const_StringView,const_UInt32)-Collision",
+                   true,&Collided != &First)
+        TEST_EQUAL("Intern(const_StringView,const_UInt32)-CollisionText",
+                   String("Impostor"),Collided.Text)
+        TEST_EQUAL("Find(const_StringView,const_UInt32)_const-Collision",
+                   &First,Pool.Find(Name,First.Hash))
+
+        TEST_EQUAL("Find(const_StringView,const_UInt32)_const-Missing",
+                   static_cast<const Entry*>(nullptr),Pool.Find("Missing",HashOf("Missing")))
+        TEST_EQUAL("Find(const_StringView,const_UInt32)_const-WrongHash",
+                   static_cast<const Entry*>(nullptr),Pool.Find(Name,First.Hash + 1))
+    }// Interning
+
+    {// Growth
+        StringInternPool Pool(4);
+        const SizeType InitialCapacity = Pool.GetCapacity();
+        const Entry& Anchor = Pool.Intern("Anchor",HashOf("Anchor"));
+        const String* AnchorText = &(Anchor.Text);
+        for( SizeType Idx = 0 ; Idx < 1000 ; ++Idx )
+        {
+            const String Text = "Name" + std::to_string(Idx);
+            Pool.Intern(Text,HashOf(Text));
+        }
+        TEST_EQUAL("GetCapacity()_const-Grown",
+                   true,Pool.GetCapacity() > InitialCapacity)
+        TEST_EQUAL("GetCount()_const-Grown",
+                   SizeType(1001),Pool.GetCount())
+        TEST_EQUAL("Find(const_StringView,const_UInt32)_const-Stable",
+                   AnchorText,&(Pool.Find("Anchor",HashOf("Anchor"))->Text))
+        TEST_EQUAL("Find(const_StringView,const_UInt32)_const-AfterGrowth",
+                   String("Name999"),Pool.Find("Name999",HashOf("Name999"))->Text)
+    }// Growth
+
+    // Emscripten builds are run without thread support.
+    if(Mezzanine::RuntimeStatic::CompilerIsEmscripten())
+        { return; }
+
+    {// Threading
+        StringInternPool Pool(4);
+        const SizeType ThreadCount = 4;
+        // A prime, so every stride visits every name.
+        const SizeType NameCount = 2003;
+        std::vector< std::vector<const Entry*> > Results(ThreadCount);
+        std::vector<std::thread> Workers;
+        for( SizeType ThreadIdx = 0 ; ThreadIdx < ThreadCount ; ++ThreadIdx )
+        {
+            Workers.emplace_back([&,ThreadIdx](){
+                // Every thread interns the same names in a different order.
+                std::vector<const Entry*>& Found = Results[ThreadIdx];
+                Found.resize(NameCount);
+                for( SizeType Step = 0 ; Step < NameCount ; ++Step )
+                {
+                    const SizeType NameIdx = ( Step * ( ThreadIdx * 2 + 1 ) ) % NameCount;
+                    const String Text = "Shared" + std::to_string(NameIdx);
+                    Found[NameIdx] = &Pool.Intern(Text,HashOf(Text));
+                }
+            });
+        }
+        for( std::thread& Worker : Workers )
+            { Worker.join(); }
+
+        SizeType Mismatches = 0;
+        for( SizeType ThreadIdx = 1 ; ThreadIdx < ThreadCount ; ++ThreadIdx )
+            { Mismatches += ( Results[ThreadIdx] != Results[0] ); }
+        TEST_EQUAL("Intern(const_StringView,const_UInt32)-Threaded-Canonical",
+                   SizeType(0),Mismatches)
+        TEST_EQUAL("Intern(const_StringView,const_UInt32)-Threaded-Count",
+                   NameCount,Pool.GetCount())
+    }// Threading
+}
+
+#endif
@@ -345,6 +345,33 @@ DEFAULT_TEST_GROUP(StringToolsTests,StringTools)
         TEST_EQUAL("ConvertFromString(const_StringView)-UInt32",
                    UInt32(3872423),StringTools::ConvertFromString<UInt32>("3872423"))
 
+        Real ParsedReal = 0;
+        TEST_EQUAL("ConvertFromChars(const_StringView,NumberType&)-Real",
+                   true,StringTools::ConvertFromChars("-2.5e3",ParsedReal))
+        TEST_EQUAL("ConvertFromChars(const_StringView,NumberType&)-RealValue",
+                   Real(-2500),ParsedReal)
+        PreciseReal ParsedPrecise = 0;
+        TEST_EQUAL("ConvertFromChars(const_StringView,NumberType&)-PreciseReal",
+                   true,StringTools::ConvertFromChars("0.1",ParsedPrecise))
+        TEST_EQUAL("ConvertFromChars(const_StringView,NumberType&)-PreciseRealValue",
+                   PreciseReal(0.1),ParsedPrecise)
+        Int32 ParsedInt = 5;
+        UInt8 ParsedByte = 0;
+        TEST_EQUAL("ConvertFromChars(const_StringView,NumberType&)-Int32",
+                   true,StringTools::ConvertFromChars("-1256844",ParsedInt))
+        TEST_EQUAL("ConvertFromChars(const_StringView,NumberType&)-Int32Value",
+                   Int32(-1256844),ParsedInt)
+        TEST_EQUAL("ConvertFromChars(const_StringView,NumberType&)-TrailingText-Fail",
+                   false,StringTools::ConvertFromChars("1.5x",ParsedReal))
+        TEST_EQUAL("ConvertFromChars(const_StringView,NumberType&)-LeadingSpace-Fail",
+                   false,StringTools::ConvertFromChars(" 1.5",ParsedReal))
+        TEST_EQUAL("ConvertFromChars(const_StringView,NumberType&)-Empty-Fail",
+                   false,StringTools::ConvertFromChars("",ParsedInt))
+        TEST_EQUAL("ConvertFromChars(const_StringView,NumberType&)-OutOfRange-Fail",
+                   false,StringTools::ConvertFromChars("300",ParsedByte))
+        TEST_EQUAL("ConvertFromChars(const_StringView,NumberType&)-Fail-Untouched",
+                   Real(-2500),ParsedReal)
+
         TEST_EQUAL("ConvertToBool(const_StringView,const_Boole)-Yes",
                    true,StringTools::ConvertToBool("Yes",false))
         TEST_EQUAL("ConvertToBool(const_StringView,const_Boole)-No",
@@ -377,6 +404,38 @@ DEFAULT_TEST_GROUP(StringToolsTests,StringTools)
         TEST_EQUAL("ConvertToString(const_T&)-UInt16",String("27015"),StringTools::ConvertToString(UInt16(27015)))
         TEST_EQUAL("ConvertToString(const_T&)-Int32",String("-1256844"),StringTools::ConvertToString(Int32(-1256844)))
         TEST_EQUAL("ConvertToString(const_T&)-UInt32",String("3872423"),StringTools::ConvertToString(UInt32(3872423)))
+
+        char Chars[64];
+        const SizeType CharsSize = sizeof(Chars);
+        SizeType CharsLength = StringTools::ConvertToChars(Real(-2.5),Chars,CharsSize);
+        TEST_EQUAL("ConvertToChars(const_NumberType,char*,const_SizeType)-Real",
+                   String("-2.5"),String(Chars,CharsLength))
+        CharsLength = StringTools::ConvertToChars(PreciseReal(0.1),Chars,CharsSize);
+        TEST_EQUAL("ConvertToChars(const_NumberType,char*,const_SizeType)-PreciseReal",
+                   String("0.1"),String(Chars,CharsLength))
+        CharsLength = StringTools::ConvertToChars(Int32(-1256844),Chars,CharsSize);
+        TEST_EQUAL("ConvertToChars(const_NumberType,char*,const_SizeType)-Int32",
+                   String("-1256844"),String(Chars,CharsLength))
+        CharsLength = StringTools::ConvertToChars(UInt8(66),Chars,CharsSize);
+        TEST_EQUAL("ConvertToChars(const_NumberType,char*,const_SizeType)-UInt8",
+                   String("66"),String(Chars,CharsLength))
+
+        const Real Third = Real(1) / Real(3);
+        const PreciseReal PreciseThird = PreciseReal(1) / PreciseReal(3);
+        Real ThirdBack = 0;
+        PreciseReal PreciseThirdBack = 0;
+        CharsLength = StringTools::ConvertToChars(Third,Chars,CharsSize);
+        StringTools::ConvertFromChars(StringView(Chars,CharsLength),ThirdBack);
+        TEST_EQUAL("ConvertToChars(const_NumberType,char*,const_SizeType)-RealRoundTrip",
+                   Third,ThirdBack)
+        CharsLength = StringTools::ConvertToChars(PreciseThird,Chars,CharsSize);
+        StringTools::ConvertFromChars(StringView(Chars,CharsLength),PreciseThirdBack);
+        TEST_EQUAL("ConvertToChars(const_NumberType,char*,const_SizeType)-PreciseRealRoundTrip",
+                   PreciseThird,PreciseThirdBack)
+        TEST_EQUAL("ConvertToChars(const_NumberType,char*,const_SizeType)-TooSmall-Fail",
+                   SizeType(0),StringTools::ConvertToChars(Int32(-1256844),Chars,4))
+        TEST_EQUAL("ConvertToChars(const_NumberType,char*,const_SizeType)-RealTooSmall-Fail",
+                   SizeType(0),StringTools::ConvertToChars(Third,Chars,4))
     }//Convert-To-String Functions
 }
 
@@ -0,0 +1,156 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_XMLNodeBuilderBenchmarks_h
+#define Mezz_Foundation_XMLNodeBuilderBenchmarks_h
+
+/// @file
+/// @brief This contains benchmarks comparing direct node building against a text round trip.
+/// @details The round trip formats, parses and copies with the test node types and XMLPullReader from this
+/// library.  It is not the XML::Document path SloppyProtoSerialize uses, that DOM isn't part of this library,
+/// so these numbers only show the cost of going through text at all, not the cost of that particular DOM.
+
+#include "MezzTest.h"
+#include "TimingTools.h"
+#include "RuntimeStatics.h"
+
+#include "XMLNodeBuilder.h"
+#include "XMLNodeBuilderTests.h"
+#include "XMLPullReader.h"
+
+namespace XMLNodeBuilderTest
+{
+    /// @brief Streams a Prop as XML text, the way classes written for the older serialization do.
+    inline std::ostream& operator<<(std::ostream& Stream, const Prop& ToStream)
+    {
+        Stream << "<Prop Label=\"" << ToStream.Label << "\" Count=\"" << ToStream.Count
+               << "\" Mass=\"" << ToStream.Mass << "\" Visible=\"" << ( ToStream.Visible ? "true" : "false" )
+               << "\" Form=\"" << static_cast<Int32>(ToStream.Form) << "\">"
+               << "<Extent Width=\"" << ToStream.Extent.Width << "\" Height=\"" << ToStream.Extent.Height << "\"/>"
+               << "</Prop>";
+        return Stream;
+    }
+
+    /// @brief Parses XML text into a staging tree of test nodes.
+    inline void LoadStaging(std::istream& Stream, TestElement& Staging)
+    {
+        using Mezzanine::XMLPullReader;
+        XMLPullReader Reader(Stream);
+        std::vector<TestElement*> Open{ &Staging };
+        while( Reader.Next() != XMLPullReader::EventType::EndOfDocument )
+        {
+            if( Reader.GetEvent() == XMLPullReader::EventType::StartElement ) {
+                TestNode Parent{ Open.back() };
+                TestNode Child = Parent.AppendChild( String( Reader.GetName() ).c_str() );
+                for( Mezzanine::SizeType Idx = 0 ; Idx < Reader.GetAttributeCount() ; ++Idx )
+                {
+                    Child.AppendAttribute( String( Reader.GetAttributeName(Idx) ).c_str() )
+                         .SetValue( String( Reader.GetAttributeValue(Idx) ).c_str() );
+                }
+                Open.push_back(Child.Element);
+            }else if( Reader.GetEvent() == XMLPullReader::EventType::EndElement ) {
+                Open.pop_back();
+            }
+        }
+    }
+}
+
+BENCHMARK_TEST_GROUP(XMLNodeBuilderBenchmarks,XMLNodeBuilderBenchmarks)
+{
+    if(Mezzanine::RuntimeStatic::Debug())
+        { return; }
+
+    using namespace Mezzanine;
+    using namespace XMLNodeBuilderTest;
+
+    using Mezzanine::Testing::MicroBenchmark;
+    using Mezzanine::Testing::MicroBenchmarkResults;
+
+    const std::chrono::seconds TestTime(1);
+
+    Prop Source;
+    Source.Label = "Crate";
+    Source.Count = 12;
+    Source.Mass = 40.5;
+    Source.Visible = true;
+    Source.Form = Shape::Sphere;
+    Source.Extent = Bounds{2.5f,0.3f};
+
+    TestLog << "\n" << "XMLNodeBuilder Benchmarks" << "\n\n"
+            << "Appending one registered object to a tree of test nodes, first by streaming it to text, parsing "
+            << "the text with XMLPullReader into a staging tree and copying the result, then by building the node "
+            << "directly from the registered members.  The text round trip uses the test node types rather than "
+            << "an XML::Document, so it shows the cost of going through text, not of any particular DOM.\n\n";
+
+    TestElement RoundTripRoot;
+    auto RoundTrip = [&](){
+        RoundTripRoot.Children.clear();
+        std::stringstream Depot;
+        TestElement Staging;
+        Depot << Source;
+        LoadStaging(Depot,Staging);
+        RoundTripRoot.Children.push_back( Staging.Children.front() );
+    };
+    const MicroBenchmarkResults RoundTripResult = MicroBenchmark(TestTime,std::move(RoundTrip));
+    TestLog << "Text round trip appended a node "
+            << RoundTripResult.Iterations << " times in "
+            << Mezzanine::Testing::PrettyDurationString(RoundTripResult.WallTotal) << "\n";
+
+    TestElement DirectRoot;
+    auto Direct = [&](){
+        DirectRoot.Children.clear();
+        TestNode RootNode{ &DirectRoot };
+        BuildNode(RootNode,Source);
+    };
+    const MicroBenchmarkResults DirectResult = MicroBenchmark(TestTime,std::move(Direct));
+    TestLog << "Direct building appended a node "
+            << DirectResult.Iterations << " times in "
+            << Mezzanine::Testing::PrettyDurationString(DirectResult.WallTotal) << "\n";
+
+    const PreciseReal RoundTripPer = PreciseReal( RoundTripResult.WallTotal.count() ) / PreciseReal( RoundTripResult.Iterations );
+    const PreciseReal DirectPer = PreciseReal( DirectResult.WallTotal.count() ) / PreciseReal( DirectResult.Iterations );
+    const PreciseReal Percentage = ( DirectPer * 100.0 ) / RoundTripPer;
+    TestLog << "Building directly takes about " << Percentage << "% as long as the text round trip.\n\n";
+
+    TEST_EQUAL("BuildNode-SameAttributes",
+               RoundTripRoot.Children.front().Attributes.size(),DirectRoot.Children.front().Attributes.size())
+    TEST_PERF("DirectBuildIsFaster", Percentage < 100.0)
+}
+
+#endif
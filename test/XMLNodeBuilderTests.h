@@ -0,0 +1,231 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_XMLNodeBuilderTests_h
+#define Mezz_Foundation_XMLNodeBuilderTests_h
+
+/// @file
+/// @brief This file tests the functionality of building XML nodes from registered classes.
+
+#include "MezzTest.h"
+
+#include "XMLNodeBuilder.h"
+#include "XMLPullReader.h"
+
+#include <deque>
+#include <sstream>
+
+namespace XMLNodeBuilderTest
+{
+    using Mezzanine::Int32;
+    using Mezzanine::String;
+    using Mezzanine::StringView;
+
+    /// @brief A minimal element of an XML tree, standing in for XML::Node in tests and benchmarks.
+    struct TestElement
+    {
+        String Name;
+        std::deque< std::pair<String,String> > Attributes;
+        std::deque<TestElement> Children;
+    };
+
+    /// @brief A handle to an attribute of a TestElement.
+    struct TestAttribute
+    {
+        std::pair<String,String>* Attrib;
+
+        bool SetValue(const char* Value)
+        {
+            this->Attrib->second = Value;
+            return true;
+        }
+    };
+
+    /// @brief A handle to a TestElement with the node interface expected by BuildNode.
+    struct TestNode
+    {
+        TestElement* Element;
+
+        TestNode AppendChild(const char* Name)
+        {
+            this->Element->Children.push_back( TestElement{ Name, {}, {} } );
+            return TestNode{ &(this->Element->Children.back()) };
+        }
+        TestAttribute AppendAttribute(const char* Name)
+        {
+            this->Element->Attributes.emplace_back( Name, String() );
+            return TestAttribute{ &(this->Element->Attributes.back()) };
+        }
+    };
+
+    /// @brief Writes a TestElement as XML text.
+    inline void PrintElement(std::ostream& Stream, const TestElement& Element)
+    {
+        Stream << "<" << Element.Name;
+        for( const std::pair<String,String>& Attrib : Element.Attributes )
+        {
+            Stream << " " << Attrib.first << "=\"";
+            for( const char Current : Attrib.second )
+            {
+                switch( Current )
+                {
+                    case '"':  Stream << "&quot;";  break;
+                    case '&':  Stream << "&amp;";   break;
+                    case '<':  Stream << "&lt;";    break;
+                    default:   Stream << Current;   break;
+                }
+            }
+            Stream << "\"";
+        }
+        Stream << ">";
+        for( const TestElement& Child : Element.Children )
+            { PrintElement(Stream,Child); }
+        Stream << "</" << Element.Name << ">";
+    }
+
+    enum class Shape : Int32
+    {
+        Box = 1,
+        Sphere = 2
+    };
+
+    struct Bounds
+    {
+        float Width = 0.0f;
+        float Height = 0.0f;
+
+        static auto RegisterMembers()
+        {
+            using namespace Mezzanine;
+            using SelfType = Bounds;
+
+            return Members(
+                MakeMemberAccessor("Width",&SelfType::Width),
+                MakeMemberAccessor("Height",&SelfType::Height)
+            );
+        }
+    };
+
+    struct Prop
+    {
+        String Label;
+        Int32 Count = 0;
+        double Mass = 0.0;
+        bool Visible = false;
+        Shape Form = Shape::Box;
+        Bounds Extent;
+        Int32 CachedIndex = 0;
+
+        static StringView RegisterName()
+            { return "Prop"; }
+
+        static auto RegisterMembers()
+        {
+            using namespace Mezzanine;
+            using SelfType = Prop;
+
+            return Members(
+                MakeMemberAccessor("Label",&SelfType::Label),
+                MakeMemberAccessor("Count",&SelfType::Count),
+                MakeMemberAccessor("Mass",&SelfType::Mass),
+                MakeMemberAccessor("Visible",&SelfType::Visible),
+                MakeMemberAccessor("Form",&SelfType::Form),
+                MakeMemberAccessor("Extent",&SelfType::Extent),
+                MakeMemberAccessor<MemberTags::Generated>("CachedIndex",&SelfType::CachedIndex)
+            );
+        }
+    };
+}
+
+AUTOMATIC_TEST_GROUP(XMLNodeBuilderTests,XMLNodeBuilder)
+{
+    using namespace Mezzanine;
+    using namespace XMLNodeBuilderTest;
+
+    Prop Source;
+    Source.Label = "Crate \"A\" & co";
+    Source.Count = -12;
+    Source.Mass = 0.1;
+    Source.Visible = true;
+    Source.Form = Shape::Sphere;
+    Source.Extent = Bounds{2.5f,0.3f};
+    Source.CachedIndex = 44;
+
+    TestElement Root;
+    TestNode RootNode{ &Root };
+    TestNode Built = BuildNode(RootNode,Source);
+
+    TEST_EQUAL("BuildNode(NodeType&,const_Class&)-Appended",
+               size_t(1),Root.Children.size())
+    TEST_EQUAL("BuildNode(NodeType&,const_Class&)-Returned",
+               &Root.Children.front(),Built.Element)
+    TEST_EQUAL("BuildNode(NodeType&,const_Class&)-Name",
+               String("Prop"),Built.Element->Name)
+    TEST_EQUAL("BuildNode(NodeType&,const_Class&)-AttributeCount",
+               size_t(5),Built.Element->Attributes.size())
+    TEST_EQUAL("BuildNode(NodeType&,const_Class&)-Int",
+               String("-12"),Built.Element->Attributes[1].second)
+    TEST_EQUAL("BuildNode(NodeType&,const_Class&)-Double",
+               String("0.1"),Built.Element->Attributes[2].second)
+    TEST_EQUAL("BuildNode(NodeType&,const_Class&)-Bool",
+               String("true"),Built.Element->Attributes[3].second)
+    TEST_EQUAL("BuildNode(NodeType&,const_Class&)-Enum",
+               String("2"),Built.Element->Attributes[4].second)
+    TEST_EQUAL("BuildNode(NodeType&,const_Class&)-Child",
+               String("Extent"),Built.Element->Children.front().Name)
+    TEST_EQUAL("BuildNode(NodeType&,const_Class&)-ChildFloat",
+               String("0.3"),Built.Element->Children.front().Attributes[1].second)
+
+    std::stringstream Text;
+    PrintElement(Text,*Built.Element);
+    Prop Read;
+    StreamDeSerialize(Text,Read);
+    TEST_EQUAL("BuildNode(NodeType&,const_Class&)-RoundTripString",
+               Source.Label,Read.Label)
+    TEST_EQUAL("BuildNode(NodeType&,const_Class&)-RoundTripDouble",
+               Source.Mass,Read.Mass)
+    TEST_EQUAL("BuildNode(NodeType&,const_Class&)-RoundTripEnum",
+               true,Source.Form == Read.Form)
+    TEST_EQUAL("BuildNode(NodeType&,const_Class&)-RoundTripChild",
+               Source.Extent.Height,Read.Extent.Height)
+    TEST_EQUAL("BuildNode(NodeType&,const_Class&)-RoundTripGenerated",
+               Int32(0),Read.CachedIndex)
+}
+
+#endif
@@ -0,0 +1,256 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_XMLPullReaderTests_h
+#define Mezz_Foundation_XMLPullReaderTests_h
+
+/// @file
+/// @brief This file tests the functionality of the streaming XML pull parser.
+
+#include "MezzTest.h"
+
+#include "MezzException.h"
+#include "XMLPullReader.h"
+
+#include <sstream>
+
+namespace XMLPullReaderTest
+{
+    using Mezzanine::Int32;
+    using Mezzanine::String;
+    using Mezzanine::StringView;
+
+    struct Colour
+    {
+        float Red = 0.0f;
+        float Green = 0.0f;
+        float Blue = 0.0f;
+
+        static StringView RegisterName()
+            { return "Colour"; }
+
+        static auto RegisterMembers()
+        {
+            using namespace Mezzanine;
+            using SelfType = Colour;
+
+            return Members(
+                MakeMemberAccessor("Red",&SelfType::Red),
+                MakeMemberAccessor("Green",&SelfType::Green),
+                MakeMemberAccessor("Blue",&SelfType::Blue)
+            );
+        }
+    };
+
+    struct Light
+    {
+        String Name;
+        Int32 Range = 0;
+        bool Enabled = false;
+        Colour Tint;
+        Int32 CachedFrame = 0;
+
+        static StringView RegisterName()
+            { return "Light"; }
+
+        static auto RegisterMembers()
+        {
+            using namespace Mezzanine;
+            using SelfType = Light;
+
+            return Members(
+                MakeMemberAccessor("Name",&SelfType::Name),
+                MakeMemberAccessor("Range",&SelfType::Range),
+                MakeMemberAccessor("Enabled",&SelfType::Enabled),
+                MakeMemberAccessor("Tint",&SelfType::Tint),
+                MakeMemberAccessor<MemberTags::Local>("CachedFrame",&SelfType::CachedFrame)
+            );
+        }
+    };
+}
+
+AUTOMATIC_TEST_GROUP(XMLPullReaderTests,XMLPullReader)
+{
+    using namespace Mezzanine;
+    using namespace XMLPullReaderTest;
+    using EventType = XMLPullReader::EventType;
+
+    {// Events
+        std::istringstream Source(
+            "<?xml version=\"1.0\"?>\n"
+            "<!-- A comment -->\n"
+            "<Root Id=\"7\" Title='a &amp; b &#x41;&#66;'>\n"
+            "  <Empty/>\n"
+            "  <Text>x &lt; y<![CDATA[<raw>]]></Text>\n"
+            "</Root><Next/>"
+        );
+        XMLPullReader Reader(Source);
+
+        TEST_EQUAL("Next()-RootStart",
+                   EventType::StartElement,Reader.Next())
+        TEST_EQUAL("GetName()-Root",
+                   StringView("Root"),Reader.GetName())
+        TEST_EQUAL("GetDepth()-Root",
+                   SizeType(1),Reader.GetDepth())
+        TEST_EQUAL("GetAttributeCount()",
+                   SizeType(2),Reader.GetAttributeCount())
+        TEST_EQUAL("GetAttributeName(const_SizeType)",
+                   StringView("Title"),Reader.GetAttributeName(1))
+        TEST_EQUAL("GetAttributeValue(const_SizeType)-Entities",
+                   StringView("a & b AB"),Reader.GetAttributeValue(1))
+        StringView Id;
+        TEST_EQUAL("FindAttribute(const_StringView,StringView&)-Found",
+                   true,Reader.FindAttribute("Id",Id) && Id == "7")
+        TEST_EQUAL("FindAttribute(const_StringView,StringView&)-Missing",
+                   false,Reader.FindAttribute("Colour",Id))
+
+        TEST_EQUAL("Next()-EmptyStart",
+                   EventType::StartElement,Reader.Next())
+        TEST_EQUAL("IsEmptyElement()",
+                   true,Reader.IsEmptyElement())
+        TEST_EQUAL("Next()-EmptyEnd",
+                   EventType::EndElement,Reader.Next())
+        TEST_EQUAL("GetDepth()-EmptyEnd",
+                   SizeType(2),Reader.GetDepth())
+
+        TEST_EQUAL("Next()-TextStart",
+                   EventType::StartElement,Reader.Next())
+        TEST_EQUAL("Next()-Text",
+                   EventType::Text,Reader.Next())
+        TEST_EQUAL("GetText()",
+                   StringView("x < y"),Reader.GetText())
+        TEST_EQUAL("Next()-CDATA",
+                   EventType::Text,Reader.Next())
+        TEST_EQUAL("GetText()-CDATA",
+                   StringView("<raw>"),Reader.GetText())
+        TEST_EQUAL("Next()-TextEnd",
+                   EventType::EndElement,Reader.Next())
+
+        TEST_EQUAL("Next()-RootEnd",
+                   EventType::EndElement,Reader.Next())
+        TEST_EQUAL("GetName()-RootEnd",
+                   StringView("Root"),Reader.GetName())
+        TEST_EQUAL("Next()-EndOfDocument",
+                   EventType::EndOfDocument,Reader.Next())
+
+        String Rest;
+        std::getline(Source,Rest);
+        TEST_EQUAL("Next()-StopsAfterRoot",
+                   String("<Next/>"),Rest)
+    }// Events
+
+    {// Skipping
+        std::istringstream Source("<A><B><C/><C>text</C></B><D Value=\"1\"/></A>");
+        XMLPullReader Reader(Source);
+        Reader.Next();
+        TEST_EQUAL("NextChildElement(const_SizeType)-First",
+                   true,Reader.NextChildElement(1))
+        Reader.SkipElement();
+        TEST_EQUAL("SkipElement()",
+                   StringView("B"),Reader.GetName())
+        TEST_EQUAL("NextChildElement(const_SizeType)-Second",
+                   true,Reader.NextChildElement(1))
+        TEST_EQUAL("NextChildElement(const_SizeType)-SecondName",
+                   StringView("D"),Reader.GetName())
+        TEST_EQUAL("NextChildElement(const_SizeType)-End",
+                   false,Reader.NextChildElement(1))
+    }// Skipping
+
+    {// Malformed
+        TEST_THROW("Next()-MismatchedTag",
+                   Exception::Encoding,
+                   [](){ std::istringstream Source("<A></B>");
+                         XMLPullReader Reader(Source);
+                         Reader.Next();
+                         Reader.Next(); })
+        TEST_THROW("Next()-Truncated",
+                   Exception::Encoding,
+                   [](){ std::istringstream Source("<A><B>");
+                         XMLPullReader Reader(Source);
+                         while( Reader.Next() != XMLPullReader::EventType::EndOfDocument ) {  } })
+        TEST_THROW("Next()-UnknownEntity",
+                   Exception::Encoding,
+                   [](){ std::istringstream Source("<A B=\"&nope;\"/>");
+                         XMLPullReader Reader(Source);
+                         Reader.Next(); })
+    }// Malformed
+
+    {// Registered Classes
+        std::istringstream Source(
+            "<Light Name=\"Lamp &quot;1&quot;\" Range=\"25\" Enabled=\"true\" CachedFrame=\"9\" Unknown=\"x\">"
+            "<Extra><Nested/></Extra>"
+            "<Tint Red=\"0.5\" Green=\"0.25\" Blue=\"1\"/>"
+            "</Light>"
+            "<Light Name=\"Second\"/>"
+        );
+        Light First;
+        StreamDeSerialize(Source,First);
+        TEST_EQUAL("StreamDeSerialize(std::istream&,Class&)-String",
+                   String("Lamp \"1\""),First.Name)
+        TEST_EQUAL("StreamDeSerialize(std::istream&,Class&)-Int",
+                   Int32(25),First.Range)
+        TEST_EQUAL("StreamDeSerialize(std::istream&,Class&)-Bool",
+                   true,First.Enabled)
+        TEST_EQUAL("StreamDeSerialize(std::istream&,Class&)-Nested",
+                   0.25f,First.Tint.Green)
+        TEST_EQUAL("StreamDeSerialize(std::istream&,Class&)-SkipsLocal",
+                   Int32(0),First.CachedFrame)
+
+        Light Second;
+        Second.Range = 3;
+        StreamDeSerialize(Source,Second);
+        TEST_EQUAL("StreamDeSerialize(std::istream&,Class&)-Sequential",
+                   String("Second"),Second.Name)
+        TEST_EQUAL("StreamDeSerialize(std::istream&,Class&)-Untouched",
+                   Int32(3),Second.Range)
+
+        TEST_THROW("StreamDeSerialize(std::istream&,Class&)-WrongRoot",
+                   Exception::Encoding,
+                   [](){ std::istringstream Wrong("<Colour Red=\"1\"/>");
+                         Light Target;
+                         StreamDeSerialize(Wrong,Target); })
+        TEST_THROW("StreamDeSerialize(std::istream&,Class&)-BadNumber",
+                   Exception::Encoding,
+                   [](){ std::istringstream Wrong("<Light Range=\"far\"/>");
+                         Light Target;
+                         StreamDeSerialize(Wrong,Target); })
+    }// Registered Classes
+}
+
+#endif
@@ -0,0 +1,153 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_XXHashBenchmarks_h
+#define Mezz_Foundation_XXHashBenchmarks_h
+
+/// @file
+/// @brief This contains benchmarks comparing the XXH3 hashes against the Murmur hashes.
+
+#include "MezzTest.h"
+#include "TimingTools.h"
+#include "RuntimeStatics.h"
+
+#include "MurmurHash.h"
+#include "XXHash.h"
+
+#include <vector>
+
+BENCHMARK_TEST_GROUP(XXHashBenchmarks,XXHashBenchmarks)
+{
+    if(Mezzanine::RuntimeStatic::Debug())
+        { return; }
+
+    using namespace Mezzanine;
+
+    using Mezzanine::Testing::MicroBenchmark;
+    using Mezzanine::Testing::MicroBenchmarkResults;
+
+    const std::chrono::milliseconds TestTime(250);
+
+    // One buffer big enough for the largest size, filled with bytes that aren't trivially compressible.
+    const SizeType LargestSize = 16 * 1024 * 1024;
+    std::vector<UInt8> Data(LargestSize);
+    UInt64 State = 1;
+    for( UInt8& Current : Data )
+    {
+        State = ( State * 6364136223846793005ULL ) + 1442695040888963407ULL;
+        Current = static_cast<UInt8>( State >> 56 );
+    }
+
+    TestLog << "\n" << "XXHash Benchmarks" << "\n\n"
+            << "Hashing inputs from 16 bytes to 16 MB with MurmurHash3_x64_128, XXHash3_64 and XXHash3_128.\n\n";
+
+    // Hashes small inputs many times per iteration so the timer overhead doesn't swamp them.
+    const SizeType BytesPerIteration = 64 * 1024;
+    const SizeType Sizes[] = { 16, 256, 4 * 1024, 64 * 1024, 1024 * 1024, LargestSize };
+
+    // The results are folded together so the optimizer can't discard any of the hashing.
+    UInt64 Sink = 0;
+    PreciseReal LargeMurmurPer = 0.0;
+    PreciseReal LargeXXHashPer = 0.0;
+    for( const SizeType Size : Sizes )
+    {
+        const SizeType Repeats = ( Size < BytesPerIteration ? BytesPerIteration / Size : 1 );
+        const PreciseReal Bytes = PreciseReal( Size * Repeats );
+
+        // Reports a result and returns the nanoseconds per iteration.
+        auto Report = [&](const char* Description, const MicroBenchmarkResults& Result) {
+            const PreciseReal Per = PreciseReal( Result.WallTotal.count() ) / PreciseReal( Result.Iterations );
+            TestLog << "  " << Description << " " << ( Bytes * 1000.0 / Per ) << " MB/s\n";
+            return Per;
+        };
+
+        TestLog << Size << " byte inputs:\n";
+        auto HashMurmur = [&](){
+            for( SizeType Repeat = 0 ; Repeat < Repeats ; ++Repeat )
+            {
+                const SizeType Offset = ( Repeat * Size ) % ( LargestSize - Size + 1 );
+                Sink += Hashing::MurmurHash3_x64_128(Data.data() + Offset,Size,0).Hash[0];
+            }
+        };
+        const PreciseReal MurmurPer = Report("MurmurHash3_x64_128",MicroBenchmark(TestTime,std::move(HashMurmur)));
+
+        auto HashXX64 = [&](){
+            for( SizeType Repeat = 0 ; Repeat < Repeats ; ++Repeat )
+            {
+                const SizeType Offset = ( Repeat * Size ) % ( LargestSize - Size + 1 );
+                Sink += Hashing::XXHash3_64(Data.data() + Offset,Size,0);
+            }
+        };
+        const PreciseReal XX64Per = Report("XXHash3_64         ",MicroBenchmark(TestTime,std::move(HashXX64)));
+
+        auto HashXX128 = [&](){
+            for( SizeType Repeat = 0 ; Repeat < Repeats ; ++Repeat )
+            {
+                const SizeType Offset = ( Repeat * Size ) % ( LargestSize - Size + 1 );
+                Sink += Hashing::XXHash3_128(Data.data() + Offset,Size,0).Hash[0];
+            }
+        };
+        Report("XXHash3_128        ",MicroBenchmark(TestTime,std::move(HashXX128)));
+
+        if( Size == LargestSize ) {
+            LargeMurmurPer = MurmurPer;
+            LargeXXHashPer = XX64Per;
+        }
+    }
+
+    auto StreamLarge = [&](){
+        Hashing::XXHash3Stream Stream;
+        const SizeType PieceSize = 64 * 1024;
+        for( SizeType Offset = 0 ; Offset < LargestSize ; Offset += PieceSize )
+            { Stream.Update(Data.data() + Offset,PieceSize); }
+        Sink += Stream.Finalize64();
+    };
+    const MicroBenchmarkResults StreamResult = MicroBenchmark(TestTime,std::move(StreamLarge));
+    const PreciseReal StreamPer =
+        PreciseReal( StreamResult.WallTotal.count() ) / PreciseReal( StreamResult.Iterations );
+    TestLog << "XXHash3Stream fed 16 MB in 64 KB pieces: " << ( PreciseReal(LargestSize) * 1000.0 / StreamPer )
+            << " MB/s\n";
+
+    TestLog << "\nOn 16 MB XXHash3_64 takes about " << ( LargeXXHashPer * 100.0 ) / LargeMurmurPer
+            << "% as long as MurmurHash3_x64_128. Checksum " << Sink << "\n\n";
+
+    TEST_PERF("XXHash3_64IsFasterOnLargeInputs", LargeXXHashPer < LargeMurmurPer)
+}
+
+#endif
@@ -0,0 +1,224 @@
+// © Copyright 2010 - 2020 BlackTopp Studios Inc.
+/* This file is part of The Mezzanine Engine.
+
+    The Mezzanine Engine is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    The Mezzanine Engine is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with The Mezzanine Engine.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/* The original authors have included a copy of the license specified above in the
+   'Docs' folder. See 'gpl.txt'
+*/
+/* We welcome the use of the Mezzanine engine to anyone, including companies who wish to
+   Build professional software and charge for their product.
+
+   However there are some practical restrictions, so if your project involves
+   any of the following you should contact us and we will try to work something
+   out:
+    - DRM or Copy Protection of any kind(except Copyrights)
+    - Software Patents You Do Not Wish to Freely License
+    - Any Kind of Linking to Non-GPL licensed Works
+    - Are Currently In Violation of Another Copyright Holder's GPL License
+    - If You want to change our code and not add a few hundred MB of stuff to
+        your distribution
+
+   These and other limitations could cause serious legal problems if you ignore
+   them, so it is best to simply contact us or the Free Software Foundation, if
+   you have any questions.
+
+   Joseph Toppi - toppij@gmail.com
+   John Blackwood - makoenergy02@gmail.com
+*/
+#ifndef Mezz_Foundation_XXHashTests_h
+#define Mezz_Foundation_XXHashTests_h
+
+/// @file
+/// @brief This file tests the functionality of the XXH3 hash functions.
+
+#include "MezzTest.h"
+
+#include "XXHash.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace XXHashTest {
+    using namespace Mezzanine;
+
+    SAVE_WARNING_STATE
+    SUPPRESS_CLANG_WARNING("-Wc++98-compat-pedantic")
+    /// @brief The nonzero seed the reference hashes were made with.
+    const UInt64 SecondSeed = 0x9E3779B97F4A7C15ULL;
+    RESTORE_WARNING_STATE
+
+    /// @brief A hash of a prefix of the test data, made with the reference xxHash 0.8 library.
+    struct ReferenceHash
+    {
+        /// @brief The byte length of the prefix that was hashed.
+        SizeType Length;
+        /// @brief The seed the prefix was hashed with.
+        UInt64 Seed;
+        /// @brief The result of XXH3_64bits_withSeed.
+        UInt64 Hash64;
+        /// @brief The low half of the result of XXH3_128bits_withSeed.
+        UInt64 Low128;
+        /// @brief The high half of the result of XXH3_128bits_withSeed.
+        UInt64 High128;
+    };//ReferenceHash
+
+    /// @brief Gets the bytes the reference hashes were made from.
+    /// @return Returns 8192 bytes from a 64-bit linear congruential generator seeded with 1.
+    inline std::vector<UInt8> MakeTestData()
+    {
+        std::vector<UInt8> Data(8192);
+        UInt64 State = 1;
+        for( UInt8& Current : Data )
+        {
+            State = ( State * 6364136223846793005ULL ) + 1442695040888963407ULL;
+            Current = static_cast<UInt8>( State >> 56 );
+        }
+        return Data;
+    }
+
+    /// @brief Reference hashes for lengths on both sides of every size class boundary.
+    const ReferenceHash ReferenceHashes[] = {
+        {    0, 0         , 0x2d06800538d394c2ULL, 0x6001c324468d497fULL, 0x99aa06d3014798d8ULL },
+        {    1, 0         , 0xc00f9d4f580c0c3aULL, 0xc00f9d4f580c0c3aULL, 0xc89f16e01381dd11ULL },
+        {    3, 0         , 0xe92112d1e602af4aULL, 0xe92112d1e602af4aULL, 0x042980e29fe07a72ULL },
+        {    4, 0         , 0x9008de7e100606d1ULL, 0xf38741e1b9ccfbd4ULL, 0x960811bdc2cb9dc3ULL },
+        {    8, 0         , 0xcca6ee6f8e080c52ULL, 0x9aac4cd28c312a76ULL, 0xff5c240882695f40ULL },
+        {    9, 0         , 0x568f9d2e69ad8bd0ULL, 0x289d4cd1af0c84bdULL, 0x3ad200a3678150cdULL },
+        {   16, 0         , 0x600a07a4f5a9911cULL, 0x729073442c453ee7ULL, 0x09bfcf6d0d0c7508ULL },
+        {   17, 0         , 0xdeab0265f35dfc24ULL, 0xd0b31235d80538afULL, 0xc0e06f2f6b379f4aULL },
+        {   32, 0         , 0xd04581c566616653ULL, 0x7a78eb27b3aef28bULL, 0x0bee74e0e3ef7423ULL },
+        {   33, 0         , 0xe2f96cd271e72881ULL, 0x0f2a1f3d6e780688ULL, 0xf01a5f3912b24aacULL },
+        {   64, 0         , 0xad0685dabb3ce66bULL, 0xed9a84b3780fc908ULL, 0x7d7cc02bbb48520eULL },
+        {   65, 0         , 0x7d4e3da065c21b2dULL, 0xac9b1ce636d915daULL, 0x559e598dd20cb466ULL },
+        {   96, 0         , 0xbf9a1938301428caULL, 0x23c4ecc869a876aeULL, 0x14adfddcbd9065a3ULL },
+        {   97, 0         , 0xae7c260494b7847cULL, 0x972292c2bfea9946ULL, 0x66891c04492fc201ULL },
+        {  128, 0         , 0x410bd3b4d8d84f51ULL, 0xc14ef9bdf2926d91ULL, 0xb0c97cf51fbd420eULL },
+        {  129, 0         , 0x55964eec39625032ULL, 0x1c66bb88fb267529ULL, 0x77672b5beabfd29eULL },
+        {  200, 0         , 0xedced795343597fdULL, 0x9346df8399c88499ULL, 0xd2e5234aded135cfULL },
+        {  240, 0         , 0x977b659bdc81fdb1ULL, 0x0dfe588c76a0d834ULL, 0x05fb829868e88d8bULL },
+        {  241, 0         , 0x2cb1ed4a30c8bdedULL, 0x2cb1ed4a30c8bdedULL, 0x19f9ed05e7993896ULL },
+        { 1024, 0         , 0x5ec111a1e5a293aeULL, 0x5ec111a1e5a293aeULL, 0x92da9c0cebcc106cULL },
+        { 1025, 0         , 0x5ea0264528a903fcULL, 0x5ea0264528a903fcULL, 0x76c00571248d6978ULL },
+        { 4096, 0         , 0xa76570548864595eULL, 0xa76570548864595eULL, 0x205cdca1be728c37ULL },
+        { 8192, 0         , 0xb97940fa848826e9ULL, 0xb97940fa848826e9ULL, 0x2768239f58d15724ULL },
+        {    0, SecondSeed, 0x602b0e2cd6662c8bULL, 0x4ca5176998171787ULL, 0xd142977a2cca554bULL },
+        {    1, SecondSeed, 0xe8c373bb37200c74ULL, 0xe8c373bb37200c74ULL, 0x548cd7e5841fc8d3ULL },
+        {    3, SecondSeed, 0xb68a6cc6a268845aULL, 0xb68a6cc6a268845aULL, 0xd225240cbe9716cfULL },
+        {    4, SecondSeed, 0x4f1f28ce9bf1480cULL, 0xf30ebef49357a8aaULL, 0xf5a8c0f64054c16aULL },
+        {    8, SecondSeed, 0x43e370b97e6af1d1ULL, 0xaa7aa1530cc041edULL, 0xc7a7ba041b6dfd8aULL },
+        {    9, SecondSeed, 0xb6b4ecb908431ff4ULL, 0xb8f7f426dc874bcfULL, 0x3d646fd5307c77f0ULL },
+        {   16, SecondSeed, 0x073f42644e04597fULL, 0xff6f97beffdd4584ULL, 0x509470d0416cca63ULL },
+        {   17, SecondSeed, 0xb60e28c96a0d8c66ULL, 0x031c28842f1fd843ULL, 0xe1829cc10c8079e0ULL },
+        {   32, SecondSeed, 0xa39249db9ed63ef9ULL, 0x427a62479dfe5839ULL, 0xa4e2ac18646ed2bdULL },
+        {   33, SecondSeed, 0x8525b1cec1257c68ULL, 0x33921df7eaee441dULL, 0xc2313adde6100276ULL },
+        {   64, SecondSeed, 0xfed08647a034586cULL, 0x5e868b242ef5e925ULL, 0x128e55fa5de6e009ULL },
+        {   65, SecondSeed, 0xa32b491cea9e8bd4ULL, 0x09215847742c1c41ULL, 0x92fb13f8f06af35cULL },
+        {   96, SecondSeed, 0x7e120e6421cc6202ULL, 0x7431d9aa8a2e0681ULL, 0x444e2895e0d05bb0ULL },
+        {   97, SecondSeed, 0xcf17c8dd1e9bf554ULL, 0xcc1c34f0c055e03dULL, 0x58b7aa1ebf4baff5ULL },
+        {  128, SecondSeed, 0xaac125a230b36a17ULL, 0x1f02d4471a9991f4ULL, 0xb3bd138e07e1e755ULL },
+        {  129, SecondSeed, 0x52be102d85c4d4fbULL, 0x7e3825f71d3cb3f2ULL, 0x2f2c41c3687835d1ULL },
+        {  200, SecondSeed, 0x5bde89033a74e7d8ULL, 0x9088fb987ee468e6ULL, 0xde345a99ad7946dfULL },
+        {  240, SecondSeed, 0x9cc1e12f830660fdULL, 0x0cf01b9e825a3254ULL, 0x02cf62797e8c637eULL },
+        {  241, SecondSeed, 0x61c29137c9eb93beULL, 0x61c29137c9eb93beULL, 0x212f8615e20804beULL },
+        { 1024, SecondSeed, 0x02cc9c6f55f44b79ULL, 0x02cc9c6f55f44b79ULL, 0x5eb54663bcd7cebbULL },
+        { 1025, SecondSeed, 0xf2a1f50896e5dfd5ULL, 0xf2a1f50896e5dfd5ULL, 0xe07bf25ff2aae222ULL },
+        { 4096, SecondSeed, 0x843965ca7b51b915ULL, 0x843965ca7b51b915ULL, 0x6222005b4b40168fULL },
+        { 8192, SecondSeed, 0xd1aeb6dc8ac57c8fULL, 0xd1aeb6dc8ac57c8fULL, 0x0515463fdef5d87bULL }
+    };
+}//XXHashTest
+
+AUTOMATIC_TEST_GROUP(XXHashTests,XXHash)
+{
+    using namespace Mezzanine;
+    using namespace XXHashTest;
+
+    const std::vector<UInt8> Data = MakeTestData();
+
+    {// One Shot
+        SizeType Mismatches64 = 0;
+        SizeType Mismatches128 = 0;
+        for( const ReferenceHash& Reference : ReferenceHashes )
+        {
+            const UInt64 Hash64 = Hashing::XXHash3_64(Data.data(),Reference.Length,Reference.Seed);
+            const Hashing::XXHashResult_128 Hash128 = Hashing::XXHash3_128(Data.data(),Reference.Length,Reference.Seed);
+            Mismatches64 += ( Hash64 != Reference.Hash64 );
+            Mismatches128 += ( Hash128.Hash[0] != Reference.Low128 || Hash128.Hash[1] != Reference.High128 );
+        }
+        TEST_EQUAL("XXHash3_64(const_void*,const_SizeType,const_UInt64)-Reference",
+                   SizeType(0),Mismatches64)
+        TEST_EQUAL("XXHash3_128(const_void*,const_SizeType,const_UInt64)-Reference",
+                   SizeType(0),Mismatches128)
+
+        // The well known hash of nothing with the default seed.
+        TEST_EQUAL("XXHash3_64(const_void*,const_SizeType,const_UInt64)-Empty",
+                   UInt64(0x2D06800538D394C2ULL),Hashing::XXHash3_64(nullptr,0,0))
+
+        // Hashes mustn't depend on where the data sits in memory.
+        std::vector<UInt8> Shifted(Data.size() + 3);
+        std::copy(Data.begin(),Data.end(),Shifted.begin() + 3);
+        TEST_EQUAL("XXHash3_64(const_void*,const_SizeType,const_UInt64)-Unaligned",
+                   Hashing::XXHash3_64(Data.data(),Data.size(),SecondSeed),
+                   Hashing::XXHash3_64(Shifted.data() + 3,Data.size(),SecondSeed))
+    }// One Shot
+
+    {// Streams
+        // Piece sizes that land the buffered bytes at many offsets within a stripe and buffer.
+        const SizeType PieceSizes[] = { 1, 7, 63, 64, 65, 255, 256, 257, 1000, 5000 };
+        SizeType Mismatches64 = 0;
+        SizeType Mismatches128 = 0;
+        for( const SizeType PieceSize : PieceSizes )
+        {
+            Hashing::XXHash3Stream Stream(SecondSeed);
+            for( SizeType Offset = 0 ; Offset < Data.size() ; Offset += PieceSize )
+                { Stream.Update(Data.data() + Offset,std::min(PieceSize,Data.size() - Offset)); }
+            const Hashing::XXHashResult_128 OneShot128 = Hashing::XXHash3_128(Data.data(),Data.size(),SecondSeed);
+            const Hashing::XXHashResult_128 Streamed128 = Stream.Finalize128();
+            Mismatches64 += ( Stream.Finalize64() != Hashing::XXHash3_64(Data.data(),Data.size(),SecondSeed) );
+            Mismatches128 += ( Streamed128.Hash[0] != OneShot128.Hash[0] || Streamed128.Hash[1] != OneShot128.Hash[1] );
+        }
+        TEST_EQUAL("XXHash3Stream::Finalize64()_const-PieceSizes",
+                   SizeType(0),Mismatches64)
+        TEST_EQUAL("XXHash3Stream::Finalize128()_const-PieceSizes",
+                   SizeType(0),Mismatches128)
+
+        // Check every reference prefix while streaming uneven pieces, including across the short input limit.
+        Hashing::XXHash3Stream Growing(0);
+        SizeType PrefixMismatches = 0;
+        SizeType Hashed = 0;
+        for( const ReferenceHash& Reference : ReferenceHashes )
+        {
+            if( Reference.Seed != 0 ) {
+                continue;
+            }
+            Growing.Update(Data.data() + Hashed,Reference.Length - Hashed);
+            Hashed = Reference.Length;
+            const Hashing::XXHashResult_128 Streamed128 = Growing.Finalize128();
+            PrefixMismatches += ( Growing.Finalize64() != Reference.Hash64 );
+            PrefixMismatches += ( Streamed128.Hash[0] != Reference.Low128 || Streamed128.Hash[1] != Reference.High128 );
+        }
+        TEST_EQUAL("XXHash3Stream::Update(const_void*,const_SizeType)-Prefixes",
+                   SizeType(0),PrefixMismatches)
+        TEST_EQUAL("XXHash3Stream::GetLength()_const",
+                   Data.size(),Growing.GetLength())
+
+        Growing.Reset(SecondSeed);
+        TEST_EQUAL("XXHash3Stream::Reset(const_UInt64)-Empty",
+                   Hashing::XXHash3_64(nullptr,0,SecondSeed),Growing.Finalize64())
+        TEST_EQUAL("XXHash3Stream::Reset(const_UInt64)-Length",
+                   SizeType(0),Growing.GetLength())
+    }// Streams
+}
+
+#endif